@@ -38,8 +38,15 @@ using AlgorithmParameters = luci::CircleOptimizer::Options::AlgorithmParameters;
 void print_help(const char *progname)
 {
   std::cerr << "USAGE: " << progname << " [options] input output" << std::endl;
+  std::cerr << "   --fold_constants : Enable FoldConstants Pass" << std::endl;
   std::cerr << "   --fuse_bcq : Enable FuseBCQ Pass" << std::endl;
   std::cerr << "   --fuse_instnorm : Enable FuseInstanceNormalization Pass" << std::endl;
+  std::cerr << "   --fuse_scale_shift : Enable FuseScaleShift Pass" << std::endl;
+  std::cerr << "   --fuse_activation_function : Enable FuseActivationFunction Pass" << std::endl;
+  std::cerr << "   --remove_redundant_transpose : Enable RemoveRedundantTranspose Pass"
+            << std::endl;
+  std::cerr << "   --remove_redundant_reshape : Enable RemoveRedundantReshape Pass" << std::endl;
+  std::cerr << "   --sink_transpose : Enable SinkTranspose Pass" << std::endl;
   std::cerr << "   --resolve_customop_batchmatmul : Enable ResolveCustomOpBatchMatMulPass Pass"
             << std::endl;
   std::cerr << "   --quantize_with_minmax : Enable QuantizeWithMinMax Pass" << std::endl;
@@ -73,6 +80,10 @@ int entry(int argc, char **argv)
   auto options = optimizer.options();
 
   // TODO merge this with help message
+  argparse["--fold_constants"] = [&options](const char **) {
+    options->enable(Algorithms::FoldConstants);
+    return 0;
+  };
   argparse["--fuse_bcq"] = [&options](const char **) {
     options->enable(Algorithms::FuseBCQ);
     return 0;
@@ -81,6 +92,26 @@ int entry(int argc, char **argv)
     options->enable(Algorithms::FuseInstanceNorm);
     return 0;
   };
+  argparse["--fuse_scale_shift"] = [&options](const char **) {
+    options->enable(Algorithms::FuseScaleShift);
+    return 0;
+  };
+  argparse["--fuse_activation_function"] = [&options](const char **) {
+    options->enable(Algorithms::FuseActivationFunction);
+    return 0;
+  };
+  argparse["--remove_redundant_transpose"] = [&options](const char **) {
+    options->enable(Algorithms::RemoveRedundantTranspose);
+    return 0;
+  };
+  argparse["--remove_redundant_reshape"] = [&options](const char **) {
+    options->enable(Algorithms::RemoveRedundantReshape);
+    return 0;
+  };
+  argparse["--sink_transpose"] = [&options](const char **) {
+    options->enable(Algorithms::SinkTranspose);
+    return 0;
+  };
   argparse["--resolve_customop_batchmatmul"] = [&options](const char **) {
     options->enable(Algorithms::ResolveCustomOpBatchMatMul);
     return 0;
@@ -30,6 +30,8 @@
 namespace luci_interpreter
 {
 
+class Kernel;
+
 class ExecutionObserver
 {
 public:
@@ -57,10 +59,27 @@ public:
 private:
   void createTensors(const loco::Graph *graph);
   void createKernels(const loco::Graph *graph);
+  void buildExecutionPlan(const loco::Graph *graph);
+  void allocateTensors();
+
+  // Node to visit during interpretation with its kernel and tensor resolved in advance.
+  struct ExecutionStep
+  {
+    const luci::CircleNode *node;
+    // nullptr for CircleConst and CircleInput nodes, there is nothing to compute for them.
+    Kernel *kernel;
+    const Tensor *tensor;
+  };
 
   const loco::Graph *_main_graph = nullptr;
   std::unique_ptr<class TensorMap> _tensor_map;
   std::unique_ptr<class KernelMap> _kernel_map;
+  // All the nodes producing tensors, in execution order.
+  std::vector<ExecutionStep> _execution_plan;
+  // Kernels in execution order, used when there are no observers.
+  std::vector<Kernel *> _kernels;
+  // Memory shared by intermediate tensors.
+  std::unique_ptr<uint8_t[]> _arena;
   std::vector<ExecutionObserver *> _observers;
 };
 
@@ -23,6 +23,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace luci_interpreter
@@ -91,6 +92,10 @@ class Tensor
 public:
   Tensor(DataType element_type, Shape shape, AffineQuantization quantization, std::string name);
 
+  // Creates a tensor using a buffer it does not own from the start, see 'setDataBuffer'.
+  Tensor(DataType element_type, Shape shape, AffineQuantization quantization, std::string name,
+         uint8_t *data);
+
   DataType element_type() const { return _element_type; }
 
   const Shape &shape() const { return _shape; }
@@ -107,9 +112,9 @@ public:
     return _quantization.zero_point[0];
   }
 
-  template <typename T> const T *data() const { return reinterpret_cast<const T *>(_data.get()); }
+  template <typename T> const T *data() const { return reinterpret_cast<const T *>(_data); }
 
-  template <typename T> T *data() { return reinterpret_cast<T *>(_data.get()); }
+  template <typename T> T *data() { return reinterpret_cast<T *>(_data); }
 
   const std::string &name() const { return _name; }
 
@@ -117,13 +122,22 @@ public:
 
   void writeData(const void *data_ptr, size_t data_size);
 
+  // Resizes the tensor. Tensors owning their data are reallocated, tensors using an external
+  // buffer only change their shape.
   void resize(const Shape &new_shape);
 
+  // Makes the tensor use a buffer it does not own (e.g. constant data of the model or a region of
+  // the interpreter's arena). The buffer may be set to nullptr and assigned later, after the
+  // shape is known.
+  void setDataBuffer(uint8_t *data);
+
 private:
   DataType _element_type;
   Shape _shape;
   AffineQuantization _quantization;
-  std::unique_ptr<uint8_t[]> _data;
+  std::unique_ptr<uint8_t[]> _owned_data;
+  uint8_t *_data = nullptr;
+  bool _has_external_data = false;
   std::string _name;
 };
 
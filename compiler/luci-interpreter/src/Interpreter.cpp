@@ -19,11 +19,13 @@
 #include "KernelBuilder.h"
 #include "KernelMap.h"
 #include "TensorMap.h"
+#include "core/MemoryPlanner.h"
 
 #include <loco/IR/Algorithm.h>
 
 #include <algorithm>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace luci_interpreter
 {
@@ -49,6 +51,28 @@ static const void *getNodeDataImpl(const luci::CircleConst *node, size_t *data_s
   return &node->at<DT>(0);
 }
 
+static bool isAuxiliaryNode(const luci::CircleNode *node)
+{
+  return node->opcode() == luci::CircleOpcode::CONST ||
+         node->opcode() == luci::CircleOpcode::CIRCLEINPUT ||
+         node->opcode() == luci::CircleOpcode::CIRCLEOUTPUT;
+}
+
+// Whether the tensor of the node can live in the arena. Tensors of graph inputs and outputs are
+// accessed by the user outside of 'interpret', so they keep their own memory.
+static bool isArenaTensor(const luci::CircleNode *node)
+{
+  if (isAuxiliaryNode(node))
+    return false;
+  for (const loco::Node *succ : loco::succs(node))
+  {
+    if (loco::must_cast<const luci::CircleNode *>(succ)->opcode() ==
+        luci::CircleOpcode::CIRCLEOUTPUT)
+      return false;
+  }
+  return true;
+}
+
 static const void *getNodeData(const luci::CircleConst *node, size_t *data_size)
 {
   switch (node->dtype())
@@ -94,14 +118,29 @@ void Interpreter::createTensors(const loco::Graph *graph)
       quantization.zero_point.assign(params->zerop.cbegin(), params->zerop.cend());
     }
 
-    auto tensor = std::make_unique<Tensor>(node->dtype(), std::move(shape), std::move(quantization),
-                                           node->name());
-
+    std::unique_ptr<Tensor> tensor;
     if (const auto *const_node = dynamic_cast<const luci::CircleConst *>(node))
     {
+      // Constant tensors refer to the data of the module instead of copying it.
       size_t data_size{};
       const void *const_data = getNodeData(const_node, &data_size);
-      tensor->writeData(const_data, data_size);
+      if (data_size != shape.num_elements() * getDataTypeSize(node->dtype()))
+        throw std::runtime_error("Invalid size of constant \"" + node->name() + "\".");
+      // Kernels never write to their inputs.
+      tensor = std::make_unique<Tensor>(node->dtype(), std::move(shape), std::move(quantization),
+                                        node->name(),
+                                        static_cast<uint8_t *>(const_cast<void *>(const_data)));
+    }
+    else if (isArenaTensor(node))
+    {
+      // Memory is assigned by 'allocateTensors' once the shape is inferred.
+      tensor = std::make_unique<Tensor>(node->dtype(), std::move(shape), std::move(quantization),
+                                        node->name(), nullptr);
+    }
+    else
+    {
+      tensor = std::make_unique<Tensor>(node->dtype(), std::move(shape), std::move(quantization),
+                                        node->name());
     }
 
     _tensor_map->setTensor(node, std::move(tensor));
@@ -117,9 +156,7 @@ void Interpreter::createKernels(const loco::Graph *graph)
     const auto *node = dynamic_cast<const luci::CircleNode *>(graph->nodes()->at(i));
     assert(node != nullptr);
 
-    if (node->opcode() == luci::CircleOpcode::CONST ||
-        node->opcode() == luci::CircleOpcode::CIRCLEINPUT ||
-        node->opcode() == luci::CircleOpcode::CIRCLEOUTPUT)
+    if (isAuxiliaryNode(node))
     {
       continue;
     }
@@ -128,6 +165,65 @@ void Interpreter::createKernels(const loco::Graph *graph)
   }
 }
 
+void Interpreter::buildExecutionPlan(const loco::Graph *graph)
+{
+  for (const loco::Node *loco_node :
+       loco::postorder_traversal(loco::output_nodes(const_cast<loco::Graph *>(graph))))
+  {
+    const auto *node = loco::must_cast<const luci::CircleNode *>(loco_node);
+
+    // CircleOutput nodes do not produce any tensors.
+    if (node->opcode() == luci::CircleOpcode::CIRCLEOUTPUT)
+      continue;
+
+    Kernel *kernel = isAuxiliaryNode(node) ? nullptr : _kernel_map->getKernel(node);
+    _execution_plan.push_back({node, kernel, _tensor_map->getTensor(node)});
+    if (kernel != nullptr)
+      _kernels.push_back(kernel);
+  }
+}
+
+void Interpreter::allocateTensors()
+{
+  // The lifetime of an intermediate tensor lasts from its producer to its last consumer.
+  std::unordered_map<const loco::Node *, size_t> last_use;
+  for (size_t i = 0; i < _execution_plan.size(); ++i)
+  {
+    const luci::CircleNode *node = _execution_plan[i].node;
+    for (uint32_t j = 0; j < node->arity(); ++j)
+      last_use[node->arg(j)] = i;
+  }
+
+  MemoryPlanner planner;
+  std::vector<std::vector<const Tensor *>> releases(_execution_plan.size());
+  for (size_t i = 0; i < _execution_plan.size(); ++i)
+  {
+    const ExecutionStep &step = _execution_plan[i];
+    if (isArenaTensor(step.node))
+    {
+      const Tensor *tensor = step.tensor;
+      planner.claim(tensor, tensor->shape().num_elements() *
+                                getDataTypeSize(tensor->element_type()));
+      // A tensor nobody reads is released right after it is produced.
+      const auto it = last_use.find(step.node);
+      releases[it != last_use.cend() ? it->second : i].push_back(tensor);
+    }
+    for (const Tensor *tensor : releases[i])
+      planner.release(tensor);
+  }
+  planner.plan();
+
+  _arena = std::make_unique<uint8_t[]>(planner.getArenaSize());
+  for (const ExecutionStep &step : _execution_plan)
+  {
+    if (isArenaTensor(step.node))
+    {
+      Tensor *tensor = _tensor_map->getTensor(step.node);
+      tensor->setDataBuffer(_arena.get() + planner.getOffset(tensor));
+    }
+  }
+}
+
 Interpreter::Interpreter(const luci::Module *module)
 {
   if (module->size() > 1)
@@ -142,6 +238,7 @@ Interpreter::Interpreter(const luci::Module *module)
 
   createTensors(_main_graph);
   createKernels(_main_graph);
+  buildExecutionPlan(_main_graph);
 
   // Configure the kernels, e.g. resize the tensors that they produce and do other kernel dependent
   // initialization. This has to be done in execution order, because configuration of a kernel may
@@ -149,23 +246,12 @@ Interpreter::Interpreter(const luci::Module *module)
   // TODO Some kernels (ex. Reshape, Pad) need some of their input tensors (ex 'shape', 'paddings')
   //  to be known in order to configure properly. This means that 'configure' and 'execute' steps
   //  should be interleaved. For now such 'dynamic' tensors are not supported.
-  for (const loco::Node *loco_node :
-       loco::postorder_traversal(loco::output_nodes(const_cast<loco::Graph *>(_main_graph))))
+  for (Kernel *kernel : _kernels)
   {
-    const auto *node = loco::must_cast<const luci::CircleNode *>(loco_node);
-    assert(node != nullptr);
-
-    // These nodes are auxiliary.
-    if (node->opcode() == luci::CircleOpcode::CONST ||
-        node->opcode() == luci::CircleOpcode::CIRCLEINPUT ||
-        node->opcode() == luci::CircleOpcode::CIRCLEOUTPUT)
-    {
-      continue;
-    }
-
-    Kernel *kernel = _kernel_map->getKernel(node);
     kernel->configure();
   }
+
+  allocateTensors();
 }
 
 Interpreter::~Interpreter() = default;
@@ -196,29 +282,28 @@ void Interpreter::readOutputTensor(const luci::CircleOutput *output_node, void *
 
 void Interpreter::interpret()
 {
-  for (const loco::Node *loco_node :
-       loco::postorder_traversal(loco::output_nodes(const_cast<loco::Graph *>(_main_graph))))
+  if (_observers.empty())
   {
-    const auto *node = loco::must_cast<const luci::CircleNode *>(loco_node);
-
-    // Compute the result for the node. CircleConst, CircleInput and CircleOutput nodes
-    // are auxiliary, there is nothing to compute for them.
-    if (node->opcode() != luci::CircleOpcode::CONST &&
-        node->opcode() != luci::CircleOpcode::CIRCLEINPUT &&
-        node->opcode() != luci::CircleOpcode::CIRCLEOUTPUT)
+    for (Kernel *kernel : _kernels)
     {
-      Kernel *kernel = _kernel_map->getKernel(node);
       kernel->execute();
     }
+    return;
+  }
+
+  for (const ExecutionStep &step : _execution_plan)
+  {
+    // Compute the result for the node. CircleConst and CircleInput nodes are auxiliary,
+    // there is nothing to compute for them.
+    if (step.kernel != nullptr)
+    {
+      step.kernel->execute();
+    }
 
-    // Notify the observers that the node's output tensor has changed. This is not done
-    // for CircleOutput nodes because they do not produce any tensors.
-    if (node->opcode() != luci::CircleOpcode::CIRCLEOUTPUT)
+    // Notify the observers that the node's output tensor has changed.
+    for (ExecutionObserver *observer : _observers)
     {
-      for (ExecutionObserver *observer : _observers)
-      {
-        observer->postTensorWrite(node, _tensor_map->getTensor(node));
-      }
+      observer->postTensorWrite(step.node, step.tensor);
     }
   }
 }
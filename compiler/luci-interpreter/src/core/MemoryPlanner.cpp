@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/MemoryPlanner.h"
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <stdexcept>
+
+namespace luci_interpreter
+{
+
+static size_t alignSize(size_t size)
+{
+  return (size + MemoryPlanner::ALIGNMENT - 1) / MemoryPlanner::ALIGNMENT *
+         MemoryPlanner::ALIGNMENT;
+}
+
+void MemoryPlanner::claim(const Tensor *tensor, size_t size)
+{
+  assert(!_planned);
+  if (_tensors.find(tensor) != _tensors.cend())
+    throw std::runtime_error("Tensor \"" + tensor->name() + "\" is already claimed.");
+
+  TensorInfo &info = _tensors[tensor];
+  info.size = alignSize(size);
+  info.offset = 0;
+  info.order = _tensors.size() - 1;
+  for (const Tensor *live_tensor : _live_tensors)
+  {
+    info.interferences.insert(live_tensor);
+    _tensors.at(live_tensor).interferences.insert(tensor);
+  }
+  _live_tensors.insert(tensor);
+}
+
+void MemoryPlanner::release(const Tensor *tensor)
+{
+  assert(!_planned);
+  assert(_tensors.find(tensor) != _tensors.cend());
+  _live_tensors.erase(tensor);
+}
+
+void MemoryPlanner::plan()
+{
+  // Place larger tensors first, ties are broken by claim order.
+  std::vector<std::pair<const Tensor *, TensorInfo *>> sorted;
+  sorted.reserve(_tensors.size());
+  for (auto &entry : _tensors)
+    sorted.emplace_back(entry.first, &entry.second);
+  std::sort(sorted.begin(), sorted.end(), [](const auto &lhs, const auto &rhs) {
+    if (lhs.second->size != rhs.second->size)
+      return lhs.second->size > rhs.second->size;
+    return lhs.second->order < rhs.second->order;
+  });
+
+  // Placed tensors sorted by offset.
+  std::multimap<size_t, const Tensor *> placed;
+  _arena_size = 0;
+  for (const auto &entry : sorted)
+  {
+    TensorInfo &info = *entry.second;
+    // Find the lowest offset that does not overlap with any placed interfering tensor.
+    size_t offset = 0;
+    for (const auto &placed_entry : placed)
+    {
+      if (info.interferences.find(placed_entry.second) == info.interferences.cend())
+        continue;
+
+      const size_t other_offset = placed_entry.first;
+      const size_t other_size = _tensors.at(placed_entry.second).size;
+      if (offset + info.size <= other_offset)
+        break;
+      offset = std::max(offset, other_offset + other_size);
+    }
+    info.offset = offset;
+    placed.emplace(offset, entry.first);
+    _arena_size = std::max(_arena_size, offset + info.size);
+  }
+  _planned = true;
+}
+
+size_t MemoryPlanner::getOffset(const Tensor *tensor) const
+{
+  assert(_planned);
+  const auto it = _tensors.find(tensor);
+  if (it == _tensors.cend())
+    throw std::runtime_error("Tensor \"" + tensor->name() + "\" is not planned.");
+  return it->second.offset;
+}
+
+} // namespace luci_interpreter
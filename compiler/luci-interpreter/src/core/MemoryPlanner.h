@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CORE_MEMORYPLANNER_H
+#define LUCI_INTERPRETER_CORE_MEMORYPLANNER_H
+
+#include "luci_interpreter/core/Tensor.h"
+
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace luci_interpreter
+{
+
+// Places tensors into a single arena based on their lifetimes.
+//
+// Tensors are claimed and released in execution order. Tensors whose lifetimes overlap interfere
+// with each other and get disjoint regions of the arena, others may share memory. Placement is
+// done greedily from the largest tensor to the smallest, each tensor taking the lowest offset
+// that does not overlap with already placed interfering tensors (same as onert's WICPlanner).
+class MemoryPlanner
+{
+public:
+  // Offsets of tensors in the arena are aligned to this value.
+  static constexpr size_t ALIGNMENT = 16;
+
+  // Starts the lifetime of the tensor.
+  void claim(const Tensor *tensor, size_t size);
+
+  // Ends the lifetime of the tensor.
+  void release(const Tensor *tensor);
+
+  // Computes offsets of all the claimed tensors. Must be called after all claims and releases.
+  void plan();
+
+  size_t getOffset(const Tensor *tensor) const;
+
+  size_t getArenaSize() const { return _arena_size; }
+
+private:
+  struct TensorInfo
+  {
+    size_t size;
+    size_t offset;
+    // Claim order, used to make the plan deterministic.
+    size_t order;
+    std::unordered_set<const Tensor *> interferences;
+  };
+
+  std::unordered_map<const Tensor *, TensorInfo> _tensors;
+  std::unordered_set<const Tensor *> _live_tensors;
+  size_t _arena_size = 0;
+  bool _planned = false;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CORE_MEMORYPLANNER_H
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/MemoryPlanner.h"
+
+#include <gtest/gtest.h>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+Tensor makeTensor(const std::string &name)
+{
+  return Tensor(DataType::FLOAT32, Shape{1}, {}, name);
+}
+
+TEST(MemoryPlannerTest, Chain)
+{
+  // t0 -> t1 -> t2 -> t3 : only two adjacent tensors are alive at a time.
+  Tensor t0 = makeTensor("t0"), t1 = makeTensor("t1"), t2 = makeTensor("t2"),
+         t3 = makeTensor("t3");
+
+  MemoryPlanner planner;
+  planner.claim(&t0, 64);
+  planner.claim(&t1, 32);
+  planner.release(&t0);
+  planner.claim(&t2, 64);
+  planner.release(&t1);
+  planner.claim(&t3, 32);
+  planner.release(&t2);
+  planner.release(&t3);
+  planner.plan();
+
+  EXPECT_EQ(planner.getArenaSize(), 96);
+  EXPECT_EQ(planner.getOffset(&t0), planner.getOffset(&t2));
+  EXPECT_EQ(planner.getOffset(&t1), planner.getOffset(&t3));
+  EXPECT_NE(planner.getOffset(&t0), planner.getOffset(&t1));
+}
+
+TEST(MemoryPlannerTest, Interference)
+{
+  Tensor t0 = makeTensor("t0"), t1 = makeTensor("t1"), t2 = makeTensor("t2");
+
+  MemoryPlanner planner;
+  planner.claim(&t0, 10);
+  planner.claim(&t1, 20);
+  planner.claim(&t2, 30);
+  planner.release(&t0);
+  planner.release(&t1);
+  planner.release(&t2);
+  planner.plan();
+
+  // Sizes are aligned and all the tensors are alive at the same time.
+  EXPECT_EQ(planner.getArenaSize(), 16 + 32 + 32);
+  for (const Tensor *tensor : {&t0, &t1, &t2})
+  {
+    EXPECT_EQ(planner.getOffset(tensor) % MemoryPlanner::ALIGNMENT, 0);
+  }
+  EXPECT_NE(planner.getOffset(&t0), planner.getOffset(&t1));
+  EXPECT_NE(planner.getOffset(&t1), planner.getOffset(&t2));
+  EXPECT_NE(planner.getOffset(&t0), planner.getOffset(&t2));
+}
+
+TEST(MemoryPlannerTest, DoubleClaim_NEG)
+{
+  Tensor t0 = makeTensor("t0");
+
+  MemoryPlanner planner;
+  planner.claim(&t0, 10);
+  EXPECT_ANY_THROW(planner.claim(&t0, 10));
+}
+
+} // namespace
+} // namespace luci_interpreter
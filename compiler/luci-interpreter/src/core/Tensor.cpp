@@ -29,7 +29,15 @@ Tensor::Tensor(DataType element_type, Shape shape, AffineQuantization quantizati
 {
   const size_t element_size = getDataTypeSize(_element_type);
   const int32_t num_elements = _shape.num_elements();
-  _data = std::make_unique<uint8_t[]>(num_elements * element_size);
+  _owned_data = std::make_unique<uint8_t[]>(num_elements * element_size);
+  _data = _owned_data.get();
+}
+
+Tensor::Tensor(DataType element_type, Shape shape, AffineQuantization quantization,
+               std::string name, uint8_t *data)
+    : _element_type(element_type), _shape(std::move(shape)), _quantization(std::move(quantization)),
+      _data(data), _has_external_data(true), _name(std::move(name))
+{
 }
 
 void Tensor::readData(void *data_ptr, size_t data_size) const
@@ -57,9 +65,20 @@ void Tensor::writeData(const void *data_ptr, size_t data_size)
 void Tensor::resize(const Shape &new_shape)
 {
   _shape = new_shape;
+  if (_has_external_data)
+    return;
+
   const size_t element_size = getDataTypeSize(_element_type);
   const int32_t num_elements = _shape.num_elements();
-  _data = std::make_unique<uint8_t[]>(num_elements * element_size);
+  _owned_data = std::make_unique<uint8_t[]>(num_elements * element_size);
+  _data = _owned_data.get();
+}
+
+void Tensor::setDataBuffer(uint8_t *data)
+{
+  _owned_data.reset();
+  _data = data;
+  _has_external_data = true;
 }
 
 } // namespace luci_interpreter
@@ -37,6 +37,12 @@ public:
       ResolveCustomOpBatchMatMul,
       QuantizeDequantizeWeights,
       QuantizeWithMinMax,
+      FoldConstants,
+      FuseScaleShift,
+      FuseActivationFunction,
+      RemoveRedundantTranspose,
+      RemoveRedundantReshape,
+      SinkTranspose,
     };
 
     enum AlgorithmParameters
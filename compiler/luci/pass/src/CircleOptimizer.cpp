@@ -16,8 +16,14 @@
 
 #include "luci/CircleOptimizer.h"
 
+#include "luci/Pass/FoldConstantsPass.h"
 #include "luci/Pass/FuseBCQPass.h"
 #include "luci/Pass/FuseInstanceNormPass.h"
+#include "luci/Pass/FuseScaleShiftPass.h"
+#include "luci/Pass/FuseActivationFunctionPass.h"
+#include "luci/Pass/RemoveRedundantTransposePass.h"
+#include "luci/Pass/RemoveRedundantReshapePass.h"
+#include "luci/Pass/SinkTransposePass.h"
 #include "luci/Pass/ResolveCustomOpBatchMatMulPass.h"
 #include "luci/Pass/QuantizeWithMinMaxPass.h"
 #include "luci/Pass/QuantizeDequantizeWeightsPass.h"
@@ -103,6 +109,30 @@ void CircleOptimizer::optimize(loco::Graph *g) const
   logo::Phase phase;
 
   /* TRANSFORM DECLARATION BEGIN */
+  if (_options->query(Options::Algorithm::FoldConstants))
+  {
+    phase.emplace_back(std::make_unique<luci::FoldConstantsPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseScaleShift))
+  {
+    phase.emplace_back(std::make_unique<FuseScaleShiftPass>());
+  }
+  if (_options->query(Options::Algorithm::FuseActivationFunction))
+  {
+    phase.emplace_back(std::make_unique<FuseActivationFunctionPass>());
+  }
+  if (_options->query(Options::Algorithm::SinkTranspose))
+  {
+    phase.emplace_back(std::make_unique<SinkTransposePass>());
+  }
+  if (_options->query(Options::Algorithm::RemoveRedundantTranspose))
+  {
+    phase.emplace_back(std::make_unique<RemoveRedundantTransposePass>());
+  }
+  if (_options->query(Options::Algorithm::RemoveRedundantReshape))
+  {
+    phase.emplace_back(std::make_unique<RemoveRedundantReshapePass>());
+  }
   if (_options->query(Options::Algorithm::ResolveCustomOpBatchMatMul))
   {
     phase.emplace_back(std::make_unique<luci::ResolveCustomOpBatchMatMulPass>());
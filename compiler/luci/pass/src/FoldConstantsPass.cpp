@@ -0,0 +1,867 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FoldConstantsPass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/CircleNodeVisitor.h>
+#include <luci/Log.h>
+
+#include <loco/IR/DataTypeTraits.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+using Shape = std::vector<uint32_t>;
+
+uint32_t num_elements(const Shape &shape)
+{
+  uint32_t count = 1;
+  for (auto dim : shape)
+    count *= dim;
+  return count;
+}
+
+Shape shape_of(const luci::CircleConst *node)
+{
+  Shape shape(node->rank());
+  for (uint32_t axis = 0; axis < node->rank(); ++axis)
+    shape[axis] = node->dim(axis).value();
+  return shape;
+}
+
+/**
+ * @brief Return true if CircleConst of this type can be folded
+ * @note  Only types instantiated by CircleConst are allowed
+ */
+bool is_foldable_type(loco::DataType dtype)
+{
+  switch (dtype)
+  {
+    case loco::DataType::S64:
+    case loco::DataType::S32:
+    case loco::DataType::FLOAT32:
+    case loco::DataType::U8:
+    case loco::DataType::BOOL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool is_quantized(const luci::CircleNode *node)
+{
+  auto qparam = node->quantparam();
+  return qparam != nullptr && !qparam->scale.empty();
+}
+
+/**
+ * @brief Return node as CircleConst if it holds data that can be folded
+ */
+luci::CircleConst *as_const(loco::Node *node)
+{
+  auto const_node = dynamic_cast<luci::CircleConst *>(node);
+  if (const_node == nullptr)
+    return nullptr;
+  if (!is_foldable_type(const_node->dtype()))
+    return nullptr;
+  if (num_elements(shape_of(const_node)) == 0)
+    return nullptr;
+  return const_node;
+}
+
+const uint8_t *raw_data(const luci::CircleConst *node)
+{
+  switch (node->dtype())
+  {
+    case loco::DataType::S64:
+      return reinterpret_cast<const uint8_t *>(&node->at<loco::DataType::S64>(0));
+    case loco::DataType::S32:
+      return reinterpret_cast<const uint8_t *>(&node->at<loco::DataType::S32>(0));
+    case loco::DataType::FLOAT32:
+      return reinterpret_cast<const uint8_t *>(&node->at<loco::DataType::FLOAT32>(0));
+    case loco::DataType::U8:
+      return reinterpret_cast<const uint8_t *>(&node->at<loco::DataType::U8>(0));
+    case loco::DataType::BOOL:
+      return reinterpret_cast<const uint8_t *>(&node->at<loco::DataType::BOOL>(0));
+    default:
+      throw std::runtime_error("FoldConstantsPass: unsupported data type");
+  }
+}
+
+uint8_t *raw_data(luci::CircleConst *node)
+{
+  return const_cast<uint8_t *>(raw_data(static_cast<const luci::CircleConst *>(node)));
+}
+
+template <typename T> const T *typed_data(const luci::CircleConst *node)
+{
+  return reinterpret_cast<const T *>(raw_data(node));
+}
+
+template <typename T> T *typed_data(luci::CircleConst *node)
+{
+  return reinterpret_cast<T *>(raw_data(node));
+}
+
+/**
+ * @brief Create CircleConst which will replace 'origin'
+ */
+luci::CircleConst *create_const(luci::CircleNode *origin, loco::DataType dtype, const Shape &shape)
+{
+  auto node = origin->graph()->nodes()->create<luci::CircleConst>();
+  node->dtype(dtype);
+  node->rank(shape.size());
+  for (uint32_t axis = 0; axis < shape.size(); ++axis)
+    node->dim(axis) = shape[axis];
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->name(origin->name());
+
+  const auto count = num_elements(shape);
+  switch (dtype)
+  {
+    case loco::DataType::S64:
+      node->size<loco::DataType::S64>(count);
+      break;
+    case loco::DataType::S32:
+      node->size<loco::DataType::S32>(count);
+      break;
+    case loco::DataType::FLOAT32:
+      node->size<loco::DataType::FLOAT32>(count);
+      break;
+    case loco::DataType::U8:
+      node->size<loco::DataType::U8>(count);
+      break;
+    case loco::DataType::BOOL:
+      node->size<loco::DataType::BOOL>(count);
+      break;
+    default:
+      throw std::runtime_error("FoldConstantsPass: unsupported data type");
+  }
+
+  if (origin->quantparam() != nullptr)
+  {
+    auto qparam = std::make_unique<luci::CircleQuantParam>(*origin->quantparam());
+    node->quantparam(std::move(qparam));
+  }
+
+  return node;
+}
+
+/**
+ * @brief Return the shape of 'node' recorded in the graph if it is fully known
+ */
+bool recorded_shape(const luci::CircleNode *node, Shape &shape)
+{
+  if (node->shape_status() != luci::ShapeStatus::VALID)
+    return false;
+
+  shape.resize(node->rank());
+  for (uint32_t axis = 0; axis < node->rank(); ++axis)
+  {
+    if (!node->dim(axis).known())
+      return false;
+    shape[axis] = node->dim(axis).value();
+  }
+  return true;
+}
+
+/**
+ * @brief Return the source element offset of each element of 'out' shape
+ *
+ * @note  'strides' has the rank of 'out' and gives, for each axis of 'out', how far
+ *        the source offset moves when the coordinate on that axis increases by one
+ */
+std::vector<uint32_t> source_offsets(const Shape &out, const std::vector<uint32_t> &strides)
+{
+  assert(out.size() == strides.size());
+
+  const uint32_t rank = out.size();
+  std::vector<uint32_t> offsets(num_elements(out));
+  std::vector<uint32_t> coord(rank, 0);
+  uint32_t offset = 0;
+
+  for (uint32_t n = 0; n < offsets.size(); ++n)
+  {
+    offsets[n] = offset;
+    for (uint32_t axis = rank; axis-- > 0;)
+    {
+      offset += strides[axis];
+      if (++coord[axis] < out[axis])
+        break;
+      offset -= strides[axis] * out[axis];
+      coord[axis] = 0;
+    }
+  }
+
+  return offsets;
+}
+
+bool broadcast_shape(const Shape &x, const Shape &y, Shape &out)
+{
+  const auto rank = std::max(x.size(), y.size());
+  out.resize(rank);
+  for (uint32_t axis = 0; axis < rank; ++axis)
+  {
+    const uint32_t x_dim = axis < rank - x.size() ? 1 : x[axis - (rank - x.size())];
+    const uint32_t y_dim = axis < rank - y.size() ? 1 : y[axis - (rank - y.size())];
+    if (x_dim != y_dim && x_dim != 1 && y_dim != 1)
+      return false;
+    out[axis] = std::max(x_dim, y_dim);
+  }
+  return true;
+}
+
+std::vector<uint32_t> broadcast_offsets(const Shape &shape, const Shape &out)
+{
+  assert(shape.size() <= out.size());
+
+  const auto pad = out.size() - shape.size();
+  std::vector<uint32_t> strides(out.size(), 0);
+  uint32_t stride = 1;
+  for (uint32_t axis = shape.size(); axis-- > 0;)
+  {
+    strides[pad + axis] = (shape[axis] == 1) ? 0 : stride;
+    stride *= shape[axis];
+  }
+
+  return source_offsets(out, strides);
+}
+
+bool is_activation_supported(luci::FusedActFunc act, loco::DataType dtype)
+{
+  if (act == luci::FusedActFunc::NONE)
+    return true;
+  if (dtype != loco::DataType::FLOAT32)
+    return false;
+  return act == luci::FusedActFunc::RELU || act == luci::FusedActFunc::RELU6 ||
+         act == luci::FusedActFunc::RELU_N1_TO_1;
+}
+
+void apply_activation(luci::FusedActFunc act, luci::CircleConst *node)
+{
+  float lower = 0.0f;
+  float upper = 0.0f;
+  switch (act)
+  {
+    case luci::FusedActFunc::NONE:
+      return;
+    case luci::FusedActFunc::RELU:
+      lower = 0.0f;
+      upper = std::numeric_limits<float>::max();
+      break;
+    case luci::FusedActFunc::RELU6:
+      lower = 0.0f;
+      upper = 6.0f;
+      break;
+    case luci::FusedActFunc::RELU_N1_TO_1:
+      lower = -1.0f;
+      upper = 1.0f;
+      break;
+    default:
+      throw std::runtime_error("FoldConstantsPass: unsupported activation");
+  }
+
+  assert(node->dtype() == loco::DataType::FLOAT32);
+  auto data = typed_data<float>(node);
+  const auto count = node->size<loco::DataType::FLOAT32>();
+  for (uint32_t n = 0; n < count; ++n)
+    data[n] = std::min(std::max(data[n], lower), upper);
+}
+
+enum class BinaryOp
+{
+  ADD,
+  SUB,
+  MUL,
+  DIV,
+  MAXIMUM,
+  MINIMUM,
+};
+
+template <typename T> T compute(BinaryOp op, T x, T y)
+{
+  switch (op)
+  {
+    case BinaryOp::ADD:
+      return x + y;
+    case BinaryOp::SUB:
+      return x - y;
+    case BinaryOp::MUL:
+      return x * y;
+    case BinaryOp::DIV:
+      return x / y;
+    case BinaryOp::MAXIMUM:
+      return std::max(x, y);
+    case BinaryOp::MINIMUM:
+      return std::min(x, y);
+  }
+  throw std::runtime_error("FoldConstantsPass: unsupported binary operation");
+}
+
+template <typename T> bool has_zero(const luci::CircleConst *node)
+{
+  const auto data = typed_data<T>(node);
+  const auto count = num_elements(shape_of(node));
+  return std::find(data, data + count, T{0}) != data + count;
+}
+
+template <typename T>
+void compute_binary(BinaryOp op, const luci::CircleConst *x, const luci::CircleConst *y,
+                    luci::CircleConst *out)
+{
+  const auto out_shape = shape_of(out);
+  const auto x_offsets = broadcast_offsets(shape_of(x), out_shape);
+  const auto y_offsets = broadcast_offsets(shape_of(y), out_shape);
+
+  const auto x_data = typed_data<T>(x);
+  const auto y_data = typed_data<T>(y);
+  auto out_data = typed_data<T>(out);
+  for (uint32_t n = 0; n < x_offsets.size(); ++n)
+    out_data[n] = compute<T>(op, x_data[x_offsets[n]], y_data[y_offsets[n]]);
+}
+
+luci::CircleConst *fold_binary(luci::CircleNode *node, loco::Node *x_node, loco::Node *y_node,
+                               BinaryOp op, luci::FusedActFunc act)
+{
+  auto x = as_const(x_node);
+  auto y = as_const(y_node);
+  if (x == nullptr || y == nullptr)
+    return nullptr;
+
+  const auto dtype = x->dtype();
+  if (y->dtype() != dtype)
+    return nullptr;
+  if (dtype != loco::DataType::FLOAT32 && dtype != loco::DataType::S32 &&
+      dtype != loco::DataType::S64)
+    return nullptr;
+  if (is_quantized(x) || is_quantized(y) || is_quantized(node))
+    return nullptr;
+  if (!is_activation_supported(act, dtype))
+    return nullptr;
+
+  const auto x_shape = shape_of(x);
+  const auto y_shape = shape_of(y);
+  Shape out_shape;
+  if (!broadcast_shape(x_shape, y_shape, out_shape))
+    return nullptr;
+
+  // Do not let folding grow the model through broadcasting
+  if (num_elements(out_shape) > num_elements(x_shape) + num_elements(y_shape))
+    return nullptr;
+
+  if (op == BinaryOp::DIV)
+  {
+    if (dtype == loco::DataType::S32 && has_zero<int32_t>(y))
+      return nullptr;
+    if (dtype == loco::DataType::S64 && has_zero<int64_t>(y))
+      return nullptr;
+  }
+
+  auto folded = create_const(node, dtype, out_shape);
+  switch (dtype)
+  {
+    case loco::DataType::FLOAT32:
+      compute_binary<float>(op, x, y, folded);
+      break;
+    case loco::DataType::S32:
+      compute_binary<int32_t>(op, x, y, folded);
+      break;
+    case loco::DataType::S64:
+      compute_binary<int64_t>(op, x, y, folded);
+      break;
+    default:
+      assert(false);
+  }
+  apply_activation(act, folded);
+
+  return folded;
+}
+
+enum class UnaryOp
+{
+  NEG,
+  SQRT,
+  RSQRT,
+};
+
+luci::CircleConst *fold_unary(luci::CircleNode *node, loco::Node *x_node, UnaryOp op)
+{
+  auto x = as_const(x_node);
+  if (x == nullptr || is_quantized(x) || is_quantized(node))
+    return nullptr;
+
+  const auto dtype = x->dtype();
+  const auto shape = shape_of(x);
+  const auto count = num_elements(shape);
+
+  if (dtype == loco::DataType::FLOAT32)
+  {
+    auto folded = create_const(node, dtype, shape);
+    const auto in = typed_data<float>(x);
+    auto out = typed_data<float>(folded);
+    for (uint32_t n = 0; n < count; ++n)
+    {
+      switch (op)
+      {
+        case UnaryOp::NEG:
+          out[n] = -in[n];
+          break;
+        case UnaryOp::SQRT:
+          out[n] = std::sqrt(in[n]);
+          break;
+        case UnaryOp::RSQRT:
+          out[n] = 1.0f / std::sqrt(in[n]);
+          break;
+      }
+    }
+    return folded;
+  }
+
+  if (op == UnaryOp::NEG && dtype == loco::DataType::S32)
+  {
+    auto folded = create_const(node, dtype, shape);
+    const auto in = typed_data<int32_t>(x);
+    auto out = typed_data<int32_t>(folded);
+    for (uint32_t n = 0; n < count; ++n)
+      out[n] = -in[n];
+    return folded;
+  }
+
+  if (op == UnaryOp::NEG && dtype == loco::DataType::S64)
+  {
+    auto folded = create_const(node, dtype, shape);
+    const auto in = typed_data<int64_t>(x);
+    auto out = typed_data<int64_t>(folded);
+    for (uint32_t n = 0; n < count; ++n)
+      out[n] = -in[n];
+    return folded;
+  }
+
+  return nullptr;
+}
+
+template <typename T> T read_as(const luci::CircleConst *node, uint32_t n)
+{
+  switch (node->dtype())
+  {
+    case loco::DataType::S64:
+      return static_cast<T>(node->at<loco::DataType::S64>(n));
+    case loco::DataType::S32:
+      return static_cast<T>(node->at<loco::DataType::S32>(n));
+    case loco::DataType::FLOAT32:
+      return static_cast<T>(node->at<loco::DataType::FLOAT32>(n));
+    case loco::DataType::U8:
+      return static_cast<T>(node->at<loco::DataType::U8>(n));
+    case loco::DataType::BOOL:
+      return static_cast<T>(node->at<loco::DataType::BOOL>(n));
+    default:
+      throw std::runtime_error("FoldConstantsPass: unsupported data type");
+  }
+}
+
+luci::CircleConst *fold_cast(luci::CircleCast *node)
+{
+  auto x = as_const(node->x());
+  if (x == nullptr || is_quantized(x) || is_quantized(node))
+    return nullptr;
+
+  const auto out_dtype = node->out_data_type();
+  if (!is_foldable_type(out_dtype))
+    return nullptr;
+
+  const auto shape = shape_of(x);
+  const auto count = num_elements(shape);
+  auto folded = create_const(node, out_dtype, shape);
+
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    switch (out_dtype)
+    {
+      case loco::DataType::S64:
+        folded->at<loco::DataType::S64>(n) = read_as<int64_t>(x, n);
+        break;
+      case loco::DataType::S32:
+        folded->at<loco::DataType::S32>(n) = read_as<int32_t>(x, n);
+        break;
+      case loco::DataType::FLOAT32:
+        folded->at<loco::DataType::FLOAT32>(n) = read_as<float>(x, n);
+        break;
+      case loco::DataType::U8:
+        folded->at<loco::DataType::U8>(n) = static_cast<uint8_t>(read_as<int64_t>(x, n));
+        break;
+      case loco::DataType::BOOL:
+        folded->at<loco::DataType::BOOL>(n) = read_as<double>(x, n) != 0.0 ? 1 : 0;
+        break;
+      default:
+        assert(false);
+    }
+  }
+
+  return folded;
+}
+
+/**
+ * @brief Read a rank-1 integer constant (permutation, axis, shape) into 'values'
+ */
+bool read_indices(loco::Node *node, std::vector<int64_t> &values)
+{
+  auto const_node = as_const(node);
+  if (const_node == nullptr || const_node->rank() > 1)
+    return false;
+
+  const auto count = num_elements(shape_of(const_node));
+  values.resize(count);
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    if (const_node->dtype() == loco::DataType::S32)
+      values[n] = const_node->at<loco::DataType::S32>(n);
+    else if (const_node->dtype() == loco::DataType::S64)
+      values[n] = const_node->at<loco::DataType::S64>(n);
+    else
+      return false;
+  }
+  return true;
+}
+
+void copy_elements(const luci::CircleConst *src, luci::CircleConst *dst,
+                   const std::vector<uint32_t> &offsets)
+{
+  const auto elem_size = loco::size(src->dtype());
+  const auto src_data = raw_data(src);
+  auto dst_data = raw_data(dst);
+  for (uint32_t n = 0; n < offsets.size(); ++n)
+    std::memcpy(dst_data + n * elem_size, src_data + offsets[n] * elem_size, elem_size);
+}
+
+luci::CircleConst *fold_transpose(luci::CircleTranspose *node)
+{
+  auto a = as_const(node->a());
+  if (a == nullptr)
+    return nullptr;
+
+  std::vector<int64_t> perm;
+  if (!read_indices(node->perm(), perm))
+    return nullptr;
+
+  const auto in_shape = shape_of(a);
+  const uint32_t rank = in_shape.size();
+  if (perm.size() != rank)
+    return nullptr;
+
+  std::vector<uint32_t> in_strides(rank, 1);
+  for (uint32_t axis = rank; axis-- > 1;)
+    in_strides[axis - 1] = in_strides[axis] * in_shape[axis];
+
+  std::vector<bool> used(rank, false);
+  Shape out_shape(rank);
+  std::vector<uint32_t> strides(rank);
+  for (uint32_t axis = 0; axis < rank; ++axis)
+  {
+    const auto p = perm[axis];
+    if (p < 0 || p >= static_cast<int64_t>(rank) || used[p])
+      return nullptr;
+    used[p] = true;
+    out_shape[axis] = in_shape[p];
+    strides[axis] = in_strides[p];
+  }
+
+  auto folded = create_const(node, a->dtype(), out_shape);
+  copy_elements(a, folded, source_offsets(out_shape, strides));
+  return folded;
+}
+
+/**
+ * @brief Fold an operation that only changes the shape of its input
+ */
+luci::CircleConst *fold_reshape_like(luci::CircleNode *node, luci::CircleConst *input,
+                                     const Shape &out_shape)
+{
+  const auto count = num_elements(shape_of(input));
+  if (num_elements(out_shape) != count)
+    return nullptr;
+
+  auto folded = create_const(node, input->dtype(), out_shape);
+  std::memcpy(raw_data(folded), raw_data(input), count * loco::size(input->dtype()));
+  return folded;
+}
+
+luci::CircleConst *fold_reshape(luci::CircleReshape *node)
+{
+  auto tensor = as_const(node->tensor());
+  if (tensor == nullptr)
+    return nullptr;
+
+  Shape out_shape;
+  if (recorded_shape(node, out_shape))
+    return fold_reshape_like(node, tensor, out_shape);
+
+  // Resolve target shape from 'shape' input or option, which may have one -1
+  std::vector<int64_t> target;
+  if (!read_indices(node->shape(), target))
+  {
+    target.resize(node->newShape()->rank());
+    for (uint32_t axis = 0; axis < target.size(); ++axis)
+      target[axis] = node->newShape()->dim(axis);
+  }
+
+  const auto count = num_elements(shape_of(tensor));
+  uint32_t known = 1;
+  int32_t unknown_axis = -1;
+  out_shape.resize(target.size());
+  for (uint32_t axis = 0; axis < target.size(); ++axis)
+  {
+    if (target[axis] == -1)
+    {
+      if (unknown_axis != -1)
+        return nullptr;
+      unknown_axis = axis;
+      continue;
+    }
+    if (target[axis] < 0)
+      return nullptr;
+    out_shape[axis] = static_cast<uint32_t>(target[axis]);
+    known *= out_shape[axis];
+  }
+  if (unknown_axis != -1)
+  {
+    if (known == 0 || count % known != 0)
+      return nullptr;
+    out_shape[unknown_axis] = count / known;
+  }
+
+  return fold_reshape_like(node, tensor, out_shape);
+}
+
+/**
+ * @brief Concatenate 'inputs' along 'axis'. Every input must have 'out' rank.
+ */
+luci::CircleConst *concat(luci::CircleNode *node, const std::vector<luci::CircleConst *> &inputs,
+                          const std::vector<Shape> &shapes, uint32_t axis)
+{
+  assert(!inputs.empty() && inputs.size() == shapes.size());
+
+  const auto dtype = inputs.front()->dtype();
+  Shape out_shape = shapes.front();
+  out_shape[axis] = 0;
+  for (uint32_t i = 0; i < inputs.size(); ++i)
+  {
+    if (inputs[i]->dtype() != dtype || shapes[i].size() != out_shape.size())
+      return nullptr;
+    for (uint32_t d = 0; d < out_shape.size(); ++d)
+    {
+      if (d != axis && shapes[i][d] != out_shape[d])
+        return nullptr;
+    }
+    out_shape[axis] += shapes[i][axis];
+  }
+
+  uint32_t outer = 1;
+  for (uint32_t d = 0; d < axis; ++d)
+    outer *= out_shape[d];
+
+  const auto elem_size = loco::size(dtype);
+  auto folded = create_const(node, dtype, out_shape);
+  auto dst = raw_data(folded);
+  for (uint32_t o = 0; o < outer; ++o)
+  {
+    for (uint32_t i = 0; i < inputs.size(); ++i)
+    {
+      const auto chunk = num_elements(shapes[i]) / outer * elem_size;
+      std::memcpy(dst, raw_data(inputs[i]) + o * chunk, chunk);
+      dst += chunk;
+    }
+  }
+
+  return folded;
+}
+
+luci::CircleConst *fold_concatenation(luci::CircleConcatenation *node)
+{
+  std::vector<luci::CircleConst *> inputs;
+  std::vector<Shape> shapes;
+  for (uint32_t i = 0; i < node->numValues(); ++i)
+  {
+    auto input = as_const(node->values(i));
+    if (input == nullptr || is_quantized(input))
+      return nullptr;
+    inputs.push_back(input);
+    shapes.push_back(shape_of(input));
+  }
+
+  const int32_t rank = shapes.front().size();
+  const int32_t axis = node->axis() < 0 ? node->axis() + rank : node->axis();
+  if (axis < 0 || axis >= rank)
+    return nullptr;
+
+  const auto act = node->fusedActivationFunction();
+  if (!is_activation_supported(act, inputs.front()->dtype()))
+    return nullptr;
+
+  auto folded = concat(node, inputs, shapes, axis);
+  if (folded != nullptr)
+    apply_activation(act, folded);
+  return folded;
+}
+
+luci::CircleConst *fold_pack(luci::CirclePack *node)
+{
+  std::vector<luci::CircleConst *> inputs;
+  std::vector<Shape> shapes;
+  for (uint32_t i = 0; i < node->values_count(); ++i)
+  {
+    auto input = as_const(node->values(i));
+    if (input == nullptr || is_quantized(input))
+      return nullptr;
+    inputs.push_back(input);
+    shapes.push_back(shape_of(input));
+  }
+
+  const int32_t rank = shapes.front().size() + 1;
+  const int32_t axis = node->axis() < 0 ? node->axis() + rank : node->axis();
+  if (axis < 0 || axis >= rank)
+    return nullptr;
+
+  // Packing is concatenation of inputs having a new unit axis
+  for (auto &shape : shapes)
+    shape.insert(shape.begin() + axis, 1);
+
+  return concat(node, inputs, shapes, axis);
+}
+
+class ConstantFolder final : public luci::CircleNodeMutableVisitor<luci::CircleConst *>
+{
+public:
+  luci::CircleConst *visit(luci::CircleNode *) final { return nullptr; }
+
+  luci::CircleConst *visit(luci::CircleAdd *node) final
+  {
+    return fold_binary(node, node->x(), node->y(), BinaryOp::ADD, node->fusedActivationFunction());
+  }
+
+  luci::CircleConst *visit(luci::CircleSub *node) final
+  {
+    return fold_binary(node, node->x(), node->y(), BinaryOp::SUB, node->fusedActivationFunction());
+  }
+
+  luci::CircleConst *visit(luci::CircleMul *node) final
+  {
+    return fold_binary(node, node->x(), node->y(), BinaryOp::MUL, node->fusedActivationFunction());
+  }
+
+  luci::CircleConst *visit(luci::CircleDiv *node) final
+  {
+    return fold_binary(node, node->x(), node->y(), BinaryOp::DIV, node->fusedActivationFunction());
+  }
+
+  luci::CircleConst *visit(luci::CircleMaximum *node) final
+  {
+    return fold_binary(node, node->x(), node->y(), BinaryOp::MAXIMUM, luci::FusedActFunc::NONE);
+  }
+
+  luci::CircleConst *visit(luci::CircleMinimum *node) final
+  {
+    return fold_binary(node, node->x(), node->y(), BinaryOp::MINIMUM, luci::FusedActFunc::NONE);
+  }
+
+  luci::CircleConst *visit(luci::CircleNeg *node) final
+  {
+    return fold_unary(node, node->x(), UnaryOp::NEG);
+  }
+
+  luci::CircleConst *visit(luci::CircleSqrt *node) final
+  {
+    return fold_unary(node, node->x(), UnaryOp::SQRT);
+  }
+
+  luci::CircleConst *visit(luci::CircleRsqrt *node) final
+  {
+    return fold_unary(node, node->x(), UnaryOp::RSQRT);
+  }
+
+  luci::CircleConst *visit(luci::CircleCast *node) final { return fold_cast(node); }
+
+  luci::CircleConst *visit(luci::CircleTranspose *node) final { return fold_transpose(node); }
+
+  luci::CircleConst *visit(luci::CircleReshape *node) final { return fold_reshape(node); }
+
+  luci::CircleConst *visit(luci::CircleSqueeze *node) final
+  {
+    auto input = as_const(node->input());
+    Shape out_shape;
+    if (input == nullptr || !recorded_shape(node, out_shape))
+      return nullptr;
+    return fold_reshape_like(node, input, out_shape);
+  }
+
+  luci::CircleConst *visit(luci::CircleExpandDims *node) final
+  {
+    auto input = as_const(node->input());
+    Shape out_shape;
+    if (input == nullptr || !recorded_shape(node, out_shape))
+      return nullptr;
+    return fold_reshape_like(node, input, out_shape);
+  }
+
+  luci::CircleConst *visit(luci::CircleConcatenation *node) final
+  {
+    return fold_concatenation(node);
+  }
+
+  luci::CircleConst *visit(luci::CirclePack *node) final { return fold_pack(node); }
+};
+
+} // namespace
+
+namespace luci
+{
+
+bool FoldConstantsPass::run(loco::Graph *g)
+{
+  LOGGER(l);
+
+  bool changed = false;
+  ConstantFolder folder;
+
+  // Post-order lets a chain of constant operations fold in a single run
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto circle_node = dynamic_cast<luci::CircleNode *>(node);
+    if (circle_node == nullptr || dynamic_cast<luci::CircleConst *>(node) != nullptr)
+      continue;
+
+    auto folded = circle_node->accept(&folder);
+    if (folded == nullptr)
+      continue;
+
+    INFO(l) << "FoldConstantsPass: fold " << circle_node->name() << std::endl;
+    loco::replace(circle_node).with(folded);
+    changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
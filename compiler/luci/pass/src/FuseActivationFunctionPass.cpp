@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseActivationFunctionPass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+namespace
+{
+
+bool is_quantized(const luci::CircleNode *node)
+{
+  auto qparam = node->quantparam();
+  return qparam != nullptr && !qparam->scale.empty();
+}
+
+template <class PRED>
+bool fuse_activation(PRED *pred, luci::CircleNode *activation, luci::FusedActFunc act)
+{
+  if (pred->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+  // Other users of 'pred' still need the value before activation
+  if (loco::succs(pred).size() != 1)
+    return false;
+  if (is_quantized(pred) || is_quantized(activation))
+    return false;
+  // Fused activation of integer Add, Sub, Mul and Div is not supported by kernels
+  if (pred->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  pred->fusedActivationFunction(act);
+  loco::replace(activation).with(pred);
+  return true;
+}
+
+/**
+ * @brief Fuse 'activation' into 'pred' if 'pred' supports fused activation function
+ */
+bool fuse_activation(loco::Node *pred, luci::CircleNode *activation, luci::FusedActFunc act)
+{
+  if (auto conv = dynamic_cast<luci::CircleConv2D *>(pred))
+    return fuse_activation(conv, activation, act);
+  if (auto dw_conv = dynamic_cast<luci::CircleDepthwiseConv2D *>(pred))
+    return fuse_activation(dw_conv, activation, act);
+  if (auto fc = dynamic_cast<luci::CircleFullyConnected *>(pred))
+    return fuse_activation(fc, activation, act);
+  if (auto add = dynamic_cast<luci::CircleAdd *>(pred))
+    return fuse_activation(add, activation, act);
+  if (auto sub = dynamic_cast<luci::CircleSub *>(pred))
+    return fuse_activation(sub, activation, act);
+  if (auto mul = dynamic_cast<luci::CircleMul *>(pred))
+    return fuse_activation(mul, activation, act);
+  if (auto div = dynamic_cast<luci::CircleDiv *>(pred))
+    return fuse_activation(div, activation, act);
+  return false;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseActivationFunctionPass::run(loco::Graph *g)
+{
+  LOGGER(l);
+
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    bool fused = false;
+    if (auto relu = dynamic_cast<luci::CircleRelu *>(node))
+      fused = fuse_activation(relu->features(), relu, luci::FusedActFunc::RELU);
+    else if (auto relu6 = dynamic_cast<luci::CircleRelu6 *>(node))
+      fused = fuse_activation(relu6->features(), relu6, luci::FusedActFunc::RELU6);
+    else if (auto relu_n1_to_1 = dynamic_cast<luci::CircleReluN1To1 *>(node))
+      fused = fuse_activation(relu_n1_to_1->features(), relu_n1_to_1,
+                              luci::FusedActFunc::RELU_N1_TO_1);
+
+    if (fused)
+    {
+      INFO(l) << "FuseActivationFunctionPass: fuse "
+              << loco::must_cast<luci::CircleNode *>(node)->name() << std::endl;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseScaleShiftPass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <cassert>
+#include <vector>
+
+namespace
+{
+
+enum class ScaleShift
+{
+  SCALE,          // Mul
+  SHIFT,          // Add
+  NEGATIVE_SHIFT, // Sub
+};
+
+bool is_quantized(const luci::CircleNode *node)
+{
+  auto qparam = node->quantparam();
+  return qparam != nullptr && !qparam->scale.empty();
+}
+
+luci::CircleConst *as_float_const(loco::Node *node)
+{
+  auto const_node = dynamic_cast<luci::CircleConst *>(node);
+  if (const_node == nullptr || const_node->dtype() != loco::DataType::FLOAT32)
+    return nullptr;
+  if (is_quantized(const_node))
+    return nullptr;
+  return const_node;
+}
+
+uint32_t num_elements(const luci::CircleConst *node)
+{
+  uint32_t count = 1;
+  for (uint32_t axis = 0; axis < node->rank(); ++axis)
+    count *= node->dim(axis).value();
+  return count;
+}
+
+// Weights layout and accessors of each layer that can absorb scale and shift
+loco::Node *weights(const luci::CircleConv2D *node) { return node->filter(); }
+loco::Node *weights(const luci::CircleDepthwiseConv2D *node) { return node->filter(); }
+loco::Node *weights(const luci::CircleFullyConnected *node) { return node->weights(); }
+
+void weights(luci::CircleConv2D *node, loco::Node *w) { node->filter(w); }
+void weights(luci::CircleDepthwiseConv2D *node, loco::Node *w) { node->filter(w); }
+void weights(luci::CircleFullyConnected *node, loco::Node *w) { node->weights(w); }
+
+// Conv2D filter is OHWI, DepthwiseConv2D filter is 1HWO and FullyConnected weights is OI
+uint32_t channel_axis(const luci::CircleConv2D *) { return 0; }
+uint32_t channel_axis(const luci::CircleDepthwiseConv2D *) { return 3; }
+uint32_t channel_axis(const luci::CircleFullyConnected *) { return 0; }
+
+/**
+ * @brief Read 'channels' parameters from 'node' if it only broadcasts along the last axis
+ *        of output whose rank is 'output_rank'
+ */
+bool read_channel_params(loco::Node *node, uint32_t channels, uint32_t output_rank,
+                         std::vector<float> &params)
+{
+  auto const_node = as_float_const(node);
+  if (const_node == nullptr || const_node->rank() > output_rank)
+    return false;
+
+  const auto rank = const_node->rank();
+  for (uint32_t axis = 0; axis + 1 < rank; ++axis)
+  {
+    if (const_node->dim(axis).value() != 1)
+      return false;
+  }
+
+  const auto count = num_elements(const_node);
+  if (count != 1 && count != channels)
+    return false;
+
+  params.resize(channels);
+  for (uint32_t c = 0; c < channels; ++c)
+    params[c] = const_node->at<loco::DataType::FLOAT32>(count == 1 ? 0 : c);
+  return true;
+}
+
+luci::CircleConst *clone_shape(loco::Graph *g, const luci::CircleConst *origin)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(origin->rank());
+  for (uint32_t axis = 0; axis < origin->rank(); ++axis)
+    node->dim(axis) = origin->dim(axis);
+  node->shape_status(luci::ShapeStatus::VALID);
+  node->name(origin->name());
+  node->size<loco::DataType::FLOAT32>(num_elements(origin));
+  return node;
+}
+
+/**
+ * @brief Fold 'op' which applies 'param' to the output of 'layer' into 'layer'
+ *
+ * @note  Weights and bias are cloned as they may be shared with other layers
+ */
+template <class LAYER>
+bool fuse(LAYER *layer, luci::CircleNode *op, luci::FusedActFunc op_act, loco::Node *param,
+          ScaleShift kind)
+{
+  if (layer->fusedActivationFunction() != luci::FusedActFunc::NONE)
+    return false;
+  if (loco::succs(layer).size() != 1)
+    return false;
+  if (is_quantized(layer) || is_quantized(op))
+    return false;
+  if (layer->shape_status() != luci::ShapeStatus::VALID)
+    return false;
+
+  luci::CircleConst *w = as_float_const(weights(layer));
+  if (w == nullptr || w->rank() <= channel_axis(layer))
+    return false;
+  const auto channels = w->dim(channel_axis(layer)).value();
+
+  luci::CircleConst *b = as_float_const(layer->bias());
+  if (b == nullptr)
+  {
+    // Layer without bias has CircleOutputExclude
+    if (dynamic_cast<luci::CircleOutputExclude *>(layer->bias()) == nullptr)
+      return false;
+  }
+  else if (num_elements(b) != channels)
+    return false;
+
+  std::vector<float> params;
+  if (!read_channel_params(param, channels, layer->rank(), params))
+    return false;
+
+  loco::Graph *graph = layer->graph();
+
+  auto new_bias = graph->nodes()->create<luci::CircleConst>();
+  new_bias->dtype(loco::DataType::FLOAT32);
+  new_bias->rank(1);
+  new_bias->dim(0) = channels;
+  new_bias->shape_status(luci::ShapeStatus::VALID);
+  new_bias->name(b != nullptr ? b->name() : layer->name() + "_bias");
+  new_bias->size<loco::DataType::FLOAT32>(channels);
+  for (uint32_t c = 0; c < channels; ++c)
+    new_bias->at<loco::DataType::FLOAT32>(c) = b ? b->at<loco::DataType::FLOAT32>(c) : 0.0f;
+
+  switch (kind)
+  {
+    case ScaleShift::SCALE:
+    {
+      uint32_t stride = 1;
+      for (uint32_t axis = channel_axis(layer) + 1; axis < w->rank(); ++axis)
+        stride *= w->dim(axis).value();
+
+      luci::CircleConst *new_weights = clone_shape(graph, w);
+      const auto count = num_elements(w);
+      for (uint32_t n = 0; n < count; ++n)
+      {
+        const auto c = (n / stride) % channels;
+        new_weights->at<loco::DataType::FLOAT32>(n) =
+            w->at<loco::DataType::FLOAT32>(n) * params[c];
+      }
+      for (uint32_t c = 0; c < channels; ++c)
+        new_bias->at<loco::DataType::FLOAT32>(c) *= params[c];
+
+      weights(layer, new_weights);
+      break;
+    }
+    case ScaleShift::SHIFT:
+      for (uint32_t c = 0; c < channels; ++c)
+        new_bias->at<loco::DataType::FLOAT32>(c) += params[c];
+      break;
+    case ScaleShift::NEGATIVE_SHIFT:
+      for (uint32_t c = 0; c < channels; ++c)
+        new_bias->at<loco::DataType::FLOAT32>(c) -= params[c];
+      break;
+  }
+
+  layer->bias(new_bias);
+  layer->fusedActivationFunction(op_act);
+  loco::replace(op).with(layer);
+
+  return true;
+}
+
+bool fuse(loco::Node *layer, luci::CircleNode *op, luci::FusedActFunc op_act, loco::Node *param,
+          ScaleShift kind)
+{
+  if (auto conv = dynamic_cast<luci::CircleConv2D *>(layer))
+    return fuse(conv, op, op_act, param, kind);
+  if (auto dw_conv = dynamic_cast<luci::CircleDepthwiseConv2D *>(layer))
+    return fuse(dw_conv, op, op_act, param, kind);
+  if (auto fc = dynamic_cast<luci::CircleFullyConnected *>(layer))
+    return fuse(fc, op, op_act, param, kind);
+  return false;
+}
+
+/**
+ * @brief Fold commutative 'op' regardless of the side 'layer' comes from
+ */
+template <class OP> bool fuse_commutative(OP *op, ScaleShift kind)
+{
+  const auto act = op->fusedActivationFunction();
+  if (fuse(op->x(), op, act, op->y(), kind))
+    return true;
+  return fuse(op->y(), op, act, op->x(), kind);
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseScaleShiftPass::run(loco::Graph *g)
+{
+  LOGGER(l);
+
+  bool changed = false;
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    bool fused = false;
+    if (auto mul = dynamic_cast<luci::CircleMul *>(node))
+      fused = fuse_commutative(mul, ScaleShift::SCALE);
+    else if (auto add = dynamic_cast<luci::CircleAdd *>(node))
+      fused = fuse_commutative(add, ScaleShift::SHIFT);
+    else if (auto sub = dynamic_cast<luci::CircleSub *>(node))
+      fused = fuse(sub->x(), sub, sub->fusedActivationFunction(), sub->y(),
+                   ScaleShift::NEGATIVE_SHIFT);
+
+    if (fused)
+    {
+      INFO(l) << "FuseScaleShiftPass: fuse " << loco::must_cast<luci::CircleNode *>(node)->name()
+              << std::endl;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveRedundantReshapePass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+namespace
+{
+
+bool is_static_shape(const luci::CircleNode *node)
+{
+  if (node->shape_status() != luci::ShapeStatus::VALID)
+    return false;
+  for (uint32_t axis = 0; axis < node->rank(); ++axis)
+  {
+    if (!node->dim(axis).known())
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Return true if Reshape output has the same static shape as its input
+ */
+bool is_identity(const luci::CircleReshape *node)
+{
+  auto input = dynamic_cast<luci::CircleNode *>(node->tensor());
+  if (input == nullptr)
+    return false;
+  if (!is_static_shape(input) || !is_static_shape(node))
+    return false;
+  if (input->rank() != node->rank())
+    return false;
+  for (uint32_t axis = 0; axis < node->rank(); ++axis)
+  {
+    if (input->dim(axis).value() != node->dim(axis).value())
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool RemoveRedundantReshapePass::run(loco::Graph *g)
+{
+  LOGGER(l);
+
+  bool changed = false;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto reshape = dynamic_cast<luci::CircleReshape *>(node);
+    if (reshape == nullptr)
+      continue;
+
+    // Reshape output does not depend on the shape of its input; skip previous Reshape
+    // NOTE Output shape of 'reshape' stays the same, so shape annotation is still valid
+    if (auto pred = dynamic_cast<luci::CircleReshape *>(reshape->tensor()))
+    {
+      INFO(l) << "RemoveRedundantReshapePass: merge " << reshape->name() << std::endl;
+      reshape->tensor(pred->tensor());
+      changed = true;
+    }
+
+    if (is_identity(reshape))
+    {
+      INFO(l) << "RemoveRedundantReshapePass: remove " << reshape->name() << std::endl;
+      loco::replace(reshape).with(reshape->tensor());
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/RemoveRedundantTransposePass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <vector>
+
+namespace
+{
+
+bool read_perm(const luci::CircleTranspose *node, std::vector<int32_t> &perm)
+{
+  auto perm_const = dynamic_cast<luci::CircleConst *>(node->perm());
+  if (perm_const == nullptr || perm_const->dtype() != loco::DataType::S32)
+    return false;
+  if (perm_const->rank() != 1)
+    return false;
+
+  perm.resize(perm_const->dim(0).value());
+  for (uint32_t i = 0; i < perm.size(); ++i)
+    perm[i] = perm_const->at<loco::DataType::S32>(i);
+  return true;
+}
+
+bool is_identity(const std::vector<int32_t> &perm)
+{
+  for (uint32_t i = 0; i < perm.size(); ++i)
+  {
+    if (perm[i] != static_cast<int32_t>(i))
+      return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Replace Transpose(Transpose(x, first), second) with Transpose(x, first[second])
+ */
+bool merge(luci::CircleTranspose *node, luci::CircleTranspose *pred)
+{
+  std::vector<int32_t> first;
+  std::vector<int32_t> second;
+  if (!read_perm(pred, first) || !read_perm(node, second))
+    return false;
+  if (first.size() != second.size())
+    return false;
+
+  std::vector<int32_t> merged(second.size());
+  for (uint32_t i = 0; i < second.size(); ++i)
+  {
+    if (second[i] < 0 || second[i] >= static_cast<int32_t>(first.size()))
+      return false;
+    merged[i] = first[second[i]];
+  }
+
+  if (is_identity(merged))
+  {
+    loco::replace(node).with(pred->a());
+    return true;
+  }
+
+  auto graph = node->graph();
+
+  auto perm = graph->nodes()->create<luci::CircleConst>();
+  perm->dtype(loco::DataType::S32);
+  perm->rank(1);
+  perm->dim(0) = merged.size();
+  perm->shape_status(luci::ShapeStatus::VALID);
+  perm->size<loco::DataType::S32>(merged.size());
+  for (uint32_t i = 0; i < merged.size(); ++i)
+    perm->at<loco::DataType::S32>(i) = merged[i];
+
+  auto transpose = graph->nodes()->create<luci::CircleTranspose>();
+  transpose->a(pred->a());
+  transpose->perm(perm);
+  transpose->dtype(node->dtype());
+  transpose->rank(node->rank());
+  for (uint32_t axis = 0; axis < node->rank(); ++axis)
+    transpose->dim(axis) = node->dim(axis);
+  transpose->shape_status(node->shape_status());
+  transpose->name(node->name());
+  if (node->quantparam() != nullptr)
+    transpose->quantparam(std::make_unique<luci::CircleQuantParam>(*node->quantparam()));
+
+  loco::replace(node).with(transpose);
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool RemoveRedundantTransposePass::run(loco::Graph *g)
+{
+  LOGGER(l);
+
+  bool changed = false;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    auto transpose = dynamic_cast<luci::CircleTranspose *>(node);
+    if (transpose == nullptr)
+      continue;
+
+    std::vector<int32_t> perm;
+    if (read_perm(transpose, perm) && is_identity(perm))
+    {
+      INFO(l) << "RemoveRedundantTransposePass: remove " << transpose->name() << std::endl;
+      loco::replace(transpose).with(transpose->a());
+      changed = true;
+      continue;
+    }
+
+    auto pred = dynamic_cast<luci::CircleTranspose *>(transpose->a());
+    if (pred != nullptr && merge(transpose, pred))
+    {
+      INFO(l) << "RemoveRedundantTransposePass: merge " << transpose->name() << std::endl;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
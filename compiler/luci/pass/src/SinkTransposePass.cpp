@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/SinkTransposePass.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Log.h>
+
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+bool read_perm(const luci::CircleTranspose *node, std::vector<int32_t> &perm)
+{
+  auto perm_const = dynamic_cast<luci::CircleConst *>(node->perm());
+  if (perm_const == nullptr || perm_const->dtype() != loco::DataType::S32)
+    return false;
+  if (perm_const->rank() != 1)
+    return false;
+
+  perm.resize(perm_const->dim(0).value());
+  std::vector<bool> used(perm.size(), false);
+  for (uint32_t i = 0; i < perm.size(); ++i)
+  {
+    perm[i] = perm_const->at<loco::DataType::S32>(i);
+    if (perm[i] < 0 || perm[i] >= static_cast<int32_t>(perm.size()) || used[perm[i]])
+      return false;
+    used[perm[i]] = true;
+  }
+  return true;
+}
+
+/**
+ * @brief Return 'node' as Transpose if only 'user' reads it
+ * @note  Transpose with other users should stay where it is not to duplicate the work.
+ *        Transpose of constant is left for FoldConstantsPass.
+ */
+luci::CircleTranspose *single_use_transpose(loco::Node *node, const loco::Node *user)
+{
+  auto transpose = dynamic_cast<luci::CircleTranspose *>(node);
+  if (transpose == nullptr)
+    return nullptr;
+  if (dynamic_cast<luci::CircleConst *>(transpose->a()) != nullptr)
+    return nullptr;
+
+  auto succs = loco::succs(transpose);
+  if (succs.size() != 1 || *succs.begin() != user)
+    return nullptr;
+  return transpose;
+}
+
+bool has_static_shape(const luci::CircleNode *node, uint32_t rank)
+{
+  if (node->shape_status() != luci::ShapeStatus::VALID || node->rank() != rank)
+    return false;
+  for (uint32_t axis = 0; axis < rank; ++axis)
+  {
+    if (!node->dim(axis).known())
+      return false;
+  }
+  return true;
+}
+
+void copy_quantparam(const luci::CircleNode *from, luci::CircleNode *to)
+{
+  if (from->quantparam() != nullptr)
+    to->quantparam(std::make_unique<luci::CircleQuantParam>(*from->quantparam()));
+}
+
+/**
+ * @brief Give 'sunk' the shape of 'origin' before it is transposed by 'perm'
+ */
+void set_untransposed_shape(const luci::CircleNode *origin, const std::vector<int32_t> &perm,
+                            luci::CircleNode *sunk)
+{
+  sunk->dtype(origin->dtype());
+  sunk->rank(origin->rank());
+  for (uint32_t axis = 0; axis < perm.size(); ++axis)
+    sunk->dim(perm[axis]) = origin->dim(axis);
+  sunk->shape_status(luci::ShapeStatus::VALID);
+  sunk->name(origin->name() + "_untransposed");
+  copy_quantparam(origin, sunk);
+}
+
+/**
+ * @brief Replace 'origin' with Transpose of 'sunk' by 'perm'
+ */
+void transpose_after(luci::CircleNode *origin, luci::CircleNode *sunk, loco::Node *perm)
+{
+  auto transpose = origin->graph()->nodes()->create<luci::CircleTranspose>();
+  transpose->a(sunk);
+  transpose->perm(perm);
+  transpose->dtype(origin->dtype());
+  transpose->rank(origin->rank());
+  for (uint32_t axis = 0; axis < origin->rank(); ++axis)
+    transpose->dim(axis) = origin->dim(axis);
+  transpose->shape_status(luci::ShapeStatus::VALID);
+  transpose->name(origin->name());
+  copy_quantparam(origin, transpose);
+
+  loco::replace(origin).with(transpose);
+}
+
+// Input accessor of unary elementwise operations
+template <class UNARY> loco::Node *input_of(const UNARY *node) { return node->x(); }
+template <class UNARY> void input_of(UNARY *node, loco::Node *input) { node->x(input); }
+
+loco::Node *input_of(const luci::CircleRelu *node) { return node->features(); }
+loco::Node *input_of(const luci::CircleRelu6 *node) { return node->features(); }
+loco::Node *input_of(const luci::CircleReluN1To1 *node) { return node->features(); }
+void input_of(luci::CircleRelu *node, loco::Node *input) { node->features(input); }
+void input_of(luci::CircleRelu6 *node, loco::Node *input) { node->features(input); }
+void input_of(luci::CircleReluN1To1 *node, loco::Node *input) { node->features(input); }
+
+/**
+ * @brief Rewrite UNARY(Transpose(x)) as Transpose(UNARY(x))
+ */
+template <class UNARY> bool sink_unary(UNARY *node)
+{
+  luci::CircleTranspose *transpose = single_use_transpose(input_of(node), node);
+  if (transpose == nullptr)
+    return false;
+
+  std::vector<int32_t> perm;
+  if (!read_perm(transpose, perm) || !has_static_shape(node, perm.size()))
+    return false;
+
+  auto sunk = node->graph()->nodes()->template create<UNARY>();
+  input_of(sunk, transpose->a());
+  set_untransposed_shape(node, perm, sunk);
+
+  transpose_after(node, sunk, transpose->perm());
+  return true;
+}
+
+// Fused activation of binary elementwise operations
+template <class BINARY> void copy_attributes(const BINARY *, BINARY *) {}
+
+template <class BINARY> void copy_fused_act(const BINARY *from, BINARY *to)
+{
+  to->fusedActivationFunction(from->fusedActivationFunction());
+}
+
+void copy_attributes(const luci::CircleAdd *from, luci::CircleAdd *to) { copy_fused_act(from, to); }
+void copy_attributes(const luci::CircleSub *from, luci::CircleSub *to) { copy_fused_act(from, to); }
+void copy_attributes(const luci::CircleMul *from, luci::CircleMul *to) { copy_fused_act(from, to); }
+void copy_attributes(const luci::CircleDiv *from, luci::CircleDiv *to) { copy_fused_act(from, to); }
+
+enum class Operand
+{
+  UNMOVABLE,
+  TRANSPOSED, // Transpose by the same permutation
+  SCALAR,     // Constant having one element, which broadcasts the same in any layout
+  CONSTANT,   // Constant of full rank
+};
+
+Operand classify(loco::Node *operand, const loco::Node *user, const std::vector<int32_t> &perm)
+{
+  if (auto transpose = single_use_transpose(operand, user))
+  {
+    std::vector<int32_t> other;
+    if (read_perm(transpose, other) && other == perm)
+      return Operand::TRANSPOSED;
+    return Operand::UNMOVABLE;
+  }
+
+  auto const_node = dynamic_cast<luci::CircleConst *>(operand);
+  if (const_node == nullptr || !has_static_shape(const_node, const_node->rank()))
+    return Operand::UNMOVABLE;
+
+  uint32_t count = 1;
+  for (uint32_t axis = 0; axis < const_node->rank(); ++axis)
+    count *= const_node->dim(axis).value();
+  if (count == 1 && const_node->rank() <= perm.size())
+    return Operand::SCALAR;
+  if (const_node->rank() == perm.size())
+    return Operand::CONSTANT;
+  return Operand::UNMOVABLE;
+}
+
+/**
+ * @brief Return operand of BINARY to be used under the transpose by 'perm'
+ *
+ * @note  Constant of full rank is transposed back by the inverse of 'perm', which
+ *        FoldConstantsPass can fold afterwards
+ */
+loco::Node *untransposed_operand(loco::Node *operand, Operand kind,
+                                 const std::vector<int32_t> &perm)
+{
+  switch (kind)
+  {
+    case Operand::TRANSPOSED:
+      return loco::must_cast<luci::CircleTranspose *>(operand)->a();
+    case Operand::SCALAR:
+      return operand;
+    case Operand::CONSTANT:
+      break;
+    default:
+      throw std::runtime_error("SinkTransposePass: operand cannot be moved");
+  }
+
+  auto const_node = loco::must_cast<luci::CircleConst *>(operand);
+  auto graph = const_node->graph();
+
+  auto inverse = graph->nodes()->create<luci::CircleConst>();
+  inverse->dtype(loco::DataType::S32);
+  inverse->rank(1);
+  inverse->dim(0) = perm.size();
+  inverse->shape_status(luci::ShapeStatus::VALID);
+  inverse->size<loco::DataType::S32>(perm.size());
+  for (uint32_t i = 0; i < perm.size(); ++i)
+    inverse->at<loco::DataType::S32>(perm[i]) = static_cast<int32_t>(i);
+
+  auto transpose = graph->nodes()->create<luci::CircleTranspose>();
+  transpose->a(const_node);
+  transpose->perm(inverse);
+  set_untransposed_shape(const_node, perm, transpose);
+  return transpose;
+}
+
+/**
+ * @brief Rewrite BINARY(Transpose(x), Transpose(y)) as Transpose(BINARY(x, y))
+ *
+ * @note  One of the operands may be a constant instead of Transpose
+ */
+template <class BINARY> bool sink_binary(BINARY *node)
+{
+  luci::CircleTranspose *transpose = single_use_transpose(node->x(), node);
+  if (transpose == nullptr)
+    transpose = single_use_transpose(node->y(), node);
+  if (transpose == nullptr)
+    return false;
+
+  std::vector<int32_t> perm;
+  if (!read_perm(transpose, perm) || !has_static_shape(node, perm.size()))
+    return false;
+
+  const auto x_kind = classify(node->x(), node, perm);
+  const auto y_kind = classify(node->y(), node, perm);
+  if (x_kind == Operand::UNMOVABLE || y_kind == Operand::UNMOVABLE)
+    return false;
+
+  auto sunk = node->graph()->nodes()->template create<BINARY>();
+  sunk->x(untransposed_operand(node->x(), x_kind, perm));
+  sunk->y(untransposed_operand(node->y(), y_kind, perm));
+  copy_attributes(node, sunk);
+  set_untransposed_shape(node, perm, sunk);
+
+  transpose_after(node, sunk, transpose->perm());
+  return true;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool SinkTransposePass::run(loco::Graph *g)
+{
+  LOGGER(l);
+
+  bool changed = false;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(g)))
+  {
+    bool sunk = false;
+    if (auto relu = dynamic_cast<luci::CircleRelu *>(node))
+      sunk = sink_unary(relu);
+    else if (auto relu6 = dynamic_cast<luci::CircleRelu6 *>(node))
+      sunk = sink_unary(relu6);
+    else if (auto relu_n1_to_1 = dynamic_cast<luci::CircleReluN1To1 *>(node))
+      sunk = sink_unary(relu_n1_to_1);
+    else if (auto tanh = dynamic_cast<luci::CircleTanh *>(node))
+      sunk = sink_unary(tanh);
+    else if (auto logistic = dynamic_cast<luci::CircleLogistic *>(node))
+      sunk = sink_unary(logistic);
+    else if (auto neg = dynamic_cast<luci::CircleNeg *>(node))
+      sunk = sink_unary(neg);
+    else if (auto abs = dynamic_cast<luci::CircleAbs *>(node))
+      sunk = sink_unary(abs);
+    else if (auto exp = dynamic_cast<luci::CircleExp *>(node))
+      sunk = sink_unary(exp);
+    else if (auto sqrt = dynamic_cast<luci::CircleSqrt *>(node))
+      sunk = sink_unary(sqrt);
+    else if (auto rsqrt = dynamic_cast<luci::CircleRsqrt *>(node))
+      sunk = sink_unary(rsqrt);
+    else if (auto add = dynamic_cast<luci::CircleAdd *>(node))
+      sunk = sink_binary(add);
+    else if (auto sub = dynamic_cast<luci::CircleSub *>(node))
+      sunk = sink_binary(sub);
+    else if (auto mul = dynamic_cast<luci::CircleMul *>(node))
+      sunk = sink_binary(mul);
+    else if (auto div = dynamic_cast<luci::CircleDiv *>(node))
+      sunk = sink_binary(div);
+    else if (auto maximum = dynamic_cast<luci::CircleMaximum *>(node))
+      sunk = sink_binary(maximum);
+    else if (auto minimum = dynamic_cast<luci::CircleMinimum *>(node))
+      sunk = sink_binary(minimum);
+
+    if (sunk)
+    {
+      INFO(l) << "SinkTransposePass: sink Transpose below "
+              << loco::must_cast<luci::CircleNode *>(node)->name() << std::endl;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+} // namespace luci
@@ -189,11 +189,16 @@ void CPPCodeGenerator::materializeHeader(ostream &out, const ModelAnalyzer &ma)
   out.write(cpp_header_types, sizeof(cpp_header_types));
   out << "class " << class_name << "\n"
                                    "{\n"
-                                   "public:\n"
-                                   "  "
-      << class_name << "(const std::string& parametersPath);\n"
-                       "  ~"
-      << class_name << "();\n";
+                                   "public:\n";
+  // peak size of arena, intermediate tensors share storage in it
+  out << "  // Number of floats in arena holding intermediate tensors and outputs.\n"
+         "  // Outputs are valid until the next inference.\n"
+         "  static const size_t arenaSize = "
+      << ma.getArenaSize() << ";\n\n";
+  out << "  " << class_name << "(const std::string& parametersPath);\n"
+      << "  // arena must hold arenaSize floats and outlive the model\n"
+      << "  " << class_name << "(const std::string& parametersPath, float* arena);\n"
+      << "  ~" << class_name << "();\n";
   // generate input setters
   if (ma.getInputs().size() == 1)
     out << "  bool setInput(const Tensor& inputs);\n";
@@ -234,6 +239,9 @@ void CPPCodeGenerator::materializeHeader(ostream &out, const ModelAnalyzer &ma)
   // pointer to NN parameters
   out << "  char* _parameters;\n";
   out << "  size_t _paramSize;\n";
+  // storage of tensors
+  out << "  std::unique_ptr<float[]> _ownedArena;\n";
+  out << "  float* _arena;\n";
   out << "};\n";
 }
 
@@ -336,6 +344,20 @@ void CPPCodeGenerator::materializeTranspose(ostream &out, const ModelAnalyzer &m
   assert(false && "not implemented");
 }
 
+/**
+ * @brief Returns expression of pointer to storage of tensor in arena
+ * @param ma Intermediate model representation
+ * @param tensor_id Id of tensor
+ * @return "nullptr" if tensor is not stored in arena
+ */
+static string getArenaPointer(const ModelAnalyzer &ma, size_t tensor_id)
+{
+  const size_t offset = ma.getArenaOffset(tensor_id);
+  if (offset == INVALID_ARENA_OFFSET)
+    return "nullptr";
+  return "_arena + " + to_string(offset);
+}
+
 void CPPCodeGenerator::materializeConstructor(ostream &out, const ModelAnalyzer &ma,
                                               const sir::CreateTmp *constructor)
 {
@@ -344,7 +366,9 @@ void CPPCodeGenerator::materializeConstructor(ostream &out, const ModelAnalyzer
   assert(td.type == sir::TensorDescriptor::Type::temporary);
   (void)td;
   const string &t_name = _formattedTensors[constructor->tensorId];
-  out << "  Tensor " << t_name << ";\n";
+  // Tensors without storage in arena are constants referring to parameters
+  out << "  Tensor " << t_name << "(Shape{}, " << getArenaPointer(ma, constructor->tensorId)
+      << ");\n";
 }
 
 void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &ma,
@@ -361,9 +385,9 @@ void CPPCodeGenerator::materializeDestructor(ostream &out, const ModelAnalyzer &
 void CPPCodeGenerator::materializeInferenceSequence(ostream &out, const ModelAnalyzer &ma)
 {
 
-  // Allocate temporary(im2col) tensor
+  // Temporary(im2col) tensor
   out << "  Tensor " << _formattedTensors[ma.getTempTID()] << "(Shape{" << ma.getMaxTemporarySize()
-      << "});\n";
+      << "}, " << getArenaPointer(ma, ma.getTempTID()) << ");\n";
 
   for (const unique_ptr<Action> &action : ma.getInferenceSequence())
   {
@@ -430,13 +454,27 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   // Below call into operations
   out.write(cpp_leaky_relu, sizeof(cpp_leaky_relu));
 
-  // gen NN constructor
+  // gen NN constructors
+  out << class_name << "::" << class_name << "(const string& parametersPath)\n"
+                                             "    : "
+      << class_name << "(parametersPath, nullptr)\n"
+                       "{\n"
+                       "}\n\n";
   out << class_name << "::" << class_name
-      << "(const string& parametersPath)\n"
+      << "(const string& parametersPath, float* arena)\n"
+         "    : _ownedArena(arena ? nullptr : new float[arenaSize]),\n"
+         "      _arena(arena ? arena : _ownedArena.get())\n"
          "{\n"
          "  readParameters(_parameters, _paramSize, parametersPath, "
-      << s.getFormatVersion() << ", " << s.getModelHash() << ");\n"
-                                                             "}\n\n";
+      << s.getFormatVersion() << ", " << s.getModelHash() << ");\n";
+  // persistent tensors are views of arena created once
+  for (size_t output_tensor_id : ma.getPersistentTensors())
+  {
+    const string &output_tensor_name = _formattedTensors[output_tensor_id];
+    out << "  " << output_tensor_name << " = std::make_shared<Tensor>(Shape{}, "
+        << getArenaPointer(ma, output_tensor_id) << ");\n";
+  }
+  out << "}\n\n";
   // gen NN destructor
   out << class_name << "::~" << class_name << "()\n"
                                               "{\n"
@@ -475,11 +513,6 @@ void CPPCodeGenerator::materializeCode(ostream &out, const ModelAnalyzer &ma, co
   }
   out << "void " << class_name << "::doInference()\n"
                                   "{\n";
-  for (size_t output_tensor_id : ma.getPersistentTensors())
-  {
-    const string &output_tensor_name = _formattedTensors[output_tensor_id];
-    out << "  " << output_tensor_name << ".reset(new Tensor());\n";
-  }
 
   // gen inference sequence
   materializeInferenceSequence(out, ma);
@@ -20,8 +20,10 @@
 #include "mir/Graph.h"
 #include "mir/OpDefs.h"
 
+#include <algorithm>
 #include <stack>
 #include <map>
+#include <stdexcept>
 
 using namespace std;
 
@@ -49,7 +51,7 @@ void ModelAnalyzer::appendOperationToInference(Operation *op, const string &func
   {
     // register constant tensor
     // it's data is deserialized to described tensor by O(1) at runtime
-    const auto tensor_id = declareTemporaryTensor();
+    const auto tensor_id = declareTemporaryTensor(op->getOutputShape(0));
     node_output_tensors.push_back(tensor_id);
   }
   else if (op->getType() == Operation::Type::output)
@@ -61,8 +63,9 @@ void ModelAnalyzer::appendOperationToInference(Operation *op, const string &func
     for (const auto &output : op->getOutputs())
     {
       const auto &tensor_name = output.getName();
-      const auto tensor_id =
-          tensor_name.empty() ? declareTemporaryTensor() : declarePersistentTensor(tensor_name);
+      const auto &shape = output.getShape();
+      const auto tensor_id = tensor_name.empty() ? declareTemporaryTensor(shape)
+                                                 : declarePersistentTensor(tensor_name, shape);
       node_output_tensors.push_back(tensor_id);
     }
   }
@@ -101,19 +104,19 @@ size_t ModelAnalyzer::declareInputTensor(const std::string &name, const mir::Sha
   return id;
 }
 
-size_t ModelAnalyzer::declarePersistentTensor(const std::string &name)
+size_t ModelAnalyzer::declarePersistentTensor(const std::string &name, const mir::Shape &shape)
 {
   assert(!name.empty());
   size_t id = _allocatedTensors++;
-  _tensors.push_back({id, TensorDescriptor::Type::persistent, name, {}});
+  _tensors.push_back({id, TensorDescriptor::Type::persistent, name, shape});
   _persistent_tensors.push_back(id);
   return id;
 }
 
-size_t ModelAnalyzer::declareTemporaryTensor()
+size_t ModelAnalyzer::declareTemporaryTensor(const mir::Shape &shape)
 {
   size_t id = _allocatedTensors++;
-  _tensors.push_back({id, TensorDescriptor::Type::temporary, "", {}});
+  _tensors.push_back({id, TensorDescriptor::Type::temporary, "", shape});
   return id;
 }
 
@@ -218,6 +221,99 @@ void ModelAnalyzer::constructInferenceSequence(const vector<Operation *> &post_o
   }
 }
 
+void ModelAnalyzer::planMemory()
+{
+  // Offsets are aligned to 16 elements (64 bytes) for vectorized kernels
+  const size_t alignment = 16;
+
+  struct Lifetime
+  {
+    size_t id;
+    size_t size;
+    size_t first;
+    size_t last;
+  };
+
+  // Gather lifetime of tensors defined by operations
+  map<size_t, Lifetime> lifetimes;
+  const size_t seq_end = _inferenceSequence.size();
+  for (size_t pos = 0; pos < seq_end; ++pos)
+  {
+    const auto *call = dynamic_cast<const CallFunction *>(_inferenceSequence[pos].get());
+    if (call == nullptr)
+      continue;
+    // Constants refer to model parameters
+    if (call->mirOp->getType() == Operation::Type::constant)
+      continue;
+
+    for (size_t output_tensor_id : call->outputs)
+    {
+      const TensorDescriptor &td = _tensors[output_tensor_id];
+      if (td.type == TensorDescriptor::Type::input)
+        continue;
+      const int32_t num_elements = td.shape.numElements();
+      if (num_elements < 0)
+        throw std::runtime_error("Can not plan memory for tensor of unknown shape");
+      lifetimes[output_tensor_id] = {output_tensor_id, static_cast<size_t>(num_elements), pos, pos};
+    }
+
+    for (size_t input_tensor_id : call->inputs)
+    {
+      if (input_tensor_id == _temp_tensor_id && !lifetimes.count(input_tensor_id))
+        lifetimes[input_tensor_id] = {input_tensor_id, _max_temp_size, pos, pos};
+
+      auto it = lifetimes.find(input_tensor_id);
+      if (it != lifetimes.end())
+        it->second.last = pos;
+    }
+  }
+
+  // Outputs are read after inference
+  for (size_t output_tensor_id : _outputs)
+  {
+    auto it = lifetimes.find(output_tensor_id);
+    if (it != lifetimes.end())
+      it->second.last = seq_end;
+  }
+
+  vector<Lifetime> order;
+  for (const auto &lifetime : lifetimes)
+    order.push_back(lifetime.second);
+  std::stable_sort(order.begin(), order.end(), [](const Lifetime &lhs, const Lifetime &rhs) {
+    return lhs.size > rhs.size || (lhs.size == rhs.size && lhs.first < rhs.first);
+  });
+
+  _arena_offsets.assign(_tensors.size(), INVALID_ARENA_OFFSET);
+  _arena_size = 0;
+  vector<Lifetime> placed;
+  for (const Lifetime &tensor : order)
+  {
+    // Regions of arena occupied by tensors alive at the same time, ordered by offset
+    vector<pair<size_t, size_t>> occupied;
+    for (const Lifetime &other : placed)
+    {
+      if (other.first <= tensor.last && tensor.first <= other.last)
+      {
+        const size_t offset = _arena_offsets[other.id];
+        occupied.emplace_back(offset, offset + other.size);
+      }
+    }
+    std::sort(occupied.begin(), occupied.end());
+
+    size_t offset = 0;
+    for (const auto &region : occupied)
+    {
+      if (offset + tensor.size <= region.first)
+        break;
+      offset = std::max(offset, (region.second + alignment - 1) / alignment * alignment);
+    }
+
+    _arena_offsets[tensor.id] = offset;
+    _arena_size = std::max(_arena_size, offset + tensor.size);
+    placed.push_back(tensor);
+  }
+}
+
 void ModelAnalyzer::collectOutputs(const mir::Graph *g)
 {
   for (ops::OutputOp *out_op : g->getOutputs())
@@ -247,7 +343,7 @@ void ModelAnalyzer::analyze(const mir::Graph *g)
   }
 
   // Register temporary tensor for im2col buffer
-  _temp_tensor_id = declareTemporaryTensor();
+  _temp_tensor_id = declareTemporaryTensor(mir::Shape{});
 
   // Walk all network inputs
   for (Operation *in : init_ops)
@@ -295,6 +391,8 @@ void ModelAnalyzer::analyze(const mir::Graph *g)
   constructInferenceSequence(post_order);
 
   collectOutputs(g);
+
+  planMemory();
 }
 
 void ModelAnalyzer::visit(ops::ConcatOp &op) { appendOperationToInference(&op, "concat"); }
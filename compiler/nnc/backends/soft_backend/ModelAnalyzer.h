@@ -123,6 +123,18 @@ public:
 
   size_t getTempTID() const { return _temp_tensor_id; }
 
+  /**
+   * @return Peak number of elements in arena holding all tensors planned by ModelAnalyzer
+   */
+  size_t getArenaSize() const { return _arena_size; }
+
+  /**
+   * @param tensor_id Id of tensor
+   * @return Offset of tensor storage in arena in number of elements,
+   *         sir::INVALID_ARENA_OFFSET if tensor is not stored in arena
+   */
+  size_t getArenaOffset(size_t tensor_id) const { return _arena_offsets.at(tensor_id); }
+
 protected:
   void visit_fallback(mir::Operation &op) override;
 
@@ -157,15 +169,17 @@ private:
   /**
    * @brief Declares persistent tensor in artifact
    * @param name Name of variable, if empty - assigned automaticly
+   * @param shape Shape of tensor
    * @return Id of created tensor
    */
-  size_t declarePersistentTensor(const std::string &name);
+  size_t declarePersistentTensor(const std::string &name, const mir::Shape &shape);
 
   /**
    * @brief Declares temporary tensor in artifact
+   * @param shape Shape of tensor
    * @return Id of created tensor
    */
-  size_t declareTemporaryTensor();
+  size_t declareTemporaryTensor(const mir::Shape &shape);
 
   /**
    * @brief Gathers info where tensors were defined and used in inference sequence
@@ -182,6 +196,16 @@ private:
    */
   void constructInferenceSequence(const std::vector<mir::Operation *> &post_order);
 
+  /**
+   * @brief Assigns offsets in a single arena to tensors computed by inference sequence
+   *
+   * Lifetime of a tensor spans from the operation defining it to the last operation using it,
+   * network outputs live until the end of inference. Tensors are placed greedily from the
+   * largest one at the lowest offset not used by tensors with overlapping lifetime.
+   * Inputs and constants are not stored in arena.
+   */
+  void planMemory();
+
   /**
    * @brief Fill list of outputs in ModelAnalyzer
    * @param g Graph where to get list of outputs
@@ -199,6 +223,8 @@ private:
   size_t _max_temp_size = 0;
   size_t _temp_tensor_id = 0;
   std::vector<sir::TensorDescriptor> _tensors;
+  size_t _arena_size = 0;
+  std::vector<size_t> _arena_offsets;
   std::map<const mir::Operation *, const sir::Action *> _opToDescr;
 };
 
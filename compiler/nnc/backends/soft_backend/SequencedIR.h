@@ -33,6 +33,7 @@ namespace sir
 {
 
 const size_t INVALID_TENSOR_ID = std::numeric_limits<size_t>::max();
+const size_t INVALID_ARENA_OFFSET = std::numeric_limits<size_t>::max();
 
 /**
  * @brief Represents variable used in artifact.
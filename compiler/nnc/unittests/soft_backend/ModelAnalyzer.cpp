@@ -19,6 +19,7 @@
 #include "mir/ops/InputOp.h"
 #include "mir/ops/ReluOp.h"
 #include "mir/ops/ConcatOp.h"
+#include "mir/ops/OutputOp.h"
 
 #include <gtest/gtest.h>
 
@@ -81,3 +82,43 @@ TEST(ModelAnalyzer, linearization)
   vector<Operation *> valid_seq2{input, head2, tail2, head1, tail1, join};
   ASSERT_TRUE(op_seq == valid_seq1 || op_seq == valid_seq2);
 }
+
+/*
+ * This test designed to check that tensors with disjoint lifetime share memory in arena
+ */
+TEST(ModelAnalyzer, memory_planning)
+{
+  mir::Graph g;
+  // [input] -> [relu1] -> [relu2] -> [relu3] -> [relu4] -> [output]
+  mir::TensorType input_type{mir::DataType::FLOAT32, Shape{1, 2, 3, 4}};
+  Operation *input = g.create<ops::InputOp>(input_type);
+  Operation *relu1 = g.create<ops::ReluOp>(input->getOutput(0));
+  Operation *relu2 = g.create<ops::ReluOp>(relu1->getOutput(0));
+  Operation *relu3 = g.create<ops::ReluOp>(relu2->getOutput(0));
+  Operation *relu4 = g.create<ops::ReluOp>(relu3->getOutput(0));
+  g.create<ops::OutputOp>(relu4->getOutput(0));
+  input->getOutput(0)->setName("input");
+  relu4->getOutput(0)->setName("output");
+
+  ModelAnalyzer ma;
+  ma.analyze(&g);
+
+  auto tensor_of = [&ma](const Operation *op) {
+    for (const auto &action : ma.getInferenceSequence())
+    {
+      const CallFunction *call = getCall(action);
+      if (call != nullptr && call->mirOp == op)
+        return call->outputs[0];
+    }
+    return INVALID_TENSOR_ID;
+  };
+
+  // Input is set by user
+  ASSERT_EQ(ma.getArenaOffset(tensor_of(input)), INVALID_ARENA_OFFSET);
+  // relu1 is dead when relu3 is computed
+  ASSERT_EQ(ma.getArenaOffset(tensor_of(relu1)), ma.getArenaOffset(tensor_of(relu3)));
+  ASSERT_NE(ma.getArenaOffset(tensor_of(relu1)), ma.getArenaOffset(tensor_of(relu2)));
+  ASSERT_EQ(ma.getArenaOffset(tensor_of(relu2)), ma.getArenaOffset(tensor_of(relu4)));
+  // Two tensors of 24 elements, the second one is aligned to 16 elements
+  ASSERT_EQ(ma.getArenaSize(), 32u + 24u);
+}
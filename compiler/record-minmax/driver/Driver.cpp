@@ -26,7 +26,7 @@ int entry(const int argc, char **argv)
   auto input_data_path = args.getInputDataFilePath();
   auto output_model_path = args.getOutputModelFilePath();
 
-  RecordMinMax rmm;
+  RecordMinMax rmm(args.getNumThreads());
 
   // Initialize interpreter and observer
   rmm.initialize(input_model_path);
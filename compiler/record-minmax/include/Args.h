@@ -34,6 +34,7 @@ public:
   const std::string &getInputModelFilePath(void) const { return _input_model_filepath; }
   const std::string &getInputDataFilePath(void) const { return _input_data_filepath; }
   const std::string &getOutputModelFilePath(void) const { return _output_model_filepath; }
+  uint32_t getNumThreads(void) const { return _num_threads; }
 
 private:
   void Initialize();
@@ -46,6 +47,7 @@ private:
   std::string _input_model_filepath;
   std::string _input_data_filepath;
   std::string _output_model_filepath;
+  uint32_t _num_threads = 1;
 };
 
 } // namespace record_minmax
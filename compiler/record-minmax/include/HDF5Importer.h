@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_HDF5IMPORTER_H__
+#define __RECORD_MINMAX_HDF5IMPORTER_H__
+
+#include <H5Cpp.h>
+
+#include <mutex>
+#include <string>
+
+namespace record_minmax
+{
+
+// Reads input data of the form
+//
+//   /value/<record index>/<input index>
+//
+// where each record holds one set of model inputs. Reads are serialized, so the importer can be
+// shared by threads.
+class HDF5Importer
+{
+public:
+  explicit HDF5Importer(const std::string &path);
+
+  uint32_t numRecords() const { return _num_records; }
+
+  // Reads float data of the input_idx'th input of the record_idx'th record into buffer.
+  void readTensor(uint32_t record_idx, uint32_t input_idx, float *buffer, size_t num_elements);
+
+private:
+  std::mutex _mutex;
+  H5::H5File _file;
+  H5::Group _value_grp;
+  uint32_t _num_records = 0;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_HDF5IMPORTER_H__
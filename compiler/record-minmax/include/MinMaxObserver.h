@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_MINMAXOBSERVER_H__
+#define __RECORD_MINMAX_MINMAXOBSERVER_H__
+
+#include <luci_interpreter/Interpreter.h>
+#include <luci_interpreter/core/Tensor.h>
+
+#include <unordered_map>
+
+namespace record_minmax
+{
+
+struct MinMax
+{
+  float min;
+  float max;
+};
+
+using MinMaxMap = std::unordered_map<const luci::CircleNode *, MinMax>;
+
+// Merges 'from' into 'to'. Only min/max reductions are done, so the result does not depend on
+// the order of merges.
+void mergeMinMax(const MinMaxMap &from, MinMaxMap &to);
+
+// Records min/max of activations over all the executions it observes.
+class MinMaxObserver : public luci_interpreter::ExecutionObserver
+{
+public:
+  void postTensorWrite(const luci::CircleNode *node,
+                       const luci_interpreter::Tensor *tensor) override;
+
+  const MinMaxMap &minMaxData() const { return _minmax_data; }
+
+private:
+  MinMaxMap _minmax_data;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_MINMAXOBSERVER_H__
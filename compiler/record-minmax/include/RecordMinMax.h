@@ -19,6 +19,8 @@
 
 #include <luci/IR/Module.h>
 
+#include "MinMaxObserver.h"
+
 #include <memory>
 
 namespace record_minmax
@@ -27,18 +29,25 @@ namespace record_minmax
 class RecordMinMax
 {
 public:
-  explicit RecordMinMax() = default;
+  // num_threads is the number of interpreters running in parallel, 0 for the number of cores
+  explicit RecordMinMax(uint32_t num_threads = 1) : _num_threads(num_threads) {}
 
   ~RecordMinMax() = default;
 
   void initialize(const std::string &input_model_path);
 
+  void initialize(std::unique_ptr<luci::Module> &&module);
+
   void profileData(const std::string &input_data_path);
 
   void saveModel(const std::string &output_model_path);
 
+  const MinMaxMap &minMaxData() const { return _minmax_data; }
+
 private:
+  uint32_t _num_threads;
   std::unique_ptr<luci::Module> _module;
+  MinMaxMap _minmax_data;
 };
 
 } // namespace record_minmax
@@ -1,2 +1,3 @@
 require("luci")
+require("luci-interpreter")
 require("safemain")
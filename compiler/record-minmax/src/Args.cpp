@@ -34,7 +34,9 @@ void Args::Initialize(void)
   desc.add_options()("help,h", "Print available options")(
       "input_model,i", po::value<std::string>()->default_value(""), "Input model filepath")(
       "input_data,d", po::value<std::string>()->default_value(""), "Input data filepath")(
-      "output_model,o", po::value<std::string>()->default_value(""), "Output model filepath");
+      "output_model,o", po::value<std::string>()->default_value(""), "Output model filepath")(
+      "num_threads,t", po::value<uint32_t>()->default_value(1),
+      "Number of threads running calibration, 0 for the number of cores");
 
   _positional.add("input_model", 1).add("input_data", 1).add("output_model", 1);
   _options.add(desc);
@@ -95,6 +97,11 @@ void Args::Parse(const int argc, char **argv)
     }
   }
 
+  if (vm.count("num_threads"))
+  {
+    _num_threads = vm["num_threads"].as<uint32_t>();
+  }
+
   if (vm.count("output_model"))
   {
     _output_model_filepath = vm["output_model"].as<std::string>();
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HDF5Importer.h"
+
+#include <stdexcept>
+
+namespace record_minmax
+{
+
+HDF5Importer::HDF5Importer(const std::string &path)
+    : _file{path, H5F_ACC_RDONLY}, _value_grp{_file.openGroup("value")}
+{
+  _num_records = _value_grp.getNumObjs();
+}
+
+void HDF5Importer::readTensor(uint32_t record_idx, uint32_t input_idx, float *buffer,
+                              size_t num_elements)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  H5::Group record_grp = _value_grp.openGroup(std::to_string(record_idx));
+  H5::DataSet dataset = record_grp.openDataSet(std::to_string(input_idx));
+
+  if (dataset.getDataType().getClass() != H5T_FLOAT)
+    throw std::runtime_error("Only float input data is supported.");
+
+  if (static_cast<size_t>(dataset.getSpace().getSimpleExtentNpoints()) != num_elements)
+    throw std::runtime_error("Input data size mismatch in record " + std::to_string(record_idx) +
+                             ", input " + std::to_string(input_idx) + ".");
+
+  dataset.read(buffer, H5::PredType::NATIVE_FLOAT);
+}
+
+} // namespace record_minmax
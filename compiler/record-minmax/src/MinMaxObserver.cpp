@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxObserver.h"
+
+#include <luci/IR/CircleOpcode.h>
+
+#include <algorithm>
+
+using DataType = luci_interpreter::DataType;
+
+namespace record_minmax
+{
+
+void mergeMinMax(const MinMaxMap &from, MinMaxMap &to)
+{
+  for (const auto &entry : from)
+  {
+    auto it = to.find(entry.first);
+    if (it == to.end())
+    {
+      to.emplace(entry.first, entry.second);
+      continue;
+    }
+    it->second.min = std::min(it->second.min, entry.second.min);
+    it->second.max = std::max(it->second.max, entry.second.max);
+  }
+}
+
+void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
+                                     const luci_interpreter::Tensor *tensor)
+{
+  // Constants are quantized with their own values, only activations are recorded.
+  if (node->opcode() == luci::CircleOpcode::CONST)
+    return;
+
+  // Only float activations are quantized.
+  if (tensor->element_type() != DataType::FLOAT32)
+    return;
+
+  const int32_t num_elements = tensor->shape().num_elements();
+  if (num_elements == 0)
+    return;
+
+  const float *data = tensor->data<float>();
+  const auto minmax = std::minmax_element(data, data + num_elements);
+
+  auto it = _minmax_data.find(node);
+  if (it == _minmax_data.end())
+  {
+    _minmax_data.emplace(node, MinMax{*minmax.first, *minmax.second});
+    return;
+  }
+  it->second.min = std::min(it->second.min, *minmax.first);
+  it->second.max = std::max(it->second.max, *minmax.second);
+}
+
+} // namespace record_minmax
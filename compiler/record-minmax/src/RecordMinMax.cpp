@@ -16,12 +16,20 @@
 
 #include "RecordMinMax.h"
 #include "CircleExpContract.h"
+#include "HDF5Importer.h"
 
 #include <luci/Importer.h>
 #include <luci/CircleExporter.h>
+#include <luci_interpreter/Interpreter.h>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <fstream>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace record_minmax
 {
@@ -36,27 +44,111 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   }
   std::vector<char> model_data((std::istreambuf_iterator<char>(fs)),
                                std::istreambuf_iterator<char>());
-  _module = luci::Importer().importModule(circle::GetModel(model_data.data()));
+  auto module = luci::Importer().importModule(circle::GetModel(model_data.data()));
 
-  if (_module == nullptr)
+  if (module == nullptr)
   {
     throw std::runtime_error("ERROR: Failed to load '" + input_model_path + "'");
   }
 
-  // TODO: Initialize profiling-supported interpreter
+  initialize(std::move(module));
+}
+
+void RecordMinMax::initialize(std::unique_ptr<luci::Module> &&module)
+{
+  _module = std::move(module);
+  _minmax_data.clear();
 }
 
 void RecordMinMax::profileData(const std::string &input_data_path)
 {
-  // TODO: Collect min/max data for the given input data (.h5)
+  HDF5Importer importer(input_data_path);
+  const uint32_t num_records = importer.numRecords();
+
+  const auto input_nodes = loco::input_nodes(_module->graph());
+  for (const auto *input : input_nodes)
+  {
+    if (loco::must_cast<const luci::CircleInput *>(input)->dtype() != loco::DataType::FLOAT32)
+      throw std::runtime_error("Only float inputs are supported.");
+  }
+
+  uint32_t num_workers = _num_threads != 0 ? _num_threads : std::thread::hardware_concurrency();
+  num_workers = std::max(1u, std::min(num_workers, num_records));
+
+  // Workers take records one by one. Each worker has its own interpreter, which shares the model
+  // and its constants with the others, and its own min/max accumulator.
+  std::atomic<uint32_t> next_record{0};
+  std::vector<MinMaxMap> worker_minmax(num_workers);
+  std::vector<std::exception_ptr> worker_errors(num_workers);
+  auto work = [&](uint32_t worker_idx) {
+    try
+    {
+      luci_interpreter::Interpreter interpreter(_module.get());
+      MinMaxObserver observer;
+      interpreter.attachObserver(&observer);
+
+      std::vector<float> input_data;
+      for (uint32_t record_idx = next_record++; record_idx < num_records;
+           record_idx = next_record++)
+      {
+        for (uint32_t input_idx = 0; input_idx < input_nodes.size(); ++input_idx)
+        {
+          const auto *input_node =
+              loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+          uint32_t num_elements = 1;
+          for (uint32_t d = 0; d < input_node->rank(); ++d)
+            num_elements *= input_node->dim(d).value();
 
-  // TODO: Determine the final min/max for each activation
-  //       E.g., using clipping, averaging
+          input_data.resize(num_elements);
+          importer.readTensor(record_idx, input_idx, input_data.data(), num_elements);
+          interpreter.writeInputTensor(input_node, input_data.data(),
+                                       num_elements * sizeof(float));
+        }
+
+        interpreter.interpret();
+      }
+
+      worker_minmax[worker_idx] = observer.minMaxData();
+    }
+    catch (...)
+    {
+      worker_errors[worker_idx] = std::current_exception();
+      // Let the other workers stop early
+      next_record = num_records;
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (uint32_t worker_idx = 1; worker_idx < num_workers; ++worker_idx)
+    threads.emplace_back(work, worker_idx);
+  work(0);
+  for (auto &thread : threads)
+    thread.join();
+
+  for (const auto &error : worker_errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+
+  // Merge in worker order. Only min/max reductions are involved, so the result is the same
+  // regardless of the number of workers and how the records were distributed among them.
+  _minmax_data.clear();
+  for (const auto &minmax : worker_minmax)
+    mergeMinMax(minmax, _minmax_data);
 }
 
 void RecordMinMax::saveModel(const std::string &output_model_path)
 {
-  // TODO: Write min/max data to activation tensors in CircleNodes
+  // Write min/max data to activation tensors in CircleNodes
+  for (const auto &entry : _minmax_data)
+  {
+    auto *node = const_cast<luci::CircleNode *>(entry.first);
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    quantparam->min.push_back(entry.second.min);
+    quantparam->max.push_back(entry.second.max);
+    node->quantparam(std::move(quantparam));
+  }
 
   // Export to output Circle file
   luci::CircleExporter exporter;
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecordMinMax.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <H5Cpp.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <map>
+#include <unistd.h>
+
+namespace
+{
+
+constexpr uint32_t kNumRecords = 37;
+constexpr uint32_t kHeight = 4;
+constexpr uint32_t kWidth = 3;
+
+// input -> Add(const) -> Mul(itself) -> output
+std::unique_ptr<luci::Module> makeModule()
+{
+  auto graph = loco::make_graph();
+
+  auto graph_input = graph->inputs()->create();
+  graph_input->dtype(loco::DataType::FLOAT32);
+  auto input = graph->nodes()->create<luci::CircleInput>();
+  input->index(graph_input->index());
+  input->dtype(loco::DataType::FLOAT32);
+  input->shape({kHeight, kWidth});
+  input->name("input");
+
+  auto bias = graph->nodes()->create<luci::CircleConst>();
+  bias->dtype(loco::DataType::FLOAT32);
+  bias->shape({kWidth});
+  bias->size<loco::DataType::FLOAT32>(kWidth);
+  for (uint32_t i = 0; i < kWidth; ++i)
+    bias->at<loco::DataType::FLOAT32>(i) = static_cast<float>(i) - 1.0f;
+  bias->name("bias");
+
+  auto add = graph->nodes()->create<luci::CircleAdd>();
+  add->x(input);
+  add->y(bias);
+  add->fusedActivationFunction(luci::FusedActFunc::NONE);
+  add->dtype(loco::DataType::FLOAT32);
+  add->name("add");
+
+  auto mul = graph->nodes()->create<luci::CircleMul>();
+  mul->x(add);
+  mul->y(add);
+  mul->fusedActivationFunction(luci::FusedActFunc::NONE);
+  mul->dtype(loco::DataType::FLOAT32);
+  mul->name("mul");
+
+  auto graph_output = graph->outputs()->create();
+  graph_output->dtype(loco::DataType::FLOAT32);
+  auto output = graph->nodes()->create<luci::CircleOutput>();
+  output->index(graph_output->index());
+  output->from(mul);
+  output->dtype(loco::DataType::FLOAT32);
+  output->name("output");
+
+  auto module = luci::make_module();
+  module->add(std::move(graph));
+  return module;
+}
+
+// Writes records whose extremes are spread over different records
+void writeRecords(const std::string &path)
+{
+  H5::H5File file(path, H5F_ACC_TRUNC);
+  H5::Group value_grp = file.createGroup("value");
+  const hsize_t dims[] = {kHeight, kWidth};
+  H5::DataSpace space(2, dims);
+
+  std::vector<float> data(kHeight * kWidth);
+  for (uint32_t record = 0; record < kNumRecords; ++record)
+  {
+    for (uint32_t i = 0; i < data.size(); ++i)
+      data[i] = static_cast<float>((record * 7 + i * 5) % 23) / 4.0f - 3.0f;
+
+    H5::Group record_grp = value_grp.createGroup(std::to_string(record));
+    H5::DataSet dataset = record_grp.createDataSet("0", H5::PredType::NATIVE_FLOAT, space);
+    dataset.write(data.data(), H5::PredType::NATIVE_FLOAT);
+  }
+}
+
+std::map<std::string, record_minmax::MinMax> profile(const std::string &data_path,
+                                                     uint32_t num_threads)
+{
+  record_minmax::RecordMinMax rmm(num_threads);
+  rmm.initialize(makeModule());
+  rmm.profileData(data_path);
+
+  std::map<std::string, record_minmax::MinMax> result;
+  for (const auto &entry : rmm.minMaxData())
+    result.emplace(entry.first->name(), entry.second);
+  return result;
+}
+
+} // namespace
+
+TEST(RecordMinMaxTest, parallel_matches_single)
+{
+  char path[] = "/tmp/record-minmax-test-XXXXXX";
+  const int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  writeRecords(path);
+
+  const auto expected = profile(path, 1);
+  ASSERT_EQ(expected.size(), 3u);
+  ASSERT_EQ(expected.count("input"), 1u);
+  ASSERT_EQ(expected.count("add"), 1u);
+  ASSERT_EQ(expected.count("mul"), 1u);
+  EXPECT_FLOAT_EQ(expected.at("input").min, -3.0f);
+  EXPECT_FLOAT_EQ(expected.at("input").max, 2.5f);
+
+  for (uint32_t num_threads : {2u, 4u, 8u, 0u})
+  {
+    const auto result = profile(path, num_threads);
+    ASSERT_EQ(result.size(), expected.size());
+    for (const auto &entry : expected)
+    {
+      const auto &minmax = result.at(entry.first);
+      EXPECT_EQ(minmax.min, entry.second.min) << entry.first << ", " << num_threads << " threads";
+      EXPECT_EQ(minmax.max, entry.second.max) << entry.first << ", " << num_threads << " threads";
+    }
+  }
+
+  std::remove(path);
+}
@@ -33,6 +33,8 @@ enum class FusedActivationFunctionType
   kRelu6 = 1,
   kRelu1 = 2,
   kRelu = 3,
+  kTanh = 4,
+  kSigmoid = 5,
 };
 enum class PaddingType
 {
@@ -92,6 +94,15 @@ struct PoolParams
   float float_activation_max;
 };
 
+struct LSTMParams
+{
+  // Activation of cell input and cell output
+  FusedActivationFunctionType activation;
+  // Clipping is disabled if threshold is 0
+  float cell_clip;
+  float proj_clip;
+};
+
 struct SoftmaxParams
 {
   // beta is not really used (not a Tensorflow parameter) and not implemented
@@ -191,10 +202,12 @@ struct BinaryArithmeticOpParam
   int broadcast_shape[5] = {};
 };
 
+constexpr int kMaxTransposeDims = 6;
+
 struct TransposeParams
 {
   int8_t perm_count;
-  int32_t perm[4];
+  int32_t perm[kMaxTransposeDims];
 };
 
 struct ConcatenationParams
@@ -231,6 +244,23 @@ struct DepthwiseConvParams
   float float_activation_max;
 };
 
+struct SeparableConvParams
+{
+  // Depthwise convolution
+  PaddingType padding_type;
+  PaddingValues padding_values;
+  int16_t stride_width;
+  int16_t stride_height;
+  int16_t dilation_width_factor;
+  int16_t dilation_height_factor;
+  int16_t depth_multiplier;
+  float depthwise_activation_min;
+  float depthwise_activation_max;
+  // Pointwise convolution
+  float float_activation_min;
+  float float_activation_max;
+};
+
 struct FullyConnectedParams
 {
   FusedActivationFunctionType activation{FusedActivationFunctionType::kNone};
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <vector>
 #include <fixedpoint/fixedpoint.h>
 
 namespace nnfw
@@ -50,6 +51,24 @@ inline int32_t MultiplyByQuantizedMultiplierGreaterThanOne(int32_t x, int32_t qu
   return gemmlowp::SaturatingRoundingDoublingHighMul(x * (1 << left_shift), quantized_multiplier);
 }
 
+// sum((input + input_offset) * filter) + bias = sum(input * filter) + offset_term for a row of a
+// symmetrically quantized int8 filter, so the input offset stays out of the inner products.
+// The terms depend only on constant operands, so kernels compute them once.
+inline void PerChannelOffsetTerms(int num_channels, int depth, const int8_t *filter_data,
+                                  const int32_t *bias_data, int32_t input_offset,
+                                  std::vector<int32_t> *offset_terms)
+{
+  offset_terms->resize(num_channels);
+  for (int c = 0; c < num_channels; ++c)
+  {
+    const int8_t *filter_row = filter_data + c * depth;
+    int32_t sum = 0;
+    for (int d = 0; d < depth; ++d)
+      sum += filter_row[d];
+    (*offset_terms)[c] = input_offset * sum + (bias_data ? bias_data[c] : 0);
+  }
+}
+
 inline int NodeOffset(int b, int h, int w, int height, int width)
 {
   return (b * height + h) * width + w;
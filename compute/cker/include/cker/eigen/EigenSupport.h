@@ -88,9 +88,17 @@ struct EigenContext
   std::unique_ptr<Eigen::ThreadPoolInterface> thread_pool_wrapper;
   std::unique_ptr<Eigen::ThreadPoolDevice> device;
 
-  EigenContext()
+  EigenContext() { SetMaxNumThreads(-1); }
+
+  // Recreate the thread pool with the given number of threads, or as many as the hardware threads
+  // if it is not positive. This must not be called while any kernel runs on the pool.
+  void SetMaxNumThreads(int max_num_threads)
   {
-    int num_threads = std::thread::hardware_concurrency();
+    int num_threads = max_num_threads;
+    if (num_threads <= 0)
+    {
+      num_threads = std::thread::hardware_concurrency();
+    }
     if (num_threads == 0)
     {
       num_threads = default_num_threadpool_threads;
@@ -113,6 +121,15 @@ inline const Eigen::ThreadPoolDevice *GetThreadPoolDevice()
   return ctx.device.get();
 }
 
+inline void SetMaxNumThreads(int max_num_threads)
+{
+  auto &ctx = EigenContext::GetEigenContext();
+  if (max_num_threads > 0 && ctx.device->numThreads() != max_num_threads)
+  {
+    ctx.SetMaxNumThreads(max_num_threads);
+  }
+}
+
 } // namespace eigen_support
 } // namespace cker
 } // namespace nnfw
@@ -21,6 +21,7 @@
 #include <public/gemmlowp.h>
 
 #include <memory>
+#include <mutex>
 #include <thread>
 
 namespace nnfw
@@ -35,30 +36,57 @@ struct GemmContext
   std::unique_ptr<gemmlowp::GemmContext> gemm_context;
   constexpr static int default_num_threadpool_threads = 4;
 
-  GemmContext()
+  GemmContext(int num_threads)
   {
-    int num_threads = std::thread::hardware_concurrency() / 2;
-    if (num_threads == 0)
-    {
-      num_threads = default_num_threadpool_threads;
-    }
-
     gemm_context.reset(new gemmlowp::GemmContext());
     gemm_context->set_max_num_threads(num_threads);
   }
 
+  // Context running on a thread pool. Only one kernel can use it at a time
   static inline GemmContext &GetGemmLowpContext()
   {
-    static GemmContext instance;
+    static GemmContext instance{[] {
+      int num_threads = std::thread::hardware_concurrency() / 2;
+      return num_threads == 0 ? default_num_threadpool_threads : num_threads;
+    }()};
+    return instance;
+  }
+
+  // Single-threaded context of the calling thread
+  static inline GemmContext &GetThreadGemmLowpContext()
+  {
+    static thread_local GemmContext instance{1};
     return instance;
   }
+
+  static inline std::mutex &GetGemmLowpContextMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
 };
 
-inline gemmlowp::GemmContext *GetGemmLowpContext()
+/**
+ * @brief Lend a gemmlowp::GemmContext to a kernel while it runs
+ *
+ *        A kernel gets the multi-threaded context if no other kernel is using it, and a
+ *        single-threaded context of its thread otherwise.
+ */
+class ScopedGemmLowpContext
 {
-  auto &ctx = GemmContext::GetGemmLowpContext();
-  return ctx.gemm_context.get();
-}
+public:
+  ScopedGemmLowpContext() : _lock(GemmContext::GetGemmLowpContextMutex(), std::try_to_lock)
+  {
+    _gemm_context = _lock.owns_lock() ? GemmContext::GetGemmLowpContext().gemm_context.get()
+                                      : GemmContext::GetThreadGemmLowpContext().gemm_context.get();
+  }
+
+  gemmlowp::GemmContext *get() const { return _gemm_context; }
+
+private:
+  std::unique_lock<std::mutex> _lock;
+  gemmlowp::GemmContext *_gemm_context;
+};
 
 } // namespace gemm_support
 } // namespace cker
@@ -23,6 +23,7 @@
 #include "cker/Utils.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include <memory>
 #include <vector>
 
 namespace nnfw
@@ -55,28 +56,42 @@ class Conv
 {
 public:
   Conv()
-      : _modified_filter_data(), _im2col_data(), _im2col_shape(4), _need_im2col(false),
-        _prepared(false)
+      : _modified_filter_data(), _im2col_data(), _per_channel_arena(), _im2col_shape(4),
+        _need_im2col(false), _prepared(false)
   {
   }
 
+  // The packed filter depends only on the filter, so kernels on the same weights can share it
+  static std::shared_ptr<const std::vector<float>> PackFilter(const Shape &filter_shape,
+                                                              const float *filter_data)
+  {
+    const auto output_depth = filter_shape.Dims(0);
+    const Shape hwcn_filter_shape{filter_shape.FlatSize() / output_depth, output_depth};
+    auto packed = std::make_shared<std::vector<float>>(hwcn_filter_shape.FlatSize());
+    TransposeFloatTensor(filter_data, hwcn_filter_shape, packed->data());
+    return packed;
+  }
+
   void prepare(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
                bool &is_replaced_weights)
   {
-    (void)filter_shape;
-    (void)filter_data;
     (void)padding_type;
-    (void)is_replaced_weights;
     if (!_prepared)
     {
-      if (padding_type != PaddingType::kNone && std::thread::hardware_concurrency() > 1)
-      {
-        const auto output_depth = filter_shape.Dims(0);
-        const Shape hwcn_filter_shape{filter_shape.FlatSize() / output_depth, output_depth};
-        _modified_filter_data.resize(hwcn_filter_shape.FlatSize());
-        TransposeFloatTensor(filter_data, hwcn_filter_shape, &_modified_filter_data[0]);
-        is_replaced_weights = true;
-      }
+      _modified_filter_data = PackFilter(filter_shape, filter_data);
+      is_replaced_weights = true;
+      _prepared = true;
+    }
+  }
+
+  // Use the filter packed already instead of packing it again
+  void prepare(const std::shared_ptr<const std::vector<float>> &packed_filter,
+               bool &is_replaced_weights)
+  {
+    if (!_prepared)
+    {
+      _modified_filter_data = packed_filter;
+      is_replaced_weights = true;
       _prepared = true;
     }
   }
@@ -101,23 +116,17 @@ public:
                   const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
                   const float *bias_data, const Shape &output_shape, float *output_data)
   {
-    if (params.padding_type != PaddingType::kNone && std::thread::hardware_concurrency() > 1)
-    {
-      if (!_prepared)
-      {
-        bool not_used_condition = false;
-        prepare(filter_shape, filter_data, params.padding_type, not_used_condition);
-        _prepared = true;
-      }
-      multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
-                          bias_shape, bias_data, output_shape, output_data);
-    }
-    else
+    // The multithreaded kernel covers every padding type and dilation, on the filter transposed
+    // to HWIO by prepare()
+    if (!_prepared)
     {
-      // TODO Support optimized kernel
-      reference::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
-                      bias_data, output_shape, output_data);
+      bool not_used_condition = false;
+      prepare(filter_shape, filter_data, params.padding_type, not_used_condition);
+      _prepared = true;
     }
+    multithreaded::Conv(params, input_shape, input_data, filter_shape,
+                        _modified_filter_data->data(), bias_shape, bias_data, output_shape,
+                        output_data);
   }
 
   void operator()(const ConvParams &params, const Shape &input_shape, const uint8_t *input_data,
@@ -137,9 +146,38 @@ public:
     }
   }
 
+  void operator()(const ConvParams &params, const int32_t *output_multiplier,
+                  const int32_t *output_shift, const Shape &input_shape, const int8_t *input_data,
+                  const Shape &filter_shape, const int8_t *filter_data, const Shape &bias_shape,
+                  const int32_t *bias_data, const Shape &output_shape, int8_t *output_data)
+  {
+    const bool is_dilated = params.dilation_width_factor != 1 || params.dilation_height_factor != 1;
+    if (_prepared && !is_dilated)
+    {
+      // The filter and bias are constant, so they are widened and folded on the first run only
+      if (!_per_channel_arena.prepared)
+      {
+        _per_channel_arena.prepare(filter_shape, filter_data, bias_data, params.input_offset);
+      }
+      assert(!bias_data || bias_shape.FlatSize() == filter_shape.Dims(0));
+      // _im2col_data is only used as raw storage here
+      int8_t *im2col_raw_data = reinterpret_cast<int8_t *>(_im2col_data.data());
+      optimized::ConvPerChannel(params, output_multiplier, output_shift, input_shape, input_data,
+                                filter_shape, _per_channel_arena, output_shape, output_data,
+                                _im2col_shape, im2col_raw_data);
+    }
+    else
+    {
+      reference::ConvPerChannel(params, output_multiplier, output_shift, input_shape, input_data,
+                                filter_shape, filter_data, bias_shape, bias_data, output_shape,
+                                output_data);
+    }
+  }
+
 private:
-  std::vector<float> _modified_filter_data;
+  std::shared_ptr<const std::vector<float>> _modified_filter_data;
   std::vector<uint8_t> _im2col_data;
+  optimized::ConvPerChannelArena _per_channel_arena;
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
@@ -136,6 +136,49 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+// Per-channel quantized int8 fully connected. offset_terms holds the input offset and bias terms
+// of each output channel, which PerChannelOffsetTerms computes once from the constant operands.
+inline void FullyConnectedPerChannel(const FullyConnectedParams &params,
+                                     const int32_t *output_multiplier, const int32_t *output_shift,
+                                     const int32_t *offset_terms, const Shape &input_shape,
+                                     const int8_t *input_data, const Shape &filter_shape,
+                                     const int8_t *filter_data, const Shape &output_shape,
+                                     int8_t *output_data)
+{
+  UNUSED_RELEASE(input_shape);
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(filter_shape.DimensionsCount() >= 2);
+  assert(output_shape.DimensionsCount() >= 1);
+  assert(output_activation_min <= output_activation_max);
+
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth =
+      MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  for (int b = 0; b < batches; ++b)
+  {
+    const int8_t *input_row = input_data + b * accum_depth;
+    for (int out_c = 0; out_c < output_depth; ++out_c)
+    {
+      const int8_t *filter_row = filter_data + out_c * accum_depth;
+      int32_t acc = 0;
+      for (int d = 0; d < accum_depth; ++d)
+        acc += static_cast<int32_t>(input_row[d]) * static_cast<int32_t>(filter_row[d]);
+      acc += offset_terms[out_c];
+      acc = MultiplyByQuantizedMultiplier(acc, output_multiplier[out_c], output_shift[out_c]);
+      acc += output_offset;
+      acc = std::max(acc, output_activation_min);
+      acc = std::min(acc, output_activation_max);
+      output_data[out_c + output_depth * b] = static_cast<int8_t>(acc);
+    }
+  }
+}
+
 inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape &input_shape,
                                  const float *input_data, const Shape &filter_shape,
                                  const int8_t *filter_data, const Shape &, const float *bias_data,
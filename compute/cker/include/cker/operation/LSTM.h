@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NNFW_CKER_LSTM_H__
+#define __NNFW_CKER_LSTM_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/operation/Recurrent.h"
+
+#include <Eigen/Core>
+#include <cassert>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Constant operands of LSTM
+ *
+ * Absent operands have nullptr data
+ * - CIFG      : input_to_input, recurrent_to_input, cell_to_input and input_gate_bias
+ * - No peephole : cell_to_input, cell_to_forget and cell_to_output
+ * - No projection : projection and projection_bias
+ */
+template <typename T> struct LSTMWeights
+{
+  RecurrentWeight<T> input_to_input;
+  RecurrentWeight<T> input_to_forget;
+  RecurrentWeight<T> input_to_cell;
+  RecurrentWeight<T> input_to_output;
+  RecurrentWeight<T> recurrent_to_input;
+  RecurrentWeight<T> recurrent_to_forget;
+  RecurrentWeight<T> recurrent_to_cell;
+  RecurrentWeight<T> recurrent_to_output;
+  RecurrentWeight<T> cell_to_input;
+  RecurrentWeight<T> cell_to_forget;
+  RecurrentWeight<T> cell_to_output;
+  RecurrentWeight<T> projection;
+  const float *input_gate_bias = nullptr;
+  const float *forget_gate_bias = nullptr;
+  const float *cell_bias = nullptr;
+  const float *output_gate_bias = nullptr;
+  const float *projection_bias = nullptr;
+};
+
+/**
+ * @brief LSTM cell with optional CIFG, peephole and projection
+ *
+ * Gate weights are packed at prepare so that the pre-activations of all gates are computed at
+ * once into the scratch buffer, laid out as [batch][gate][cell]
+ * - Float  : [input weights | recurrent weights] of all gates, a single GEMM on [input | output]
+ * - Hybrid : int8 input weights and recurrent weights of all gates, a GEMM for each of quantized
+ *            input and output state, rescaled per gate since gates have their own scales
+ *
+ * Cell state and output state are updated in place, so in and out can be the same buffer.
+ */
+class LSTM
+{
+public:
+  LSTM(void)
+      : _n_input(0), _n_cell(0), _n_output(0), _use_cifg(false), _use_peephole(false),
+        _use_projection(false), _hybrid(false), _prepared(false)
+  {
+    // DO NOTHING
+  }
+
+  bool prepared(void) const { return _prepared; }
+
+  /**
+   * @brief Pack float weights, to be prepared again whenever they change
+   */
+  void prepare(int n_input, int n_cell, int n_output, const LSTMWeights<float> &weights)
+  {
+    prepareCommon(n_input, n_cell, n_output, weights);
+    _hybrid = false;
+
+    const int n_concat = n_input + n_output;
+    const auto gates = gateWeights(weights);
+    _packed_weights.resize(numGates() * n_cell * n_concat);
+    for (int g = 0; g < numGates(); ++g)
+    {
+      recurrent::PackColumns(gates[g].first.data, n_input, gates[g].second.data, n_output, n_cell,
+                             _packed_weights.data() + g * n_cell * n_concat);
+    }
+    _projection = weights.projection;
+    _prepared = true;
+  }
+
+  /**
+   * @brief Pack int8 weights for hybrid execution, to be prepared again whenever they change
+   */
+  void prepare(int n_input, int n_cell, int n_output, const LSTMWeights<int8_t> &weights)
+  {
+    prepareCommon(n_input, n_cell, n_output, weights);
+    _hybrid = true;
+
+    const auto gates = gateWeights(weights);
+    _packed_input_weights.resize(numGates() * n_cell * n_input);
+    _packed_recurrent_weights.resize(numGates() * n_cell * n_output);
+    _input_weight_scales.resize(numGates());
+    _recurrent_weight_scales.resize(numGates());
+    for (int g = 0; g < numGates(); ++g)
+    {
+      std::memcpy(_packed_input_weights.data() + g * n_cell * n_input, gates[g].first.data,
+                  n_cell * n_input);
+      std::memcpy(_packed_recurrent_weights.data() + g * n_cell * n_output, gates[g].second.data,
+                  n_cell * n_output);
+      _input_weight_scales[g] = gates[g].first.scale;
+      _recurrent_weight_scales[g] = gates[g].second.scale;
+    }
+    _projection_hybrid = weights.projection;
+    _prepared = true;
+  }
+
+  void operator()(const LSTMParams &params, const Shape &input_shape, const float *input_data,
+                  const float *output_state_in, const float *cell_state_in, float *scratch_buffer,
+                  float *output_state_out, float *cell_state_out, float *output_data)
+  {
+    assert(_prepared);
+    const int n_batch = input_shape.FlatSize() / _n_input;
+    const int n_gates_cell = numGates() * _n_cell;
+
+    // Pre-activations of gates = bias + input weights * input + recurrent weights * output state
+    for (int b = 0; b < n_batch; ++b)
+    {
+      for (int g = 0; g < numGates(); ++g)
+      {
+        std::memcpy(scratch_buffer + b * n_gates_cell + g * _n_cell, _biases[g],
+                    _n_cell * sizeof(float));
+      }
+    }
+    if (_hybrid)
+    {
+      hybridGates(n_batch, input_data, output_state_in, scratch_buffer);
+    }
+    else
+    {
+      const int n_concat = _n_input + _n_output;
+      _concat.resize(n_batch * n_concat);
+      recurrent::ConcatBatches(input_data, _n_input, output_state_in, _n_output, n_batch,
+                               _concat.data());
+      recurrent::BatchMatMulAccumulate(_packed_weights.data(), n_gates_cell, n_concat,
+                                       _concat.data(), n_batch, scratch_buffer);
+    }
+
+    // Output state in is not used anymore, so states can be written in place
+    for (int b = 0; b < n_batch; ++b)
+    {
+      updateCell(params, scratch_buffer + b * n_gates_cell, cell_state_in + b * _n_cell,
+                 cell_state_out + b * _n_cell);
+    }
+
+    // Hidden output of each batch is left in the place of its cell gate
+    const int cell_gate_offset = (_use_cifg ? 1 : 2) * _n_cell;
+    if (_use_projection)
+    {
+      project(params, n_batch, scratch_buffer + cell_gate_offset, n_gates_cell, output_state_out);
+    }
+    else
+    {
+      for (int b = 0; b < n_batch; ++b)
+      {
+        std::memcpy(output_state_out + b * _n_output,
+                    scratch_buffer + b * n_gates_cell + cell_gate_offset,
+                    _n_output * sizeof(float));
+      }
+    }
+
+    if (output_data != output_state_out)
+    {
+      std::memcpy(output_data, output_state_out, n_batch * _n_output * sizeof(float));
+    }
+  }
+
+private:
+  using Array = Eigen::Map<Eigen::ArrayXf>;
+  using ConstArray = Eigen::Map<const Eigen::ArrayXf>;
+
+  int numGates(void) const { return _use_cifg ? 3 : 4; }
+
+  template <typename T>
+  void prepareCommon(int n_input, int n_cell, int n_output, const LSTMWeights<T> &weights)
+  {
+    _n_input = n_input;
+    _n_cell = n_cell;
+    _n_output = n_output;
+    _use_cifg = (weights.input_to_input.data == nullptr);
+    _use_peephole = (weights.cell_to_forget.data != nullptr);
+    _use_projection = (weights.projection.data != nullptr);
+    _projection_bias = weights.projection_bias;
+
+    _biases.clear();
+    if (!_use_cifg)
+      _biases.emplace_back(weights.input_gate_bias);
+    _biases.emplace_back(weights.forget_gate_bias);
+    _biases.emplace_back(weights.cell_bias);
+    _biases.emplace_back(weights.output_gate_bias);
+
+    // Peephole weights are used as float in both float and hybrid execution. Only int8 weights
+    // carry a meaningful scale, float tensors have none.
+    const bool quantized = std::is_same<T, int8_t>::value;
+    auto dequantize = [n_cell, quantized](const RecurrentWeight<T> &weight,
+                                          std::vector<float> &out) {
+      out.clear();
+      if (weight.data == nullptr)
+        return;
+      const float scale = quantized ? weight.scale : 1.0f;
+      out.resize(n_cell);
+      for (int c = 0; c < n_cell; ++c)
+        out[c] = static_cast<float>(weight.data[c]) * scale;
+    };
+    dequantize(weights.cell_to_input, _cell_to_input);
+    dequantize(weights.cell_to_forget, _cell_to_forget);
+    dequantize(weights.cell_to_output, _cell_to_output);
+  }
+
+  // Pairs of input weights and recurrent weights in the order of gates in the scratch buffer
+  template <typename T>
+  std::vector<std::pair<RecurrentWeight<T>, RecurrentWeight<T>>>
+  gateWeights(const LSTMWeights<T> &weights) const
+  {
+    std::vector<std::pair<RecurrentWeight<T>, RecurrentWeight<T>>> gates;
+    if (!_use_cifg)
+      gates.emplace_back(weights.input_to_input, weights.recurrent_to_input);
+    gates.emplace_back(weights.input_to_forget, weights.recurrent_to_forget);
+    gates.emplace_back(weights.input_to_cell, weights.recurrent_to_cell);
+    gates.emplace_back(weights.input_to_output, weights.recurrent_to_output);
+    return gates;
+  }
+
+  void hybridGates(int n_batch, const float *input_data, const float *output_state_in,
+                   float *gates)
+  {
+    const int n_gates_cell = numGates() * _n_cell;
+    _accumulator.resize(n_batch * n_gates_cell);
+
+    auto accumulate = [&](const std::vector<int8_t> &weights, int n_cols, const float *vectors,
+                          const std::vector<float> &weight_scales) {
+      _quantized.resize(n_batch * n_cols);
+      _scaling_factors.resize(n_batch);
+      if (!recurrent::QuantizeBatches(vectors, n_cols, n_batch, _quantized.data(),
+                                      _scaling_factors.data()))
+        return;
+
+      ZeroVector(_accumulator.data(), n_batch * n_gates_cell);
+      MatrixBatchVectorMultiplyAccumulate(weights.data(), n_gates_cell, n_cols, _quantized.data(),
+                                          _scaling_factors.data(), n_batch, _accumulator.data(),
+                                          /*result_stride=*/1);
+      for (int b = 0; b < n_batch; ++b)
+      {
+        for (int g = 0; g < numGates(); ++g)
+        {
+          const int offset = b * n_gates_cell + g * _n_cell;
+          Array(gates + offset, _n_cell) +=
+              ConstArray(_accumulator.data() + offset, _n_cell) * weight_scales[g];
+        }
+      }
+    };
+
+    accumulate(_packed_input_weights, _n_input, input_data, _input_weight_scales);
+    accumulate(_packed_recurrent_weights, _n_output, output_state_in, _recurrent_weight_scales);
+  }
+
+  // Turn pre-activations of gates into cell state, and leave hidden output in the cell gate
+  void updateCell(const LSTMParams &params, float *gates, const float *cell_state_in,
+                  float *cell_state_out)
+  {
+    const int n_cell = _n_cell;
+    const auto sigmoid = Eigen::internal::scalar_logistic_op<float>();
+
+    float *input_gate = _use_cifg ? nullptr : gates;
+    Array forget_gate(gates + (_use_cifg ? 0 : 1) * n_cell, n_cell);
+    float *cell_gate_data = gates + (_use_cifg ? 1 : 2) * n_cell;
+    Array cell_gate(cell_gate_data, n_cell);
+    Array output_gate(gates + (_use_cifg ? 2 : 3) * n_cell, n_cell);
+    ConstArray prev_cell(cell_state_in, n_cell);
+    Array cell(cell_state_out, n_cell);
+
+    if (_use_peephole)
+    {
+      forget_gate += ConstArray(_cell_to_forget.data(), n_cell) * prev_cell;
+      if (input_gate)
+        Array(input_gate, n_cell) += ConstArray(_cell_to_input.data(), n_cell) * prev_cell;
+    }
+    forget_gate = forget_gate.unaryExpr(sigmoid);
+    recurrent::ApplyActivation(params.activation, cell_gate_data, n_cell);
+
+    if (input_gate)
+    {
+      Array input(input_gate, n_cell);
+      input = input.unaryExpr(sigmoid);
+      cell = forget_gate * prev_cell + input * cell_gate;
+    }
+    else
+    {
+      cell = forget_gate * prev_cell + (1.0f - forget_gate) * cell_gate;
+    }
+    recurrent::Clip(params.cell_clip, cell_state_out, n_cell);
+
+    if (_use_peephole)
+    {
+      output_gate += ConstArray(_cell_to_output.data(), n_cell) * cell;
+    }
+    output_gate = output_gate.unaryExpr(sigmoid);
+
+    cell_gate = cell;
+    recurrent::ApplyActivation(params.activation, cell_gate_data, n_cell);
+    cell_gate *= output_gate;
+  }
+
+  // output state = projection_bias + projection * hidden, where hidden rows are strided
+  void project(const LSTMParams &params, int n_batch, const float *hidden, int hidden_stride,
+               float *output_state_out)
+  {
+    _concat.resize(n_batch * _n_cell);
+    for (int b = 0; b < n_batch; ++b)
+    {
+      std::memcpy(_concat.data() + b * _n_cell, hidden + b * hidden_stride,
+                  _n_cell * sizeof(float));
+    }
+
+    if (_projection_bias)
+      VectorBatchVectorAssign(_projection_bias, _n_output, n_batch, output_state_out);
+    else
+      ZeroVector(output_state_out, n_batch * _n_output);
+
+    if (_hybrid)
+    {
+      _quantized.resize(n_batch * _n_cell);
+      _scaling_factors.resize(n_batch);
+      if (recurrent::QuantizeBatches(_concat.data(), _n_cell, n_batch, _quantized.data(),
+                                     _scaling_factors.data()))
+      {
+        for (auto &factor : _scaling_factors)
+          factor *= _projection_hybrid.scale;
+        MatrixBatchVectorMultiplyAccumulate(_projection_hybrid.data, _n_output, _n_cell,
+                                            _quantized.data(), _scaling_factors.data(), n_batch,
+                                            output_state_out, /*result_stride=*/1);
+      }
+    }
+    else
+    {
+      recurrent::BatchMatMulAccumulate(_projection.data, _n_output, _n_cell, _concat.data(),
+                                       n_batch, output_state_out);
+    }
+
+    recurrent::Clip(params.proj_clip, output_state_out, n_batch * _n_output);
+  }
+
+private:
+  int _n_input;
+  int _n_cell;
+  int _n_output;
+  bool _use_cifg;
+  bool _use_peephole;
+  bool _use_projection;
+  bool _hybrid;
+  bool _prepared;
+
+  std::vector<const float *> _biases;
+  const float *_projection_bias = nullptr;
+  std::vector<float> _cell_to_input;
+  std::vector<float> _cell_to_forget;
+  std::vector<float> _cell_to_output;
+
+  // Float
+  std::vector<float> _packed_weights;
+  RecurrentWeight<float> _projection;
+
+  // Hybrid
+  std::vector<int8_t> _packed_input_weights;
+  std::vector<int8_t> _packed_recurrent_weights;
+  std::vector<float> _input_weight_scales;
+  std::vector<float> _recurrent_weight_scales;
+  RecurrentWeight<int8_t> _projection_hybrid;
+
+  // Temporaries of a step
+  std::vector<float> _concat;
+  std::vector<int8_t> _quantized;
+  std::vector<float> _scaling_factors;
+  std::vector<float> _accumulator;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LSTM_H__
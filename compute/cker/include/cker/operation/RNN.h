@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NNFW_CKER_RNN_H__
+#define __NNFW_CKER_RNN_H__
+
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/operation/Recurrent.h"
+
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Basic RNN cell, hidden = activation(weights * input + recurrent_weights * hidden + bias)
+ *
+ * Float weights are packed into [weights | recurrent_weights] so that a step is a single GEMM on
+ * [input | hidden]. Int8 weights of hybrid execution are used as they are, and input and hidden
+ * state are quantized per batch at each step.
+ * Hidden state in and out can be the same buffer.
+ */
+class RNN
+{
+public:
+  RNN(void) : _n_input(0), _n_units(0), _hybrid(false), _prepared(false)
+  {
+    // DO NOTHING
+  }
+
+  bool prepared(void) const { return _prepared; }
+
+  /**
+   * @brief Pack float weights, to be prepared again whenever they change
+   */
+  void prepare(int n_input, int n_units, const RecurrentWeight<float> &weights,
+               const RecurrentWeight<float> &recurrent_weights)
+  {
+    _n_input = n_input;
+    _n_units = n_units;
+    _hybrid = false;
+    _packed_weights.resize(n_units * (n_input + n_units));
+    recurrent::PackColumns(weights.data, n_input, recurrent_weights.data, n_units, n_units,
+                           _packed_weights.data());
+    _prepared = true;
+  }
+
+  /**
+   * @brief Keep int8 weights for hybrid execution
+   */
+  void prepare(int n_input, int n_units, const RecurrentWeight<int8_t> &weights,
+               const RecurrentWeight<int8_t> &recurrent_weights)
+  {
+    _n_input = n_input;
+    _n_units = n_units;
+    _hybrid = true;
+    _weights = weights;
+    _recurrent_weights = recurrent_weights;
+    _prepared = true;
+  }
+
+  void operator()(FusedActivationFunctionType activation, const Shape &input_shape,
+                  const float *input_data, const float *hidden_state_in, const float *bias_data,
+                  float *output_data, float *hidden_state_out)
+  {
+    assert(_prepared);
+    const int n_batch = input_shape.FlatSize() / _n_input;
+    const int n_units = _n_units;
+
+    if (_hybrid)
+    {
+      hybridStep(n_batch, input_data, hidden_state_in, bias_data, output_data);
+    }
+    else
+    {
+      // Concatenation copies hidden state, so output may overwrite it
+      const int n_concat = _n_input + n_units;
+      _concat.resize(n_batch * n_concat);
+      recurrent::ConcatBatches(input_data, _n_input, hidden_state_in, n_units, n_batch,
+                               _concat.data());
+      VectorBatchVectorAssign(bias_data, n_units, n_batch, output_data);
+      recurrent::BatchMatMulAccumulate(_packed_weights.data(), n_units, n_concat, _concat.data(),
+                                       n_batch, output_data);
+    }
+
+    recurrent::ApplyActivation(activation, output_data, n_batch * n_units);
+    if (hidden_state_out != output_data)
+    {
+      std::memcpy(hidden_state_out, output_data, n_batch * n_units * sizeof(float));
+    }
+  }
+
+private:
+  void hybridStep(int n_batch, const float *input_data, const float *hidden_state_in,
+                  const float *bias_data, float *output_data)
+  {
+    const int n_units = _n_units;
+    _quantized_input.resize(n_batch * _n_input);
+    _quantized_hidden.resize(n_batch * n_units);
+    _input_scaling_factors.resize(n_batch);
+    _hidden_scaling_factors.resize(n_batch);
+
+    // Quantize hidden state before output overwrites it
+    const bool has_input =
+        recurrent::QuantizeBatches(input_data, _n_input, n_batch, _quantized_input.data(),
+                                   _input_scaling_factors.data());
+    const bool has_hidden =
+        recurrent::QuantizeBatches(hidden_state_in, n_units, n_batch, _quantized_hidden.data(),
+                                   _hidden_scaling_factors.data());
+
+    VectorBatchVectorAssign(bias_data, n_units, n_batch, output_data);
+    if (has_input)
+    {
+      for (auto &factor : _input_scaling_factors)
+        factor *= _weights.scale;
+      MatrixBatchVectorMultiplyAccumulate(_weights.data, n_units, _n_input,
+                                          _quantized_input.data(), _input_scaling_factors.data(),
+                                          n_batch, output_data, /*result_stride=*/1);
+    }
+    if (has_hidden)
+    {
+      for (auto &factor : _hidden_scaling_factors)
+        factor *= _recurrent_weights.scale;
+      MatrixBatchVectorMultiplyAccumulate(_recurrent_weights.data, n_units, n_units,
+                                          _quantized_hidden.data(), _hidden_scaling_factors.data(),
+                                          n_batch, output_data, /*result_stride=*/1);
+    }
+  }
+
+private:
+  int _n_input;
+  int _n_units;
+  bool _hybrid;
+  bool _prepared;
+
+  // Float
+  std::vector<float> _packed_weights;
+  std::vector<float> _concat;
+
+  // Hybrid
+  RecurrentWeight<int8_t> _weights;
+  RecurrentWeight<int8_t> _recurrent_weights;
+  std::vector<int8_t> _quantized_input;
+  std::vector<int8_t> _quantized_hidden;
+  std::vector<float> _input_scaling_factors;
+  std::vector<float> _hidden_scaling_factors;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RNN_H__
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2018 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NNFW_CKER_RECURRENT_H__
+#define __NNFW_CKER_RECURRENT_H__
+
+#include "cker/Types.h"
+#include "cker/TensorUtils.h"
+
+#include <Eigen/Core>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Weight operand of recurrent kernels
+ *
+ * Scale is used only for int8 weights of hybrid execution, where activations are float.
+ */
+template <typename T> struct RecurrentWeight
+{
+  const T *data = nullptr;
+  float scale = 1.0f;
+};
+
+namespace recurrent
+{
+
+using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+using ColMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
+
+/**
+ * @brief Copy the weight rows next to each other, as [weight_a | weight_b] of rows x (a + b)
+ */
+template <typename T>
+inline void PackColumns(const T *weight_a, int cols_a, const T *weight_b, int cols_b, int rows,
+                        T *packed)
+{
+  const int cols = cols_a + cols_b;
+  for (int r = 0; r < rows; ++r)
+  {
+    std::memcpy(packed + r * cols, weight_a + r * cols_a, cols_a * sizeof(T));
+    std::memcpy(packed + r * cols + cols_a, weight_b + r * cols_b, cols_b * sizeof(T));
+  }
+}
+
+/**
+ * @brief Concatenate batches of a and b, as [a_b | b_b] for each batch b
+ */
+inline void ConcatBatches(const float *a, int size_a, const float *b, int size_b, int n_batch,
+                          float *concat)
+{
+  PackColumns(a, size_a, b, size_b, n_batch, concat);
+}
+
+/**
+ * @brief result(n_batch x rows) += vectors(n_batch x cols) * weight(rows x cols)^T
+ */
+inline void BatchMatMulAccumulate(const float *weight, int rows, int cols, const float *vectors,
+                                  int n_batch, float *result)
+{
+  Eigen::Map<const RowMajorMatrix> weight_map(weight, rows, cols);
+  Eigen::Map<const ColMajorMatrix> vectors_map(vectors, cols, n_batch);
+  Eigen::Map<ColMajorMatrix> result_map(result, rows, n_batch);
+  result_map.noalias() += weight_map * vectors_map;
+}
+
+/**
+ * @brief Quantize each batch symmetrically, and return false if all values are zero
+ */
+inline bool QuantizeBatches(const float *vectors, int size, int n_batch, int8_t *quantized,
+                            float *scaling_factors)
+{
+  if (IsZeroVector(vectors, size * n_batch))
+    return false;
+
+  float unused_min, unused_max;
+  for (int b = 0; b < n_batch; ++b)
+  {
+    SymmetricQuantizeFloats(vectors + b * size, size, quantized + b * size, &unused_min,
+                            &unused_max, &scaling_factors[b]);
+  }
+  return true;
+}
+
+inline void ApplyActivation(FusedActivationFunctionType activation, float *data, int size)
+{
+  Eigen::Map<Eigen::ArrayXf> array(data, size);
+  switch (activation)
+  {
+    case FusedActivationFunctionType::kTanh:
+      array = array.tanh();
+      break;
+    case FusedActivationFunctionType::kSigmoid:
+      array = array.unaryExpr(Eigen::internal::scalar_logistic_op<float>());
+      break;
+    default:
+      ApplyActivationToVector(data, size, activation, data);
+      break;
+  }
+}
+
+inline void Clip(float threshold, float *data, int size)
+{
+  if (threshold <= 0.0f)
+    return;
+
+  Eigen::Map<Eigen::ArrayXf> array(data, size);
+  array = array.max(-threshold).min(threshold);
+}
+
+} // namespace recurrent
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_RECURRENT_H__
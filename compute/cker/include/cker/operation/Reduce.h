@@ -21,6 +21,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/operation/optimized/Reduce.h"
 
 namespace nnfw
 {
@@ -158,6 +159,32 @@ public:
                             num_resolved_axis, _temp_index.data(), reducer, output_data);
   }
 
+  // Computes the value of elements across dimensions given in axis with Reducer (i.e.,
+  // optimized::SumReducer). Adjacent reduced axes run the optimized kernel, others fall back to
+  // ReduceGeneric.
+  template <typename T, typename Reducer>
+  inline bool ReduceWith(const Shape &input_shape, const T *input_data, const Shape &output_shape,
+                         T *output_data, const std::vector<int> &axes, bool keep_dims)
+  {
+    int num_resolved_axis = 0;
+    if (!ResolveAxis(input_shape.DimensionsCount(), axes, _resolved_axis.data(),
+                     &num_resolved_axis))
+    {
+      return false;
+    }
+
+    optimized::ReduceDims dims;
+    if (optimized::CollapseReduceDims(input_shape, _resolved_axis.data(), num_resolved_axis,
+                                      &dims))
+    {
+      optimized::ReduceCollapsed<T, T, Reducer>(dims, input_data, output_data);
+      return true;
+    }
+
+    return ReduceGeneric<T>(input_shape, input_data, output_shape, output_data, axes, keep_dims,
+                            Reducer::Init(), Reducer::Apply);
+  }
+
   inline int32_t *resolved_axis_data(void) { return _resolved_axis.data(); }
   inline int32_t *temp_index_data(void) { return _temp_index.data(); }
 
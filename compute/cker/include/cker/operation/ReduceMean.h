@@ -159,6 +159,22 @@ public:
     {
       return false;
     }
+
+    // Mean of adjacent axes is the sum of the optimized kernel divided by the number of elements
+    optimized::ReduceDims dims;
+    if (optimized::CollapseReduceDims(input_shape, resolved_axis_data(), num_resolved_axis, &dims))
+    {
+      const int num_outputs = dims.outer * dims.inner;
+      optimized::ReduceCollapsed<In, Out, optimized::SumReducer<Out>>(dims, input_data,
+                                                                     output_data);
+      if (dims.reduced > 0)
+      {
+        for (int idx = 0; idx < num_outputs; ++idx)
+          output_data[idx] /= dims.reduced;
+      }
+      return true;
+    }
+
     return ReduceMeanImpl<In, Out>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
                                    temp_index_data(), reducer, output_data);
   }
@@ -184,9 +200,20 @@ public:
       return false;
     }
 
-    size_t normalizer =
-        ReduceSumQuantImpl<In>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
-                               temp_index_data(), reducer, _temp_sum.data());
+    size_t normalizer;
+    optimized::ReduceDims dims;
+    if (optimized::CollapseReduceDims(input_shape, resolved_axis_data(), num_resolved_axis, &dims))
+    {
+      optimized::ReduceCollapsed<In, int, optimized::SumReducer<int>>(dims, input_data,
+                                                                     _temp_sum.data());
+      normalizer = dims.reduced;
+    }
+    else
+    {
+      normalizer =
+          ReduceSumQuantImpl<In>(input_data, input_shape, resolved_axis_data(), num_resolved_axis,
+                                 temp_index_data(), reducer, _temp_sum.data());
+    }
     if (num_outputs > 0)
     {
       float scale = input_scale / output_scale;
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_SEPARABLE_CONV_H__
+#define __NNFW_CKER_SEPARABLE_CONV_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+namespace separable_conv
+{
+
+// Size of the depthwise result kept per tile, which should stay in L2 cache
+constexpr int kTileBufferSize = 64 * 1024;
+
+// Buffer of the depthwise result of a tile. Each thread of the pool keeps its own, which is
+// reused by later tiles and runs instead of being allocated for every chunk of tiles.
+inline float *TileBuffer(size_t size)
+{
+  thread_local std::vector<float> buffer;
+  if (buffer.size() < size)
+    buffer.resize(size);
+  return buffer.data();
+}
+
+// Depthwise convolution of output rows [out_y_begin, out_y_end) of one batch into 'buffer'
+inline void DepthwiseRows(const SeparableConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &filter_shape,
+                          const float *filter_data, const float *bias_data, int batch,
+                          int out_y_begin, int out_y_end, int output_width, float *buffer)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int depth_multiplier = params.depth_multiplier;
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = input_shape.Dims(3);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int depth = input_depth * depth_multiplier;
+
+  for (int out_y = out_y_begin; out_y < out_y_end; ++out_y)
+  {
+    for (int out_x = 0; out_x < output_width; ++out_x)
+    {
+      float *acc = buffer + ((out_y - out_y_begin) * output_width + out_x) * depth;
+      std::copy(bias_data, bias_data + depth, acc);
+
+      const int in_x_origin = (out_x * stride_width) - pad_width;
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      {
+        const int in_y = in_y_origin + dilation_height_factor * filter_y;
+        if (in_y < 0 || in_y >= input_height)
+          continue;
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+        {
+          const int in_x = in_x_origin + dilation_width_factor * filter_x;
+          if (in_x < 0 || in_x >= input_width)
+            continue;
+          const float *in = input_data + Offset(input_shape, batch, in_y, in_x, 0);
+          const float *filter = filter_data + Offset(filter_shape, 0, filter_y, filter_x, 0);
+          if (depth_multiplier == 1)
+          {
+            for (int c = 0; c < depth; ++c)
+            {
+              acc[c] += in[c] * filter[c];
+            }
+          }
+          else
+          {
+            for (int ic = 0; ic < input_depth; ++ic)
+            {
+              for (int m = 0; m < depth_multiplier; ++m)
+              {
+                const int oc = ic * depth_multiplier + m;
+                acc[oc] += in[ic] * filter[oc];
+              }
+            }
+          }
+        }
+      }
+
+      for (int c = 0; c < depth; ++c)
+      {
+        acc[c] = ActivationFunctionWithMinMax(acc[c], params.depthwise_activation_min,
+                                              params.depthwise_activation_max);
+      }
+    }
+  }
+}
+
+} // namespace separable_conv
+
+/**
+ * @brief Depthwise convolution followed by 1x1 convolution with unit stride
+ *
+ * Output rows are computed tile by tile. The depthwise result of a tile is kept in a buffer small
+ * enough to stay in cache, and is consumed by the pointwise convolution right away. Tiles run in
+ * parallel on the Eigen thread pool.
+ *
+ * @param pw_filter_shape [output_depth, 1, 1, depthwise output depth]
+ */
+inline void SeparableConv(const SeparableConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &dw_filter_shape,
+                          const float *dw_filter_data, const Shape &dw_bias_shape,
+                          const float *dw_bias_data, const Shape &pw_filter_shape,
+                          const float *pw_filter_data, const Shape &pw_bias_shape,
+                          const float *pw_bias_data, const Shape &output_shape, float *output_data)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(dw_filter_shape.DimensionsCount() == 4);
+  assert(pw_filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(pw_filter_shape.Dims(1) == 1 && pw_filter_shape.Dims(2) == 1);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(dw_filter_shape, 3, pw_filter_shape, 3);
+  const int output_depth = MatchingDim(pw_filter_shape, 0, output_shape, 3);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  assert(depth == input_shape.Dims(3) * params.depth_multiplier);
+  assert(dw_bias_shape.FlatSize() == depth);
+  assert(pw_bias_shape.FlatSize() == output_depth);
+  UNUSED_RELEASE(dw_bias_shape);
+  UNUSED_RELEASE(pw_bias_shape);
+
+  const int row_size = output_width * depth;
+  const int tile_rows = std::max(1, std::min(output_height, static_cast<int>(
+                                                                separable_conv::kTileBufferSize /
+                                                                (row_size * sizeof(float)))));
+  const int tiles_per_batch = (output_height + tile_rows - 1) / tile_rows;
+
+  using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+  const Eigen::Map<const RowMajorMatrix> pw_filter(pw_filter_data, output_depth, depth);
+  const Eigen::Map<const Eigen::RowVectorXf> pw_bias(pw_bias_data, output_depth);
+
+  auto run_tiles = [&](Eigen::Index first, Eigen::Index last) {
+    float *buffer = separable_conv::TileBuffer(static_cast<size_t>(tile_rows) * row_size);
+    for (Eigen::Index tile = first; tile < last; ++tile)
+    {
+      const int batch = tile / tiles_per_batch;
+      const int out_y_begin = (tile % tiles_per_batch) * tile_rows;
+      const int out_y_end = std::min(out_y_begin + tile_rows, output_height);
+      const int num_pixels = (out_y_end - out_y_begin) * output_width;
+
+      separable_conv::DepthwiseRows(params, input_shape, input_data, dw_filter_shape,
+                                    dw_filter_data, dw_bias_data, batch, out_y_begin, out_y_end,
+                                    output_width, buffer);
+
+      const Eigen::Map<const RowMajorMatrix> dw_out(buffer, num_pixels, depth);
+      Eigen::Map<RowMajorMatrix> out(output_data + Offset(output_shape, batch, out_y_begin, 0, 0),
+                                     num_pixels, output_depth);
+      out.noalias() = dw_out * pw_filter.transpose();
+      out.rowwise() += pw_bias;
+      out = out.cwiseMax(params.float_activation_min).cwiseMin(params.float_activation_max);
+    }
+  };
+
+  const Eigen::Index num_tiles = batches * tiles_per_batch;
+  const double tile_pixels = static_cast<double>(tile_rows) * output_width;
+  const Eigen::TensorOpCost cost(
+      /*bytes_loaded=*/tile_pixels * depth * sizeof(float),
+      /*bytes_stored=*/tile_pixels * output_depth * sizeof(float),
+      /*compute_cycles=*/tile_pixels * depth *
+          (dw_filter_shape.Dims(1) * dw_filter_shape.Dims(2) + output_depth));
+  eigen_support::GetThreadPoolDevice()->parallelFor(num_tiles, cost, run_tiles);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_SEPARABLE_CONV_H__
@@ -83,7 +83,7 @@ inline void Conv(const ConvParams &params, const Shape &input_shape, const uint8
                  const int32_t *bias_data, const Shape &output_shape, uint8_t *output_data,
                  const Shape &im2col_shape, uint8_t *im2col_data)
 {
-  gemmlowp::GemmContext *gemm_context = gemm_support::GetGemmLowpContext();
+  gemm_support::ScopedGemmLowpContext gemm_context;
 
   const int stride_width = params.stride_width;
   const int stride_height = params.stride_height;
@@ -165,10 +165,121 @@ inline void Conv(const ConvParams &params, const Shape &input_shape, const uint8
       GemmlowpOutputPipeline::MakeExp(bias_data, output_rows, output_offset, output_multiplier,
                                       output_shift, output_activation_min, output_activation_max);
   gemmlowp::GemmWithOutputPipeline<uint8_t, uint8_t, gemmlowp::L8R8WithLhsNonzeroBitDepthParams>(
-      gemm_context, filter_matrix, input_matrix, &output_matrix, filter_offset, input_offset,
+      gemm_context.get(), filter_matrix, input_matrix, &output_matrix, filter_offset, input_offset,
       output_pipeline);
 }
 
+// Filter of a per-channel quantized int8 convolution widened to int32 and transposed for the
+// matrix product, with its per-channel offset terms and the accumulator block. The filter and
+// bias are constant, so they are prepared once and reused on every run.
+class ConvPerChannelArena
+{
+public:
+  using Int32Matrix = Eigen::Matrix<int32_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  ConvPerChannelArena(void) : prepared(false), filter(), offset_terms(), acc_block()
+  {
+    // DO NOTHING
+  }
+
+  void prepare(const Shape &filter_shape, const int8_t *filter_data, const int32_t *bias_data,
+               int32_t input_offset)
+  {
+    using Int8Matrix = Eigen::Matrix<int8_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    const int output_depth = filter_shape.Dims(0);
+    const int depth = filter_shape.FlatSize() / output_depth;
+    PerChannelOffsetTerms(output_depth, depth, filter_data, bias_data, input_offset,
+                          &offset_terms);
+    filter =
+        Eigen::Map<const Int8Matrix>(filter_data, output_depth, depth).cast<int32_t>().transpose();
+    prepared = true;
+  }
+
+public:
+  bool prepared;
+  Int32Matrix filter;
+  std::vector<int32_t> offset_terms;
+  Int32Matrix acc_block;
+};
+
+// Per-channel quantized int8 convolution. It lowers the input with im2col so that the convolution
+// becomes a matrix product, which Eigen computes on widened int32 blocks of rows.
+// The filter and bias are taken from the arena prepared for them.
+// Dilation is not supported here, use reference::ConvPerChannel instead.
+inline void ConvPerChannel(const ConvParams &params, const int32_t *output_multiplier,
+                           const int32_t *output_shift, const Shape &input_shape,
+                           const int8_t *input_data, const Shape &filter_shape,
+                           ConvPerChannelArena &arena, const Shape &output_shape,
+                           int8_t *output_data, const Shape &im2col_shape, int8_t *im2col_data)
+{
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int32_t input_offset = params.input_offset;
+  const int32_t output_offset = params.output_offset;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(params.dilation_width_factor == 1 && params.dilation_height_factor == 1);
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(arena.prepared);
+
+  const int8_t *gemm_input_data = nullptr;
+  const int filter_width = filter_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const bool need_im2col =
+      stride_width != 1 || stride_height != 1 || filter_width != 1 || filter_height != 1;
+  if (need_im2col)
+  {
+    assert(im2col_data);
+    const int input_zero_point = -input_offset;
+    assert(input_zero_point >= -128);
+    assert(input_zero_point <= 127);
+    // Padded area is filled with the input zero point so that it contributes nothing
+    Im2col(params, filter_height, filter_width,
+           static_cast<uint8_t>(static_cast<int8_t>(input_zero_point)), input_shape, input_data,
+           im2col_shape, im2col_data);
+    gemm_input_data = im2col_data;
+  }
+  else
+  {
+    gemm_input_data = input_data;
+  }
+  UNUSED_RELEASE(im2col_shape);
+
+  const int depth = filter_shape.Dims(1) * filter_shape.Dims(2) * filter_shape.Dims(3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int output_cols = output_shape.Dims(0) * output_shape.Dims(1) * output_shape.Dims(2);
+  const int32_t *filter_offset_terms = arena.offset_terms.data();
+
+  using Int8Matrix = Eigen::Matrix<int8_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  // Rows are widened a block at a time, which bounds the size of the int32 copies
+  constexpr int kRowBlock = 64;
+  auto &acc_block = arena.acc_block;
+  for (int col_begin = 0; col_begin < output_cols; col_begin += kRowBlock)
+  {
+    const int rows = std::min(kRowBlock, output_cols - col_begin);
+    const Eigen::Map<const Int8Matrix> input_block(gemm_input_data + col_begin * depth, rows,
+                                                   depth);
+    acc_block.noalias() = input_block.cast<int32_t>() * arena.filter;
+
+    for (int row = 0; row < rows; ++row)
+    {
+      int8_t *output_row = output_data + (col_begin + row) * output_depth;
+      for (int oc = 0; oc < output_depth; ++oc)
+      {
+        int32_t acc = acc_block(row, oc) + filter_offset_terms[oc];
+        acc = MultiplyByQuantizedMultiplier(acc, output_multiplier[oc], output_shift[oc]);
+        acc += output_offset;
+        acc = std::max(acc, output_activation_min);
+        acc = std::min(acc, output_activation_max);
+        output_row[oc] = static_cast<int8_t>(acc);
+      }
+    }
+  }
+}
+
 } // namespace optimized
 
 namespace multithreaded
@@ -187,7 +298,7 @@ private:
       case PaddingType::kSame:
         return Eigen::PADDING_SAME;
       case PaddingType::kNone:
-        assert(false); // should never get here.
+        // Explicit paddings are given to Eigen separately on top of VALID padding
         return Eigen::PADDING_VALID;
     }
     return Eigen::PADDING_SAME; // Prevent compiler warning about missing
@@ -198,15 +309,17 @@ public:
   void operator()(const Eigen::ThreadPoolDevice &device, const T *input_data, int input_batches,
                   int input_height, int input_width, int input_depth, const T *filter_data,
                   int filter_height, int filter_width, int filter_count, int stride_rows,
-                  int stride_cols, int pad_height, int pad_width, nnfw::cker::PaddingType padding,
+                  int stride_cols, int dilation_rows, int dilation_cols, int pad_top,
+                  int pad_bottom, int pad_left, int pad_right, nnfw::cker::PaddingType padding,
                   T *output_data, int output_height, int output_width)
   {
-    const bool is_1x1_kernel =
-        (filter_height == 1 && filter_width == 1 && stride_rows == 1 && stride_cols == 1);
+    const bool no_padding = (pad_top == 0 && pad_bottom == 0 && pad_left == 0 && pad_right == 0);
+    const bool no_dilation = (dilation_rows == 1 && dilation_cols == 1);
+    const bool is_1x1_kernel = (filter_height == 1 && filter_width == 1 && stride_rows == 1 &&
+                                stride_cols == 1 && no_padding);
     const bool is_same_height_width =
-        (filter_height == input_height && filter_width == input_width && pad_width == 0 &&
-         pad_height == 0);
-    if (is_1x1_kernel || is_same_height_width)
+        (filter_height == input_height && filter_width == input_width && no_padding);
+    if (no_dilation && (is_1x1_kernel || is_same_height_width))
     {
       // is_1x1_kernel: For 1x1 kernel, the 2D convolution is reduced to matrix multiplication.
       //  - output (input_batches * conv_width, filter_count)
@@ -240,8 +353,11 @@ public:
                                             input_depth);
       eigen_support::ConstEigenTensor filter(filter_data, filter_height, filter_width, input_depth,
                                              filter_count);
-      output.device(device) = Eigen::SpatialConvolution(input, filter, stride_cols, stride_rows,
-                                                        RuntimePadding2EigenPadding(padding));
+      // In row-major layout, Eigen "rows" are the width and "cols" are the height
+      output.device(device) = Eigen::SpatialConvolution(
+          input, filter, stride_cols, stride_rows, RuntimePadding2EigenPadding(padding),
+          dilation_cols, dilation_rows, Eigen::NoOpOutputKernel(), pad_left, pad_right, pad_top,
+          pad_bottom);
     }
   }
 };
@@ -255,9 +371,9 @@ inline void Conv(const ConvParams &params, const Shape &input_shape, const float
 
   const int stride_width = params.stride_width;
   const int stride_height = params.stride_height;
+  const int dilation_width = params.dilation_width_factor;
+  const int dilation_height = params.dilation_height_factor;
   const PaddingType padding = params.padding_type;
-  const int pad_width = params.padding_values.width;
-  const int pad_height = params.padding_values.height;
   const float output_activation_min = params.float_activation_min;
   const float output_activation_max = params.float_activation_max;
   assert(input_shape.DimensionsCount() == 4);
@@ -274,10 +390,29 @@ inline void Conv(const ConvParams &params, const Shape &input_shape, const float
   const int output_height = output_shape.Dims(1);
   const int output_width = output_shape.Dims(2);
 
+  // Eigen computes SAME/VALID paddings by itself. Explicit paddings only have the top/left side,
+  // so the bottom/right side is what remains to produce the output size.
+  int pad_top = 0;
+  int pad_bottom = 0;
+  int pad_left = 0;
+  int pad_right = 0;
+  if (padding == PaddingType::kNone)
+  {
+    const int effective_filter_height = (filter_height - 1) * dilation_height + 1;
+    const int effective_filter_width = (filter_width - 1) * dilation_width + 1;
+    pad_top = params.padding_values.height;
+    pad_left = params.padding_values.width;
+    pad_bottom = std::max(0, (output_height - 1) * stride_height + effective_filter_height -
+                                 input_height - pad_top);
+    pad_right = std::max(
+        0, (output_width - 1) * stride_width + effective_filter_width - input_width - pad_left);
+  }
+
   EigenTensorConvFunctor<float> conv_functor;
   conv_functor(device, input_data, batches, input_height, input_width, input_depth, filter_data,
-               filter_height, filter_width, output_depth, stride_height, stride_width, pad_height,
-               pad_width, padding, output_data, output_height, output_width);
+               filter_height, filter_width, output_depth, stride_height, stride_width,
+               dilation_height, dilation_width, pad_top, pad_bottom, pad_left, pad_right, padding,
+               output_data, output_height, output_width);
 
   optimized::AddBiasAndEvalActivationFunction(output_activation_min, output_activation_max,
                                               bias_shape, bias_data, output_shape, output_data);
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_REDUCE_H__
+#define __NNFW_CKER_OPTIMIZED_REDUCE_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+/**
+ * @brief Input of reduction viewed as [outer, reduced, inner]
+ */
+struct ReduceDims
+{
+  int outer;
+  int reduced;
+  int inner;
+};
+
+/**
+ * @brief Collapse input dimensions into ReduceDims
+ *
+ * @return false if the reduced axes are not adjacent, ignoring dimensions of size 1
+ */
+inline bool CollapseReduceDims(const Shape &input_shape, const int *axis, int num_axis,
+                               ReduceDims *dims)
+{
+  const int num_dims = input_shape.DimensionsCount();
+  auto is_reduced = [&](int d) { return std::find(axis, axis + num_axis, d) != axis + num_axis; };
+
+  int first = -1;
+  int last = -1;
+  for (int d = 0; d < num_dims; ++d)
+  {
+    if (is_reduced(d) && input_shape.Dims(d) != 1)
+    {
+      if (first == -1)
+        first = d;
+      last = d;
+    }
+  }
+
+  dims->outer = 1;
+  dims->reduced = 1;
+  dims->inner = 1;
+  for (int d = 0; d < num_dims; ++d)
+  {
+    const int dim = input_shape.Dims(d);
+    if (first == -1 || d < first)
+    {
+      dims->outer *= dim;
+    }
+    else if (d > last)
+    {
+      dims->inner *= dim;
+    }
+    else
+    {
+      if (!is_reduced(d) && dim != 1)
+        return false;
+      dims->reduced *= dim;
+    }
+  }
+  return true;
+}
+
+// Reducers give the identity, the scalar operation for generic kernels, the reduction of
+// a contiguous Eigen array and the element-wise accumulation of two Eigen arrays.
+template <typename T> struct SumReducer
+{
+  static T Init() { return static_cast<T>(0); }
+  static T Apply(const T current, const T in) { return current + in; }
+  template <typename Array> static T Reduce(const Array &array) { return array.sum(); }
+  template <typename Acc, typename Array> static void Accumulate(Acc &acc, const Array &array)
+  {
+    acc += array;
+  }
+};
+
+template <typename T> struct ProdReducer
+{
+  static T Init() { return static_cast<T>(1); }
+  static T Apply(const T current, const T in) { return current * in; }
+  template <typename Array> static T Reduce(const Array &array) { return array.prod(); }
+  template <typename Acc, typename Array> static void Accumulate(Acc &acc, const Array &array)
+  {
+    acc *= array;
+  }
+};
+
+template <typename T> struct MaxReducer
+{
+  static T Init() { return std::numeric_limits<T>::lowest(); }
+  static T Apply(const T current, const T in) { return (in > current) ? in : current; }
+  template <typename Array> static T Reduce(const Array &array) { return array.maxCoeff(); }
+  template <typename Acc, typename Array> static void Accumulate(Acc &acc, const Array &array)
+  {
+    acc = acc.max(array);
+  }
+};
+
+template <typename T> struct MinReducer
+{
+  static T Init() { return std::numeric_limits<T>::max(); }
+  static T Apply(const T current, const T in) { return (in < current) ? in : current; }
+  template <typename Array> static T Reduce(const Array &array) { return array.minCoeff(); }
+  template <typename Acc, typename Array> static void Accumulate(Acc &acc, const Array &array)
+  {
+    acc = acc.min(array);
+  }
+};
+
+struct AnyReducer
+{
+  static bool Init() { return false; }
+  static bool Apply(const bool current, const bool in) { return in || current; }
+  template <typename Array> static bool Reduce(const Array &array) { return array.any(); }
+  template <typename Acc, typename Array> static void Accumulate(Acc &acc, const Array &array)
+  {
+    acc = acc || array;
+  }
+};
+
+struct AllReducer
+{
+  static bool Init() { return true; }
+  static bool Apply(const bool current, const bool in) { return in && current; }
+  template <typename Array> static bool Reduce(const Array &array) { return array.all(); }
+  template <typename Acc, typename Array> static void Accumulate(Acc &acc, const Array &array)
+  {
+    acc = acc && array;
+  }
+};
+
+namespace reduce
+{
+
+// Number of inner elements a task accumulates at once, so that a task works on cache-resident
+// output and the outermost reduction still has enough tasks to run in parallel
+constexpr int kInnerBlockSize = 1024;
+
+} // namespace reduce
+
+/**
+ * @brief Reduce input viewed as [outer, reduced, inner] into output of [outer, inner]
+ *
+ * Innermost reduction reduces contiguous rows. Other reductions accumulate contiguous rows
+ * element-wise into the output. Both are vectorized by Eigen and run in parallel across
+ * outer and inner blocks on the Eigen thread pool.
+ */
+template <typename In, typename Out, typename Reducer>
+void ReduceCollapsed(const ReduceDims &dims, const In *input_data, Out *output_data)
+{
+  using InArray = Eigen::Array<In, Eigen::Dynamic, 1>;
+  using OutArray = Eigen::Array<Out, Eigen::Dynamic, 1>;
+
+  const auto *device = eigen_support::GetThreadPoolDevice();
+
+  if (dims.reduced == 0)
+  {
+    std::fill(output_data, output_data + dims.outer * dims.inner, Reducer::Init());
+    return;
+  }
+
+  if (dims.inner == 1)
+  {
+    auto reduce_rows = [&](Eigen::Index first, Eigen::Index last) {
+      for (Eigen::Index o = first; o < last; ++o)
+      {
+        const Eigen::Map<const InArray> row(input_data + o * dims.reduced, dims.reduced);
+        output_data[o] = Reducer::Reduce(row.template cast<Out>());
+      }
+    };
+    const Eigen::TensorOpCost cost(/*bytes_loaded=*/dims.reduced * sizeof(In),
+                                   /*bytes_stored=*/sizeof(Out),
+                                   /*compute_cycles=*/dims.reduced);
+    device->parallelFor(dims.outer, cost, reduce_rows);
+    return;
+  }
+
+  const int block_size = std::min(dims.inner, reduce::kInnerBlockSize);
+  const int blocks_per_outer = (dims.inner + block_size - 1) / block_size;
+
+  auto accumulate_rows = [&](Eigen::Index first, Eigen::Index last) {
+    for (Eigen::Index task = first; task < last; ++task)
+    {
+      const int o = task / blocks_per_outer;
+      const int begin = (task % blocks_per_outer) * block_size;
+      const int size = std::min(block_size, dims.inner - begin);
+
+      Eigen::Map<OutArray> acc(output_data + o * dims.inner + begin, size);
+      const In *input_block = input_data + static_cast<size_t>(o) * dims.reduced * dims.inner;
+      acc = Eigen::Map<const InArray>(input_block + begin, size).template cast<Out>();
+      for (int r = 1; r < dims.reduced; ++r)
+      {
+        const Eigen::Map<const InArray> row(input_block + r * dims.inner + begin, size);
+        Reducer::Accumulate(acc, row.template cast<Out>());
+      }
+    }
+  };
+  const Eigen::TensorOpCost cost(/*bytes_loaded=*/dims.reduced * block_size * sizeof(In),
+                                 /*bytes_stored=*/block_size * sizeof(Out),
+                                 /*compute_cycles=*/dims.reduced * block_size);
+  device->parallelFor(dims.outer * blocks_per_outer, cost, accumulate_rows);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_REDUCE_H__
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_TRANSPOSE_H__
+#define __NNFW_CKER_OPTIMIZED_TRANSPOSE_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/neon/neon_check.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+
+#if !defined(USE_NEON) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+namespace transpose
+{
+
+// Rows and columns of a tile, chosen so that the source and destination tiles of the widest
+// element type fit in L1 together
+constexpr int kTileSize = 32;
+
+/**
+ * @brief Transpose with size-1 dimensions removed and dimensions which stay adjacent in the
+ *        output merged into one
+ */
+struct CollapsedParams
+{
+  int num_dims;
+  int input_dims[kMaxTransposeDims];
+  int perm[kMaxTransposeDims];
+};
+
+inline CollapsedParams Collapse(const TransposeParams &params, const Shape &input_shape)
+{
+  const int num_dims = input_shape.DimensionsCount();
+  assert(num_dims == params.perm_count);
+
+  // Remove size-1 dimensions
+  int dims[kMaxTransposeDims];
+  int new_index[kMaxTransposeDims];
+  int num_kept = 0;
+  for (int d = 0; d < num_dims; ++d)
+  {
+    if (input_shape.Dims(d) == 1)
+    {
+      new_index[d] = -1;
+      continue;
+    }
+    new_index[d] = num_kept;
+    dims[num_kept++] = input_shape.Dims(d);
+  }
+
+  int perm[kMaxTransposeDims];
+  int num_perm = 0;
+  for (int i = 0; i < num_dims; ++i)
+  {
+    if (new_index[params.perm[i]] >= 0)
+      perm[num_perm++] = new_index[params.perm[i]];
+  }
+  assert(num_perm == num_kept);
+
+  // Group runs of consecutive input dimensions in the output order
+  int group_first[kMaxTransposeDims];
+  int group_size[kMaxTransposeDims];
+  int num_groups = 0;
+  for (int i = 0; i < num_perm; ++i)
+  {
+    if (i > 0 && perm[i] == perm[i - 1] + 1)
+    {
+      group_size[num_groups - 1] *= dims[perm[i]];
+      continue;
+    }
+    group_first[num_groups] = perm[i];
+    group_size[num_groups] = dims[perm[i]];
+    ++num_groups;
+  }
+
+  // Groups ordered by their first input dimension give the collapsed input
+  CollapsedParams collapsed;
+  collapsed.num_dims = num_groups;
+  for (int g = 0; g < num_groups; ++g)
+  {
+    int rank = 0;
+    for (int h = 0; h < num_groups; ++h)
+    {
+      if (group_first[h] < group_first[g])
+        ++rank;
+    }
+    collapsed.perm[g] = rank;
+    collapsed.input_dims[rank] = group_size[g];
+  }
+  return collapsed;
+}
+
+template <typename T>
+inline void TransposeTileScalar(const T *src, int src_stride, T *dst, int dst_stride, int rows,
+                                int cols)
+{
+  for (int i = 0; i < rows; ++i)
+  {
+    for (int j = 0; j < cols; ++j)
+    {
+      dst[j * dst_stride + i] = src[i * src_stride + j];
+    }
+  }
+}
+
+/**
+ * @brief Write dst[j * dst_stride + i] = src[i * src_stride + j] for a tile of rows x cols
+ */
+template <typename T>
+inline void TransposeTile(const T *src, int src_stride, T *dst, int dst_stride, int rows, int cols)
+{
+  TransposeTileScalar(src, src_stride, dst, dst_stride, rows, cols);
+}
+
+#if defined(USE_NEON) || defined(__SSE2__)
+inline void Transpose4x4(const int32_t *src, int src_stride, int32_t *dst, int dst_stride)
+{
+#ifdef USE_NEON
+  const int32x4_t r0 = vld1q_s32(src);
+  const int32x4_t r1 = vld1q_s32(src + src_stride);
+  const int32x4_t r2 = vld1q_s32(src + 2 * src_stride);
+  const int32x4_t r3 = vld1q_s32(src + 3 * src_stride);
+  const int32x4x2_t t01 = vtrnq_s32(r0, r1);
+  const int32x4x2_t t23 = vtrnq_s32(r2, r3);
+  vst1q_s32(dst, vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0])));
+  vst1q_s32(dst + dst_stride, vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1])));
+  vst1q_s32(dst + 2 * dst_stride,
+            vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0])));
+  vst1q_s32(dst + 3 * dst_stride,
+            vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1])));
+#else
+  const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+  const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + src_stride));
+  const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2 * src_stride));
+  const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 3 * src_stride));
+  const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+  const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+  const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+  const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_unpacklo_epi64(t0, t1));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + dst_stride), _mm_unpackhi_epi64(t0, t1));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 2 * dst_stride), _mm_unpacklo_epi64(t2, t3));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 3 * dst_stride), _mm_unpackhi_epi64(t2, t3));
+#endif
+}
+
+// 32-bit elements (float included) are transposed 4x4 in registers
+template <>
+inline void TransposeTile<int32_t>(const int32_t *src, int src_stride, int32_t *dst,
+                                   int dst_stride, int rows, int cols)
+{
+  const int rows4 = rows & ~3;
+  const int cols4 = cols & ~3;
+  for (int i = 0; i < rows4; i += 4)
+  {
+    for (int j = 0; j < cols4; j += 4)
+    {
+      Transpose4x4(src + i * src_stride + j, src_stride, dst + j * dst_stride + i, dst_stride);
+    }
+  }
+  TransposeTileScalar(src + cols4, src_stride, dst + cols4 * dst_stride, dst_stride, rows4,
+                      cols - cols4);
+  TransposeTileScalar(src + rows4 * src_stride, src_stride, dst + rows4, dst_stride,
+                      rows - rows4, cols);
+}
+#endif // defined(USE_NEON) || defined(__SSE2__)
+
+} // namespace transpose
+
+/**
+ * @brief Transpose of up to kMaxTransposeDims dimensions
+ *
+ * Dimensions are collapsed first. If the innermost input dimension stays innermost, rows of it
+ * are copied with memcpy. Otherwise the plane of the innermost input and output dimensions is
+ * transposed tile by tile. Rows or tiles are distributed over the Eigen thread pool.
+ */
+template <typename T>
+void Transpose(const TransposeParams &params, const Shape &input_shape, const T *input_data,
+               T *output_data)
+{
+  const auto c = transpose::Collapse(params, input_shape);
+  const int n = c.num_dims;
+  const int flat_size = input_shape.FlatSize();
+
+  if (flat_size == 0)
+    return;
+
+  if (n <= 1)
+  {
+    memcpy(output_data, input_data, flat_size * sizeof(T));
+    return;
+  }
+
+  int input_strides[kMaxTransposeDims];
+  input_strides[n - 1] = 1;
+  for (int d = n - 2; d >= 0; --d)
+    input_strides[d] = input_strides[d + 1] * c.input_dims[d + 1];
+
+  int output_dims[kMaxTransposeDims];
+  int output_strides[kMaxTransposeDims];
+  for (int i = 0; i < n; ++i)
+    output_dims[i] = c.input_dims[c.perm[i]];
+  output_strides[n - 1] = 1;
+  for (int i = n - 2; i >= 0; --i)
+    output_strides[i] = output_strides[i + 1] * output_dims[i + 1];
+
+  const auto *device = eigen_support::GetThreadPoolDevice();
+
+  if (c.perm[n - 1] == n - 1)
+  {
+    const int row_size = c.input_dims[n - 1];
+    auto copy_rows = [&](Eigen::Index first, Eigen::Index last) {
+      for (Eigen::Index row = first; row < last; ++row)
+      {
+        Eigen::Index rest = row;
+        int input_offset = 0;
+        for (int i = n - 2; i >= 0; --i)
+        {
+          input_offset += (rest % output_dims[i]) * input_strides[c.perm[i]];
+          rest /= output_dims[i];
+        }
+        memcpy(output_data + row * row_size, input_data + input_offset, row_size * sizeof(T));
+      }
+    };
+    const Eigen::TensorOpCost cost(/*bytes_loaded=*/row_size * sizeof(T),
+                                   /*bytes_stored=*/row_size * sizeof(T),
+                                   /*compute_cycles=*/n);
+    device->parallelFor(flat_size / row_size, cost, copy_rows);
+    return;
+  }
+
+  // Tiles on the plane of input dimension 'a', which becomes the innermost in the output, and
+  // innermost input dimension 'b'
+  const int a = c.perm[n - 1];
+  const int b = n - 1;
+  int output_strides_of_input[kMaxTransposeDims];
+  for (int i = 0; i < n; ++i)
+    output_strides_of_input[c.perm[i]] = output_strides[i];
+
+  int outer_dims[kMaxTransposeDims];
+  int outer_input_strides[kMaxTransposeDims];
+  int outer_output_strides[kMaxTransposeDims];
+  int num_outer = 0;
+  for (int d = 0; d < n; ++d)
+  {
+    if (d == a || d == b)
+      continue;
+    outer_dims[num_outer] = c.input_dims[d];
+    outer_input_strides[num_outer] = input_strides[d];
+    outer_output_strides[num_outer] = output_strides_of_input[d];
+    ++num_outer;
+  }
+
+  const int a_size = c.input_dims[a];
+  const int b_size = c.input_dims[b];
+  const int a_tiles = (a_size + transpose::kTileSize - 1) / transpose::kTileSize;
+  const int b_tiles = (b_size + transpose::kTileSize - 1) / transpose::kTileSize;
+  const int src_stride = input_strides[a];
+  const int dst_stride = output_strides_of_input[b];
+
+  auto transpose_tiles = [&](Eigen::Index first, Eigen::Index last) {
+    for (Eigen::Index task = first; task < last; ++task)
+    {
+      const int b_tile = task % b_tiles;
+      const int a_tile = (task / b_tiles) % a_tiles;
+      Eigen::Index rest = task / b_tiles / a_tiles;
+      int input_offset = 0;
+      int output_offset = 0;
+      for (int i = num_outer - 1; i >= 0; --i)
+      {
+        const int index = rest % outer_dims[i];
+        rest /= outer_dims[i];
+        input_offset += index * outer_input_strides[i];
+        output_offset += index * outer_output_strides[i];
+      }
+
+      const int a_begin = a_tile * transpose::kTileSize;
+      const int b_begin = b_tile * transpose::kTileSize;
+      transpose::TransposeTile<T>(
+          input_data + input_offset + a_begin * src_stride + b_begin, src_stride,
+          output_data + output_offset + b_begin * dst_stride + a_begin, dst_stride,
+          std::min(transpose::kTileSize, a_size - a_begin),
+          std::min(transpose::kTileSize, b_size - b_begin));
+    }
+  };
+  const int tile_elements = transpose::kTileSize * transpose::kTileSize;
+  const Eigen::TensorOpCost cost(/*bytes_loaded=*/tile_elements * sizeof(T),
+                                 /*bytes_stored=*/tile_elements * sizeof(T),
+                                 /*compute_cycles=*/tile_elements);
+  device->parallelFor(flat_size / (a_size * b_size) * a_tiles * b_tiles, cost, transpose_tiles);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_TRANSPOSE_H__
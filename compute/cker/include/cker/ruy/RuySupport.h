@@ -22,6 +22,9 @@
 #include <ruy/context.h>
 #include "cker/Types.h"
 
+#include <memory>
+#include <mutex>
+
 namespace
 {
 const int kDefaultNumThreadpoolThreads = 4;
@@ -37,9 +40,9 @@ namespace ruy_support
 struct RuyContext
 {
 public:
-  RuyContext() : ruy_context_(new ruy::Context)
+  RuyContext(int max_num_threads) : ruy_context_(new ruy::Context)
   {
-    SetMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
+    SetMaxNumThreads(max_num_threads);
 #ifdef USE_RUY_GEMV
     ruy_context_->cache_policy = ruy::kCacheLHSOnNarrowMul;
 #endif
@@ -47,12 +50,26 @@ public:
 
   ruy::Context *ruy_context() const { return ruy_context_.get(); }
 
+  // Context running on RUY_THREADS threads. Only one kernel can use it at a time
   static inline RuyContext &GetRuyContext()
   {
-    static RuyContext instance;
+    static RuyContext instance{onert::util::getConfigInt(onert::util::config::RUY_THREADS)};
+    return instance;
+  }
+
+  // Single-threaded context of the calling thread
+  static inline RuyContext &GetThreadRuyContext()
+  {
+    static thread_local RuyContext instance{1};
     return instance;
   }
 
+  static inline std::mutex &GetRuyContextMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
   void SetMaxNumThreads(int max_num_threads)
   {
     const int target_num_threads =
@@ -64,11 +81,28 @@ private:
   const std::unique_ptr<ruy::Context> ruy_context_;
 };
 
-inline ruy::Context *GetRuyContext()
+/**
+ * @brief Lend a ruy::Context to a kernel while it runs
+ *
+ *        A kernel gets the multi-threaded context if no other kernel is using it. Kernels running
+ *        at the same time on other threads get single-threaded contexts of their own threads, so
+ *        that they do not oversubscribe the cores with a thread pool each.
+ */
+class ScopedRuyContext
 {
-  auto &ctx = RuyContext::GetRuyContext();
-  return ctx.ruy_context();
-}
+public:
+  ScopedRuyContext() : lock_(RuyContext::GetRuyContextMutex(), std::try_to_lock)
+  {
+    ruy_context_ = lock_.owns_lock() ? RuyContext::GetRuyContext().ruy_context()
+                                     : RuyContext::GetThreadRuyContext().ruy_context();
+  }
+
+  ruy::Context *get() const { return ruy_context_; }
+
+private:
+  std::unique_lock<std::mutex> lock_;
+  ruy::Context *ruy_context_;
+};
 
 template <typename Scalar, typename DataPointer>
 void MakeRuyMatrix(const MatrixParams<Scalar> &params, DataPointer data_ptr,
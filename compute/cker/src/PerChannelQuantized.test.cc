@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Conv.h>
+#include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/FullyConnected.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+constexpr int32_t kInputZeroPoint = -3;
+constexpr int32_t kOutputZeroPoint = 5;
+
+std::vector<int8_t> makeData(int size, int seed)
+{
+  std::vector<int8_t> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<int8_t>((i * 37 + seed * 11) % 31 - 15);
+  return data;
+}
+
+std::vector<int32_t> makeBias(int size)
+{
+  std::vector<int32_t> bias(size);
+  for (int i = 0; i < size; ++i)
+    bias[i] = (i * 523) % 2001 - 1000;
+  return bias;
+}
+
+// Multipliers around 2^-8 which differ between channels
+void makeMultipliers(int num_channels, std::vector<int32_t> *multiplier,
+                     std::vector<int32_t> *shift)
+{
+  multiplier->resize(num_channels);
+  shift->resize(num_channels);
+  for (int i = 0; i < num_channels; ++i)
+  {
+    multiplier->at(i) = (1 << 30) + i * (1 << 25);
+    shift->at(i) = -7 - i % 3;
+  }
+}
+
+int8_t requantize(int32_t acc, int32_t multiplier, int32_t shift)
+{
+  acc = nnfw::cker::MultiplyByQuantizedMultiplier(acc, multiplier, shift) + kOutputZeroPoint;
+  return static_cast<int8_t>(std::min(127, std::max(-128, acc)));
+}
+
+struct ConvCase
+{
+  int batches;
+  int height;
+  int width;
+  int input_depth;
+  int filter_height;
+  int filter_width;
+  int output_depth; // Depth multiplier for depthwise convolution
+  int stride;
+  int dilation;
+  int pad;
+};
+
+int outputSize(int input_size, int filter_size, int stride, int dilation, int pad)
+{
+  const int dilated_filter_size = (filter_size - 1) * dilation + 1;
+  return (input_size + 2 * pad - dilated_filter_size) / stride + 1;
+}
+
+void verifyConv(const ConvCase &c)
+{
+  const int output_height = outputSize(c.height, c.filter_height, c.stride, c.dilation, c.pad);
+  const int output_width = outputSize(c.width, c.filter_width, c.stride, c.dilation, c.pad);
+  const Shape input_shape{c.batches, c.height, c.width, c.input_depth};
+  const Shape filter_shape{c.output_depth, c.filter_height, c.filter_width, c.input_depth};
+  const Shape bias_shape{c.output_depth};
+  const Shape output_shape{c.batches, output_height, output_width, c.output_depth};
+
+  const auto input = makeData(input_shape.FlatSize(), 1);
+  const auto filter = makeData(filter_shape.FlatSize(), 2);
+  const auto bias = makeBias(c.output_depth);
+  std::vector<int32_t> multiplier, shift;
+  makeMultipliers(c.output_depth, &multiplier, &shift);
+
+  std::vector<int8_t> expected(output_shape.FlatSize());
+  for (int b = 0; b < c.batches; ++b)
+    for (int oy = 0; oy < output_height; ++oy)
+      for (int ox = 0; ox < output_width; ++ox)
+        for (int oc = 0; oc < c.output_depth; ++oc)
+        {
+          int32_t acc = bias[oc];
+          for (int fy = 0; fy < c.filter_height; ++fy)
+            for (int fx = 0; fx < c.filter_width; ++fx)
+            {
+              const int iy = oy * c.stride - c.pad + fy * c.dilation;
+              const int ix = ox * c.stride - c.pad + fx * c.dilation;
+              if (iy < 0 || iy >= c.height || ix < 0 || ix >= c.width)
+                continue;
+              for (int ic = 0; ic < c.input_depth; ++ic)
+                acc += (input[Offset(input_shape, b, iy, ix, ic)] - kInputZeroPoint) *
+                       filter[Offset(filter_shape, oc, fy, fx, ic)];
+            }
+          expected[Offset(output_shape, b, oy, ox, oc)] =
+              requantize(acc, multiplier[oc], shift[oc]);
+        }
+
+  nnfw::cker::ConvParams params;
+  params.padding_type = nnfw::cker::PaddingType::kSame;
+  params.padding_values.width = c.pad;
+  params.padding_values.height = c.pad;
+  params.stride_width = c.stride;
+  params.stride_height = c.stride;
+  params.dilation_width_factor = c.dilation;
+  params.dilation_height_factor = c.dilation;
+  params.input_offset = -kInputZeroPoint;
+  params.weights_offset = 0;
+  params.output_offset = kOutputZeroPoint;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+
+  // The second run reuses the filter prepared by the first one
+  nnfw::cker::Conv kernel;
+  kernel.prepareQuant(input_shape, filter_shape, output_shape, c.stride, c.stride);
+  for (int run = 0; run < 2; ++run)
+  {
+    std::vector<int8_t> output(output_shape.FlatSize());
+    kernel(params, multiplier.data(), shift.data(), input_shape, input.data(), filter_shape,
+           filter.data(), bias_shape, bias.data(), output_shape, output.data());
+    EXPECT_EQ(output, expected);
+  }
+}
+
+void verifyDepthwiseConv(const ConvCase &c)
+{
+  const int multiplier_depth = c.output_depth;
+  const int output_depth = c.input_depth * multiplier_depth;
+  const int output_height = outputSize(c.height, c.filter_height, c.stride, c.dilation, c.pad);
+  const int output_width = outputSize(c.width, c.filter_width, c.stride, c.dilation, c.pad);
+  const Shape input_shape{c.batches, c.height, c.width, c.input_depth};
+  const Shape filter_shape{1, c.filter_height, c.filter_width, output_depth};
+  const Shape bias_shape{output_depth};
+  const Shape output_shape{c.batches, output_height, output_width, output_depth};
+
+  const auto input = makeData(input_shape.FlatSize(), 3);
+  const auto filter = makeData(filter_shape.FlatSize(), 4);
+  const auto bias = makeBias(output_depth);
+  std::vector<int32_t> multiplier, shift;
+  makeMultipliers(output_depth, &multiplier, &shift);
+
+  std::vector<int8_t> expected(output_shape.FlatSize());
+  for (int b = 0; b < c.batches; ++b)
+    for (int oy = 0; oy < output_height; ++oy)
+      for (int ox = 0; ox < output_width; ++ox)
+        for (int oc = 0; oc < output_depth; ++oc)
+        {
+          const int ic = oc / multiplier_depth;
+          int32_t acc = bias[oc];
+          for (int fy = 0; fy < c.filter_height; ++fy)
+            for (int fx = 0; fx < c.filter_width; ++fx)
+            {
+              const int iy = oy * c.stride - c.pad + fy * c.dilation;
+              const int ix = ox * c.stride - c.pad + fx * c.dilation;
+              if (iy < 0 || iy >= c.height || ix < 0 || ix >= c.width)
+                continue;
+              acc += (input[Offset(input_shape, b, iy, ix, ic)] - kInputZeroPoint) *
+                     filter[Offset(filter_shape, 0, fy, fx, oc)];
+            }
+          expected[Offset(output_shape, b, oy, ox, oc)] =
+              requantize(acc, multiplier[oc], shift[oc]);
+        }
+
+  nnfw::cker::DepthwiseConvParams params;
+  params.padding_type = nnfw::cker::PaddingType::kSame;
+  params.padding_values.width = c.pad;
+  params.padding_values.height = c.pad;
+  params.stride_width = c.stride;
+  params.stride_height = c.stride;
+  params.dilation_width_factor = c.dilation;
+  params.dilation_height_factor = c.dilation;
+  params.depth_multiplier = multiplier_depth;
+  params.input_offset = -kInputZeroPoint;
+  params.weights_offset = 0;
+  params.output_offset = kOutputZeroPoint;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+
+  // The accumulators are reused across runs
+  std::vector<int32_t> acc_buffer(output_depth);
+  for (int run = 0; run < 2; ++run)
+  {
+    std::vector<int8_t> output(output_shape.FlatSize());
+    nnfw::cker::DepthwiseConvPerChannel(params, multiplier.data(), shift.data(), input_shape,
+                                        input.data(), filter_shape, filter.data(), bias_shape,
+                                        bias.data(), output_shape, output.data(),
+                                        acc_buffer.data());
+    EXPECT_EQ(output, expected);
+  }
+}
+
+void verifyFullyConnected(int batches, int input_depth, int output_depth)
+{
+  const Shape input_shape{batches, input_depth};
+  const Shape filter_shape{output_depth, input_depth};
+  const Shape output_shape{batches, output_depth};
+
+  const auto input = makeData(input_shape.FlatSize(), 5);
+  const auto filter = makeData(filter_shape.FlatSize(), 6);
+  const auto bias = makeBias(output_depth);
+  std::vector<int32_t> multiplier, shift;
+  makeMultipliers(output_depth, &multiplier, &shift);
+
+  std::vector<int8_t> expected(output_shape.FlatSize());
+  for (int b = 0; b < batches; ++b)
+    for (int oc = 0; oc < output_depth; ++oc)
+    {
+      int32_t acc = bias[oc];
+      for (int ic = 0; ic < input_depth; ++ic)
+        acc += (input[b * input_depth + ic] - kInputZeroPoint) * filter[oc * input_depth + ic];
+      expected[b * output_depth + oc] = requantize(acc, multiplier[oc], shift[oc]);
+    }
+
+  nnfw::cker::FullyConnectedParams params;
+  params.input_offset = -kInputZeroPoint;
+  params.weights_offset = 0;
+  params.output_offset = kOutputZeroPoint;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+
+  std::vector<int32_t> offset_terms;
+  nnfw::cker::PerChannelOffsetTerms(output_depth, input_depth, filter.data(), bias.data(),
+                                    params.input_offset, &offset_terms);
+
+  std::vector<int8_t> output(output_shape.FlatSize());
+  nnfw::cker::FullyConnectedPerChannel(params, multiplier.data(), shift.data(),
+                                       offset_terms.data(), input_shape, input.data(),
+                                       filter_shape, filter.data(), output_shape, output.data());
+
+  EXPECT_EQ(output, expected);
+}
+
+} // namespace
+
+TEST(CKer_Operation, ConvPerChannel)
+{
+  // batches, height, width, input_depth, filter_height, filter_width, output_depth, stride,
+  // dilation, pad
+  verifyConv({1, 5, 5, 3, 1, 1, 4, 1, 1, 0});
+  verifyConv({2, 6, 7, 4, 3, 3, 5, 1, 1, 1});
+  verifyConv({1, 9, 8, 3, 3, 3, 6, 2, 1, 1});
+  verifyConv({1, 7, 6, 2, 2, 3, 3, 1, 1, 0});
+  // Blocks of rows and the rest
+  verifyConv({1, 11, 13, 8, 3, 3, 16, 1, 1, 1});
+  // Reference kernel
+  verifyConv({1, 8, 8, 3, 3, 3, 4, 1, 2, 2});
+}
+
+TEST(CKer_Operation, DepthwiseConvPerChannel)
+{
+  // batches, height, width, input_depth, filter_height, filter_width, depth_multiplier, stride,
+  // dilation, pad
+  verifyDepthwiseConv({1, 5, 5, 3, 3, 3, 1, 1, 1, 1});
+  verifyDepthwiseConv({2, 6, 7, 4, 3, 3, 2, 2, 1, 1});
+  verifyDepthwiseConv({1, 8, 8, 2, 3, 2, 3, 1, 2, 2});
+}
+
+TEST(CKer_Operation, FullyConnectedPerChannel)
+{
+  verifyFullyConnected(1, 16, 4);
+  verifyFullyConnected(3, 37, 11);
+}
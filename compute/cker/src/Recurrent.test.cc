@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/LSTM.h>
+#include <cker/operation/RNN.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::FusedActivationFunctionType;
+using nnfw::cker::RecurrentWeight;
+using nnfw::cker::Shape;
+
+// Hybrid execution quantizes activations to 8 bits at every step
+constexpr float kTolerance = 0.03f;
+
+std::vector<float> makeData(int size, int seed, float range)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = range * (static_cast<float>((i * 37 + seed * 11) % 41) / 20.0f - 1.0f);
+  return data;
+}
+
+// Int8 weight with a symmetric scale, and the float weight it stands for
+struct QuantizedWeight
+{
+  QuantizedWeight(int size, int seed)
+  {
+    const auto data = makeData(size, seed, 0.5f);
+    float max = 0.0f;
+    for (auto value : data)
+      max = std::max(max, std::abs(value));
+    scale = max / 127.0f;
+    for (auto value : data)
+    {
+      quantized.push_back(static_cast<int8_t>(std::round(value / scale)));
+      dequantized.push_back(quantized.back() * scale);
+    }
+  }
+
+  RecurrentWeight<int8_t> hybrid() const { return {quantized.data(), scale}; }
+  RecurrentWeight<float> reference() const { return {dequantized.data(), 1.0f}; }
+
+  std::vector<int8_t> quantized;
+  std::vector<float> dequantized;
+  float scale;
+};
+
+void expectNear(const std::vector<float> &actual, const std::vector<float> &expected)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i)
+    EXPECT_NEAR(actual[i], expected[i], kTolerance) << "at " << i;
+}
+
+struct LSTMCase
+{
+  bool cifg;
+  bool peephole;
+  bool projection;
+};
+
+// Run float LSTM with dequantized weights and hybrid LSTM with int8 weights for a few steps
+void compareHybridLSTM(const LSTMCase &c)
+{
+  const int n_batch = 2;
+  const int n_input = 5;
+  const int n_cell = 4;
+  const int n_output = c.projection ? 3 : n_cell;
+  const int n_gates = c.cifg ? 3 : 4;
+
+  QuantizedWeight input_to_input{n_cell * n_input, 1};
+  QuantizedWeight input_to_forget{n_cell * n_input, 2};
+  QuantizedWeight input_to_cell{n_cell * n_input, 3};
+  QuantizedWeight input_to_output{n_cell * n_input, 4};
+  QuantizedWeight recurrent_to_input{n_cell * n_output, 5};
+  QuantizedWeight recurrent_to_forget{n_cell * n_output, 6};
+  QuantizedWeight recurrent_to_cell{n_cell * n_output, 7};
+  QuantizedWeight recurrent_to_output{n_cell * n_output, 8};
+  QuantizedWeight cell_to_input{n_cell, 9};
+  QuantizedWeight cell_to_forget{n_cell, 10};
+  QuantizedWeight cell_to_output{n_cell, 11};
+  QuantizedWeight projection{n_output * n_cell, 12};
+  const auto input_gate_bias = makeData(n_cell, 13, 0.1f);
+  const auto forget_gate_bias = makeData(n_cell, 14, 0.1f);
+  const auto cell_bias = makeData(n_cell, 15, 0.1f);
+  const auto output_gate_bias = makeData(n_cell, 16, 0.1f);
+  const auto projection_bias = makeData(n_output, 17, 0.1f);
+
+  nnfw::cker::LSTMWeights<int8_t> hybrid_weights;
+  nnfw::cker::LSTMWeights<float> float_weights;
+  auto set = [](RecurrentWeight<int8_t> &hybrid, RecurrentWeight<float> &reference,
+                const QuantizedWeight &weight) {
+    hybrid = weight.hybrid();
+    reference = weight.reference();
+  };
+  if (!c.cifg)
+  {
+    set(hybrid_weights.input_to_input, float_weights.input_to_input, input_to_input);
+    set(hybrid_weights.recurrent_to_input, float_weights.recurrent_to_input, recurrent_to_input);
+    hybrid_weights.input_gate_bias = float_weights.input_gate_bias = input_gate_bias.data();
+    if (c.peephole)
+      set(hybrid_weights.cell_to_input, float_weights.cell_to_input, cell_to_input);
+  }
+  set(hybrid_weights.input_to_forget, float_weights.input_to_forget, input_to_forget);
+  set(hybrid_weights.input_to_cell, float_weights.input_to_cell, input_to_cell);
+  set(hybrid_weights.input_to_output, float_weights.input_to_output, input_to_output);
+  set(hybrid_weights.recurrent_to_forget, float_weights.recurrent_to_forget, recurrent_to_forget);
+  set(hybrid_weights.recurrent_to_cell, float_weights.recurrent_to_cell, recurrent_to_cell);
+  set(hybrid_weights.recurrent_to_output, float_weights.recurrent_to_output, recurrent_to_output);
+  hybrid_weights.forget_gate_bias = float_weights.forget_gate_bias = forget_gate_bias.data();
+  hybrid_weights.cell_bias = float_weights.cell_bias = cell_bias.data();
+  hybrid_weights.output_gate_bias = float_weights.output_gate_bias = output_gate_bias.data();
+  if (c.peephole)
+  {
+    set(hybrid_weights.cell_to_forget, float_weights.cell_to_forget, cell_to_forget);
+    set(hybrid_weights.cell_to_output, float_weights.cell_to_output, cell_to_output);
+  }
+  if (c.projection)
+  {
+    set(hybrid_weights.projection, float_weights.projection, projection);
+    hybrid_weights.projection_bias = float_weights.projection_bias = projection_bias.data();
+  }
+
+  nnfw::cker::LSTM hybrid_lstm;
+  nnfw::cker::LSTM float_lstm;
+  hybrid_lstm.prepare(n_input, n_cell, n_output, hybrid_weights);
+  float_lstm.prepare(n_input, n_cell, n_output, float_weights);
+
+  nnfw::cker::LSTMParams params;
+  params.activation = FusedActivationFunctionType::kTanh;
+  params.cell_clip = 0.0f;
+  params.proj_clip = 0.0f;
+
+  const Shape input_shape{n_batch, n_input};
+  std::vector<float> scratch(n_batch * n_gates * n_cell);
+  std::vector<float> hybrid_output_state(n_batch * n_output);
+  std::vector<float> hybrid_cell_state(n_batch * n_cell);
+  std::vector<float> hybrid_output(n_batch * n_output);
+  std::vector<float> float_output_state(n_batch * n_output);
+  std::vector<float> float_cell_state(n_batch * n_cell);
+  std::vector<float> float_output(n_batch * n_output);
+  for (int step = 0; step < 3; ++step)
+  {
+    const auto input = makeData(n_batch * n_input, 20 + step, 1.0f);
+    hybrid_lstm(params, input_shape, input.data(), hybrid_output_state.data(),
+                hybrid_cell_state.data(), scratch.data(), hybrid_output_state.data(),
+                hybrid_cell_state.data(), hybrid_output.data());
+    float_lstm(params, input_shape, input.data(), float_output_state.data(),
+               float_cell_state.data(), scratch.data(), float_output_state.data(),
+               float_cell_state.data(), float_output.data());
+
+    expectNear(hybrid_cell_state, float_cell_state);
+    expectNear(hybrid_output, float_output);
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, HybridLSTM)
+{
+  compareHybridLSTM({false, false, false});
+}
+
+TEST(CKer_Operation, HybridLSTM_CIFG)
+{
+  compareHybridLSTM({true, false, false});
+}
+
+TEST(CKer_Operation, HybridLSTM_Peephole)
+{
+  compareHybridLSTM({false, true, false});
+  compareHybridLSTM({true, true, false});
+}
+
+TEST(CKer_Operation, HybridLSTM_Projection)
+{
+  compareHybridLSTM({false, false, true});
+  compareHybridLSTM({true, true, true});
+}
+
+TEST(CKer_Operation, HybridRNN)
+{
+  const int n_batch = 2;
+  const int n_input = 6;
+  const int n_units = 4;
+
+  QuantizedWeight weights{n_units * n_input, 1};
+  QuantizedWeight recurrent_weights{n_units * n_units, 2};
+  const auto bias = makeData(n_units, 3, 0.1f);
+
+  nnfw::cker::RNN hybrid_rnn;
+  nnfw::cker::RNN float_rnn;
+  hybrid_rnn.prepare(n_input, n_units, weights.hybrid(), recurrent_weights.hybrid());
+  float_rnn.prepare(n_input, n_units, weights.reference(), recurrent_weights.reference());
+
+  const Shape input_shape{n_batch, n_input};
+  std::vector<float> hybrid_hidden(n_batch * n_units);
+  std::vector<float> hybrid_output(n_batch * n_units);
+  std::vector<float> float_hidden(n_batch * n_units);
+  std::vector<float> float_output(n_batch * n_units);
+  for (int step = 0; step < 3; ++step)
+  {
+    const auto input = makeData(n_batch * n_input, 10 + step, 1.0f);
+    hybrid_rnn(FusedActivationFunctionType::kTanh, input_shape, input.data(),
+               hybrid_hidden.data(), bias.data(), hybrid_output.data(), hybrid_hidden.data());
+    float_rnn(FusedActivationFunctionType::kTanh, input_shape, input.data(), float_hidden.data(),
+              bias.data(), float_output.data(), float_hidden.data());
+
+    expectNear(hybrid_output, float_output);
+  }
+}
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ReduceMean.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+namespace optimized = nnfw::cker::optimized;
+
+Shape outputShape(const Shape &input_shape, const std::vector<int> &axes)
+{
+  Shape output_shape(input_shape);
+  for (auto axis : axes)
+    output_shape.SetDim(axis, 1);
+  return output_shape;
+}
+
+// Powers of two and zero, so that sums and products are exact in any order
+template <typename T> std::vector<T> makeData(int size)
+{
+  static const T values[] = {1, -2, 4, 0, -1, 2};
+  std::vector<T> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = values[(i * 7) % 6];
+  return data;
+}
+
+template <> std::vector<bool> makeData<bool>(int size)
+{
+  std::vector<bool> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = (i % 5 == 0);
+  return data;
+}
+
+// Value that no reduction of makeData() gives, to catch outputs left unwritten
+template <typename T, typename Reducer> T unwritten() { return std::numeric_limits<T>::max(); }
+
+template <> bool unwritten<bool, optimized::AnyReducer>() { return true; }
+template <> bool unwritten<bool, optimized::AllReducer>() { return false; }
+
+template <typename T, typename Reducer>
+std::vector<T> reduceReference(const Shape &input_shape, const T *input_data,
+                               const std::vector<int> &axes)
+{
+  const auto output_shape = outputShape(input_shape, axes);
+  const int size = output_shape.FlatSize();
+  std::unique_ptr<T[]> output(new T[size]);
+  nnfw::cker::Reduce reduce;
+  reduce.prepare(input_shape.DimensionsCount(), axes.size());
+  reduce.ReduceGeneric<T>(input_shape, input_data, output_shape, output.get(), axes, true,
+                          Reducer::Init(), Reducer::Apply);
+  return std::vector<T>(output.get(), output.get() + size);
+}
+
+template <typename T, typename Reducer>
+std::vector<T> reduceOptimized(const Shape &input_shape, const T *input_data,
+                               const std::vector<int> &axes)
+{
+  const int size = outputShape(input_shape, axes).FlatSize();
+  std::unique_ptr<T[]> output(new T[size]);
+  std::fill(output.get(), output.get() + size, unwritten<T, Reducer>());
+  optimized::ReduceDims dims;
+  EXPECT_TRUE(optimized::CollapseReduceDims(input_shape, axes.data(), axes.size(), &dims));
+  optimized::ReduceCollapsed<T, T, Reducer>(dims, input_data, output.get());
+  return std::vector<T>(output.get(), output.get() + size);
+}
+
+template <typename T, typename Reducer>
+void compareReduce(const Shape &input_shape, const std::vector<int> &axes)
+{
+  // std::vector<bool> has no data(), so plain arrays hold the buffers
+  const auto values = makeData<T>(input_shape.FlatSize());
+  std::unique_ptr<T[]> input(new T[std::max<size_t>(values.size(), 1)]);
+  std::copy(values.begin(), values.end(), input.get());
+
+  const auto expected = reduceReference<T, Reducer>(input_shape, input.get(), axes);
+  const auto actual = reduceOptimized<T, Reducer>(input_shape, input.get(), axes);
+  EXPECT_EQ(actual, expected);
+}
+
+template <typename T>
+void compareAllReducers(const Shape &input_shape, const std::vector<int> &axes)
+{
+  compareReduce<T, optimized::SumReducer<T>>(input_shape, axes);
+  compareReduce<T, optimized::ProdReducer<T>>(input_shape, axes);
+  compareReduce<T, optimized::MaxReducer<T>>(input_shape, axes);
+  compareReduce<T, optimized::MinReducer<T>>(input_shape, axes);
+}
+
+} // namespace
+
+TEST(CKer_Operation, ReduceCollapseDims)
+{
+  optimized::ReduceDims dims;
+  const Shape shape{2, 3, 4, 5};
+
+  const int inner[] = {3};
+  ASSERT_TRUE(optimized::CollapseReduceDims(shape, inner, 1, &dims));
+  EXPECT_EQ(dims.outer, 24);
+  EXPECT_EQ(dims.reduced, 5);
+  EXPECT_EQ(dims.inner, 1);
+
+  const int middle[] = {2, 1};
+  ASSERT_TRUE(optimized::CollapseReduceDims(shape, middle, 2, &dims));
+  EXPECT_EQ(dims.outer, 2);
+  EXPECT_EQ(dims.reduced, 12);
+  EXPECT_EQ(dims.inner, 5);
+
+  const int non_adjacent[] = {1, 3};
+  EXPECT_FALSE(optimized::CollapseReduceDims(shape, non_adjacent, 2, &dims));
+
+  // Dimensions of size 1 between reduced axes do not matter
+  const int across_one[] = {0, 2};
+  ASSERT_TRUE(optimized::CollapseReduceDims(Shape{2, 1, 4, 3}, across_one, 2, &dims));
+  EXPECT_EQ(dims.outer, 1);
+  EXPECT_EQ(dims.reduced, 8);
+  EXPECT_EQ(dims.inner, 3);
+
+  // Reducing only dimensions of size 1 reduces nothing
+  const int only_one[] = {1};
+  ASSERT_TRUE(optimized::CollapseReduceDims(Shape{2, 1, 3}, only_one, 1, &dims));
+  EXPECT_EQ(dims.outer, 6);
+  EXPECT_EQ(dims.reduced, 1);
+  EXPECT_EQ(dims.inner, 1);
+}
+
+TEST(CKer_Operation, ReduceCollapsed)
+{
+  const Shape shape{2, 3, 4, 5};
+  compareAllReducers<float>(shape, {3});    // Innermost
+  compareAllReducers<float>(shape, {0});    // Outermost
+  compareAllReducers<float>(shape, {1, 2}); // Middle
+  compareAllReducers<float>(shape, {0, 1, 2, 3});
+  compareAllReducers<int32_t>(shape, {2});
+
+  // Size 1 dimensions
+  compareAllReducers<float>(Shape{2, 1, 4, 3}, {0, 2});
+  compareAllReducers<float>(Shape{2, 1, 3}, {1});
+  compareAllReducers<float>(Shape{1, 5, 1}, {1});
+
+  // Inner dimension larger than a block
+  compareAllReducers<float>(Shape{3, 2, 1500}, {1});
+}
+
+TEST(CKer_Operation, ReduceCollapsed_ZeroSize)
+{
+  // Reduced dimension of size 0 gives the identity
+  optimized::ReduceDims dims;
+  const int axis[] = {1};
+  ASSERT_TRUE(optimized::CollapseReduceDims(Shape{2, 0, 3}, axis, 1, &dims));
+  EXPECT_EQ(dims.reduced, 0);
+  std::vector<float> output(6, -1.0f);
+  optimized::ReduceCollapsed<float, float, optimized::SumReducer<float>>(dims, nullptr,
+                                                                         output.data());
+  EXPECT_EQ(output, std::vector<float>(6, 0.0f));
+  optimized::ReduceCollapsed<float, float, optimized::ProdReducer<float>>(dims, nullptr,
+                                                                          output.data());
+  EXPECT_EQ(output, std::vector<float>(6, 1.0f));
+
+  // Kept dimension of size 0 gives no output
+  ASSERT_TRUE(optimized::CollapseReduceDims(Shape{0, 3}, axis, 1, &dims));
+  EXPECT_EQ(dims.outer, 0);
+  optimized::ReduceCollapsed<float, float, optimized::SumReducer<float>>(dims, nullptr, nullptr);
+}
+
+TEST(CKer_Operation, ReduceCollapsed_Bool)
+{
+  const Shape shape{2, 3, 4, 5};
+  for (const auto &axes : std::vector<std::vector<int>>{{3}, {0}, {1, 2}, {0, 1, 2, 3}})
+  {
+    compareReduce<bool, optimized::AnyReducer>(shape, axes);
+    compareReduce<bool, optimized::AllReducer>(shape, axes);
+  }
+  compareReduce<bool, optimized::AnyReducer>(Shape{2, 1, 3}, {1});
+  compareReduce<bool, optimized::AllReducer>(Shape{2, 1, 3}, {1});
+}
+
+TEST(CKer_Operation, ReduceWith_NonAdjacent)
+{
+  // Non-adjacent axes fall back to the generic kernel
+  const Shape shape{2, 3, 4, 5};
+  const std::vector<int> axes{1, 3};
+  const auto input = makeData<float>(shape.FlatSize());
+  const auto output_shape = outputShape(shape, axes);
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::Reduce reduce;
+  reduce.prepare(shape.DimensionsCount(), axes.size());
+  ASSERT_TRUE((reduce.ReduceWith<float, optimized::SumReducer<float>>(
+      shape, input.data(), output_shape, output.data(), axes, true)));
+  EXPECT_EQ(output,
+            (reduceReference<float, optimized::SumReducer<float>>(shape, input.data(), axes)));
+}
+
+TEST(CKer_Operation, ReduceMean)
+{
+  const Shape shape{2, 3, 4, 5};
+  const auto input = makeData<float>(shape.FlatSize());
+  for (auto axes : std::vector<std::vector<int>>{{3}, {0}, {1, 2}, {1, 3}})
+  {
+    const auto output_shape = outputShape(shape, axes);
+    std::vector<float> actual(output_shape.FlatSize());
+    nnfw::cker::Mean<float, float>(shape, input.data(), output_shape, actual.data(), axes);
+
+    // Mean of each output from the reduced elements
+    std::vector<float> sum = reduceReference<float, optimized::SumReducer<float>>(
+        shape, input.data(), axes);
+    int count = 1;
+    for (auto axis : axes)
+      count *= shape.Dims(axis);
+    for (size_t i = 0; i < sum.size(); ++i)
+      EXPECT_FLOAT_EQ(actual[i], sum[i] / count);
+  }
+}
+
+TEST(CKer_Operation, ReduceMean_Quant8)
+{
+  const Shape shape{2, 3, 4, 5};
+  std::vector<uint8_t> input(shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<uint8_t>((i * 37) % 256);
+
+  const float input_scale = 0.5f;
+  const int32_t input_offset = 3;
+  const float output_scale = 0.25f;
+  const int32_t output_offset = 10;
+  for (auto axes : std::vector<std::vector<int>>{{3}, {0}, {1, 2}, {1, 3}})
+  {
+    const auto output_shape = outputShape(shape, axes);
+    std::vector<uint8_t> actual(output_shape.FlatSize());
+    nnfw::cker::MeanQ8Asymm<uint8_t, uint8_t>(shape, input.data(), input_scale, input_offset,
+                                              output_shape, actual.data(), output_scale,
+                                              output_offset, axes);
+
+    // Requantized mean of the integer sums
+    std::vector<int32_t> input_int(input.begin(), input.end());
+    const auto sum = reduceReference<int32_t, optimized::SumReducer<int32_t>>(
+        shape, input_int.data(), axes);
+    int count = 1;
+    for (auto axis : axes)
+      count *= shape.Dims(axis);
+    const float scale = input_scale / output_scale;
+    for (size_t i = 0; i < sum.size(); ++i)
+    {
+      const float mean = static_cast<float>(sum[i]) / count;
+      float expected = nnfw::cker::round_nearest(mean * scale - input_offset * scale +
+                                                 output_offset);
+      expected = std::max(0.0f, std::min(255.0f, expected));
+      EXPECT_EQ(actual[i], static_cast<uint8_t>(expected)) << "at " << i;
+    }
+  }
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/SeparableConv.h>
+#include <cker/operation/reference/Conv.h>
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+struct SeparableConvCase
+{
+  int batches;
+  int height;
+  int width;
+  int input_depth;
+  int multiplier;
+  int filter_height;
+  int filter_width;
+  int stride;
+  int dilation;
+  int pad;
+  int output_depth;
+};
+
+std::vector<float> makeData(int size, int seed)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 7 + seed * 13) % 17 - 8) / 8.0f;
+  return data;
+}
+
+// Runs SeparableConv and compares it to DepthwiseConv followed by 1x1 reference Conv
+void verifySeparableConv(const SeparableConvCase &c)
+{
+  const int depth = c.input_depth * c.multiplier;
+  const int dilated_filter_height = (c.filter_height - 1) * c.dilation + 1;
+  const int dilated_filter_width = (c.filter_width - 1) * c.dilation + 1;
+  const int output_height = (c.height + 2 * c.pad - dilated_filter_height) / c.stride + 1;
+  const int output_width = (c.width + 2 * c.pad - dilated_filter_width) / c.stride + 1;
+
+  const Shape input_shape{c.batches, c.height, c.width, c.input_depth};
+  const Shape dw_filter_shape{1, c.filter_height, c.filter_width, depth};
+  const Shape dw_bias_shape{depth};
+  const Shape dw_output_shape{c.batches, output_height, output_width, depth};
+  const Shape pw_filter_shape{c.output_depth, 1, 1, depth};
+  const Shape pw_bias_shape{c.output_depth};
+  const Shape output_shape{c.batches, output_height, output_width, c.output_depth};
+
+  const auto input = makeData(input_shape.FlatSize(), 1);
+  const auto dw_filter = makeData(dw_filter_shape.FlatSize(), 2);
+  const auto dw_bias = makeData(depth, 3);
+  const auto pw_filter = makeData(pw_filter_shape.FlatSize(), 4);
+  const auto pw_bias = makeData(c.output_depth, 5);
+
+  nnfw::cker::DepthwiseConvParams dw_params;
+  dw_params.padding_type = nnfw::cker::PaddingType::kSame;
+  dw_params.padding_values.width = c.pad;
+  dw_params.padding_values.height = c.pad;
+  dw_params.stride_width = c.stride;
+  dw_params.stride_height = c.stride;
+  dw_params.dilation_width_factor = c.dilation;
+  dw_params.dilation_height_factor = c.dilation;
+  dw_params.depth_multiplier = c.multiplier;
+  dw_params.float_activation_min = 0.0f;
+  dw_params.float_activation_max = 6.0f;
+
+  nnfw::cker::ConvParams pw_params;
+  pw_params.padding_type = nnfw::cker::PaddingType::kValid;
+  pw_params.padding_values.width = 0;
+  pw_params.padding_values.height = 0;
+  pw_params.stride_width = 1;
+  pw_params.stride_height = 1;
+  pw_params.dilation_width_factor = 1;
+  pw_params.dilation_height_factor = 1;
+  pw_params.float_activation_min = -1.0f;
+  pw_params.float_activation_max = std::numeric_limits<float>::max();
+
+  std::vector<float> dw_output(dw_output_shape.FlatSize());
+  nnfw::cker::DepthwiseConv(dw_params, input_shape, input.data(), dw_filter_shape,
+                            dw_filter.data(), dw_bias_shape, dw_bias.data(), dw_output_shape,
+                            dw_output.data());
+  std::vector<float> expected(output_shape.FlatSize());
+  nnfw::cker::reference::Conv(pw_params, dw_output_shape, dw_output.data(), pw_filter_shape,
+                              pw_filter.data(), pw_bias_shape, pw_bias.data(), output_shape,
+                              expected.data());
+
+  nnfw::cker::SeparableConvParams params;
+  params.padding_type = dw_params.padding_type;
+  params.padding_values = dw_params.padding_values;
+  params.stride_width = dw_params.stride_width;
+  params.stride_height = dw_params.stride_height;
+  params.dilation_width_factor = dw_params.dilation_width_factor;
+  params.dilation_height_factor = dw_params.dilation_height_factor;
+  params.depth_multiplier = dw_params.depth_multiplier;
+  params.depthwise_activation_min = dw_params.float_activation_min;
+  params.depthwise_activation_max = dw_params.float_activation_max;
+  params.float_activation_min = pw_params.float_activation_min;
+  params.float_activation_max = pw_params.float_activation_max;
+
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::SeparableConv(params, input_shape, input.data(), dw_filter_shape, dw_filter.data(),
+                            dw_bias_shape, dw_bias.data(), pw_filter_shape, pw_filter.data(),
+                            pw_bias_shape, pw_bias.data(), output_shape, output.data());
+
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-4f) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, SeparableConv)
+{
+  // batches, height, width, input_depth, multiplier, filter_height, filter_width, stride,
+  // dilation, pad, output_depth
+  verifySeparableConv({1, 4, 4, 2, 1, 3, 3, 1, 1, 1, 3});
+  verifySeparableConv({2, 5, 7, 3, 2, 3, 3, 1, 1, 1, 4});
+  verifySeparableConv({1, 9, 8, 4, 1, 3, 3, 2, 1, 1, 5});
+  verifySeparableConv({1, 8, 8, 2, 3, 3, 2, 1, 2, 2, 3});
+  verifySeparableConv({3, 6, 5, 5, 1, 5, 5, 1, 1, 0, 2});
+}
+
+TEST(CKer_Operation, SeparableConvTiled)
+{
+  // Depthwise result of a batch does not fit into one tile
+  verifySeparableConv({2, 30, 64, 32, 1, 3, 3, 1, 1, 1, 16});
+  verifySeparableConv({1, 45, 33, 16, 2, 3, 3, 1, 1, 1, 24});
+}
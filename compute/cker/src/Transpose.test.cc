@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+using nnfw::cker::TransposeParams;
+
+TransposeParams makeParams(const std::vector<int> &perm)
+{
+  TransposeParams params;
+  params.perm_count = static_cast<int8_t>(perm.size());
+  for (size_t i = 0; i < perm.size(); ++i)
+    params.perm[i] = perm[i];
+  return params;
+}
+
+Shape makeShape(const std::vector<int> &dims)
+{
+  return Shape(static_cast<int>(dims.size()), dims.data());
+}
+
+// Naive transpose of any rank, since reference::Transpose supports up to rank 4
+template <typename T>
+std::vector<T> naiveTranspose(const std::vector<int> &dims, const std::vector<int> &perm,
+                              const std::vector<T> &input)
+{
+  const int rank = static_cast<int>(dims.size());
+  std::vector<int> input_strides(rank, 1);
+  for (int d = rank - 2; d >= 0; --d)
+    input_strides[d] = input_strides[d + 1] * dims[d + 1];
+
+  std::vector<T> output(input.size());
+  std::vector<int> out_index(rank, 0);
+  for (size_t o = 0; o < output.size(); ++o)
+  {
+    int input_offset = 0;
+    for (int i = 0; i < rank; ++i)
+      input_offset += out_index[i] * input_strides[perm[i]];
+    output[o] = input[input_offset];
+
+    for (int i = rank - 1; i >= 0; --i)
+    {
+      if (++out_index[i] < dims[perm[i]])
+        break;
+      out_index[i] = 0;
+    }
+  }
+  return output;
+}
+
+template <typename T>
+void verifyTranspose(const std::vector<int> &dims, const std::vector<int> &perm)
+{
+  std::vector<int> output_dims(dims.size());
+  for (size_t i = 0; i < perm.size(); ++i)
+    output_dims[i] = dims[perm[i]];
+
+  const auto params = makeParams(perm);
+  const auto input_shape = makeShape(dims);
+  const auto output_shape = makeShape(output_dims);
+
+  std::vector<T> input(input_shape.FlatSize());
+  std::iota(input.begin(), input.end(), static_cast<T>(1));
+
+  std::vector<T> expected;
+  if (dims.size() <= 4)
+  {
+    expected.resize(input.size());
+    nnfw::cker::reference::Transpose(params, input_shape, input.data(), output_shape,
+                                     expected.data());
+  }
+  else
+  {
+    expected = naiveTranspose(dims, perm, input);
+  }
+
+  std::vector<T> output(input.size());
+  nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, output.data());
+
+  EXPECT_EQ(output, expected);
+}
+
+// All permutations of the given rank
+std::vector<std::vector<int>> allPerms(int rank)
+{
+  std::vector<int> perm(rank);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::vector<std::vector<int>> perms;
+  do
+  {
+    perms.emplace_back(perm);
+  } while (std::next_permutation(perm.begin(), perm.end()));
+  return perms;
+}
+
+} // namespace
+
+TEST(CKer_Operation, Transpose2D)
+{
+  // Tiles of 4x4 and the rest
+  for (const auto &dims : std::vector<std::vector<int>>{{4, 8}, {5, 7}, {13, 3}, {1, 9}, {1, 1}})
+  {
+    verifyTranspose<float>(dims, {1, 0});
+    verifyTranspose<int32_t>(dims, {1, 0});
+    verifyTranspose<uint8_t>(dims, {1, 0});
+    verifyTranspose<int16_t>(dims, {1, 0});
+  }
+}
+
+TEST(CKer_Operation, Transpose3D4D)
+{
+  for (const auto &dims : std::vector<std::vector<int>>{{2, 5, 7}, {3, 1, 6}, {1, 4, 9}})
+  {
+    for (const auto &perm : allPerms(3))
+    {
+      verifyTranspose<float>(dims, perm);
+      verifyTranspose<uint8_t>(dims, perm);
+    }
+  }
+
+  for (const auto &dims : std::vector<std::vector<int>>{{2, 3, 5, 7}, {1, 6, 1, 5}, {3, 4, 4, 1}})
+  {
+    for (const auto &perm : allPerms(4))
+    {
+      verifyTranspose<float>(dims, perm);
+      verifyTranspose<int8_t>(dims, perm);
+      verifyTranspose<int64_t>(dims, perm);
+    }
+  }
+}
+
+TEST(CKer_Operation, Transpose5D6D)
+{
+  for (const auto &dims : std::vector<std::vector<int>>{{2, 3, 1, 5, 6}, {3, 1, 2, 7, 5}})
+  {
+    for (const auto &perm : allPerms(5))
+    {
+      verifyTranspose<float>(dims, perm);
+      verifyTranspose<uint8_t>(dims, perm);
+    }
+  }
+
+  for (const auto &dims : std::vector<std::vector<int>>{{2, 1, 3, 2, 5, 3}, {1, 2, 3, 1, 2, 5}})
+  {
+    for (const auto &perm : allPerms(6))
+    {
+      verifyTranspose<float>(dims, perm);
+      verifyTranspose<int16_t>(dims, perm);
+    }
+  }
+}
+
+TEST(CKer_Operation, TransposeLarge)
+{
+  // Large enough to be split over threads
+  verifyTranspose<float>({67, 131}, {1, 0});
+  verifyTranspose<float>({3, 37, 41, 2}, {0, 2, 1, 3});
+  verifyTranspose<uint8_t>({5, 63, 65}, {2, 0, 1});
+}
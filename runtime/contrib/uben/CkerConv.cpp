@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Float Conv2D benchmark of cker kernels
+ *
+ * Shapes are given as parameters, e.g. "-p IFM_H:112 -p IFM_W:112 -p IFM_C:32 -p OFM_C:64"
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/Conv.h>
+
+#include <limits>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(IFM_H, 56);
+NONIUS_PARAM(IFM_W, 56);
+NONIUS_PARAM(IFM_C, 64);
+NONIUS_PARAM(OFM_C, 64);
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+NONIUS_PARAM(STRIDE, 1);
+// Explicit padding size on each side
+NONIUS_PARAM(PAD, 1);
+
+//
+// Helpers
+//
+namespace
+{
+
+struct Conv2DData
+{
+  nnfw::cker::ConvParams params;
+
+  nnfw::cker::Shape ifm_shape;
+  nnfw::cker::Shape ker_shape;
+  nnfw::cker::Shape bias_shape;
+  nnfw::cker::Shape ofm_shape;
+
+  std::vector<float> ifm;
+  std::vector<float> ker;
+  std::vector<float> bias;
+  std::vector<float> ofm;
+};
+
+Conv2DData make_data(nonius::chronometer &meter)
+{
+  const int ifm_h = meter.param<IFM_H>();
+  const int ifm_w = meter.param<IFM_W>();
+  const int ifm_c = meter.param<IFM_C>();
+  const int ofm_c = meter.param<OFM_C>();
+  const int ker_h = meter.param<KER_H>();
+  const int ker_w = meter.param<KER_W>();
+  const int stride = meter.param<STRIDE>();
+  const int pad = meter.param<PAD>();
+
+  const int ofm_h = (ifm_h + 2 * pad - ker_h) / stride + 1;
+  const int ofm_w = (ifm_w + 2 * pad - ker_w) / stride + 1;
+
+  Conv2DData data;
+
+  data.params.padding_type = nnfw::cker::PaddingType::kNone;
+  data.params.padding_values.height = pad;
+  data.params.padding_values.width = pad;
+  data.params.stride_height = stride;
+  data.params.stride_width = stride;
+  data.params.dilation_height_factor = 1;
+  data.params.dilation_width_factor = 1;
+  data.params.float_activation_min = std::numeric_limits<float>::lowest();
+  data.params.float_activation_max = std::numeric_limits<float>::max();
+
+  data.ifm_shape = nnfw::cker::Shape{1, ifm_h, ifm_w, ifm_c};
+  data.ker_shape = nnfw::cker::Shape{ofm_c, ker_h, ker_w, ifm_c};
+  data.bias_shape = nnfw::cker::Shape{ofm_c};
+  data.ofm_shape = nnfw::cker::Shape{1, ofm_h, ofm_w, ofm_c};
+
+  data.ifm.resize(data.ifm_shape.FlatSize(), 1.0f);
+  data.ker.resize(data.ker_shape.FlatSize(), 0.5f);
+  data.bias.resize(data.bias_shape.FlatSize(), 0.0f);
+  data.ofm.resize(data.ofm_shape.FlatSize());
+
+  return data;
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("cker::reference::Conv(float)", [](nonius::chronometer meter) {
+  auto d = make_data(meter);
+
+  meter.measure([&](int) {
+    nnfw::cker::reference::Conv(d.params, d.ifm_shape, d.ifm.data(), d.ker_shape, d.ker.data(),
+                                d.bias_shape, d.bias.data(), d.ofm_shape, d.ofm.data());
+  });
+})
+
+NONIUS_BENCHMARK("cker::Conv(float)", [](nonius::chronometer meter) {
+  auto d = make_data(meter);
+
+  nnfw::cker::Conv conv;
+  bool is_replaced_weights = false;
+  // Filter packing is a one-time cost, so it is not measured
+  conv.prepare(d.ker_shape, d.ker.data(), d.params.padding_type, is_replaced_weights);
+
+  meter.measure([&](int) {
+    conv(d.params, d.ifm_shape, d.ifm.data(), d.ker_shape, d.ker.data(), d.bias_shape,
+         d.bias.data(), d.ofm_shape, d.ofm.data());
+  });
+})
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Float Transpose benchmark of cker kernels
+ *
+ * Permutations are the ones found in our models, e.g. splitting attention heads and layout
+ * conversion between NHWC and NCHW
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/Transpose.h>
+
+#include <vector>
+
+//
+// Helpers
+//
+namespace
+{
+
+struct TransposeData
+{
+  nnfw::cker::TransposeParams params;
+
+  nnfw::cker::Shape input_shape;
+  nnfw::cker::Shape output_shape;
+
+  std::vector<float> input;
+  std::vector<float> output;
+};
+
+TransposeData make_data(const std::vector<int> &input_dims, const std::vector<int> &perm)
+{
+  TransposeData data;
+
+  const int rank = input_dims.size();
+  std::vector<int> output_dims(rank);
+  data.params.perm_count = rank;
+  for (int i = 0; i < rank; ++i)
+  {
+    data.params.perm[i] = perm[i];
+    output_dims[i] = input_dims[perm[i]];
+  }
+
+  data.input_shape.ReplaceWith(rank, input_dims.data());
+  data.output_shape.ReplaceWith(rank, output_dims.data());
+
+  data.input.resize(data.input_shape.FlatSize(), 1.0f);
+  data.output.resize(data.output_shape.FlatSize());
+
+  return data;
+}
+
+void run_reference(nonius::chronometer &meter, const std::vector<int> &input_dims,
+                   const std::vector<int> &perm)
+{
+  auto d = make_data(input_dims, perm);
+
+  meter.measure([&](int) {
+    nnfw::cker::reference::Transpose(d.params, d.input_shape, d.input.data(), d.output_shape,
+                                     d.output.data());
+  });
+}
+
+void run(nonius::chronometer &meter, const std::vector<int> &input_dims,
+         const std::vector<int> &perm)
+{
+  auto d = make_data(input_dims, perm);
+
+  meter.measure([&](int) {
+    nnfw::cker::Transpose(d.params, d.input_shape, d.input.data(), d.output_shape,
+                          d.output.data());
+  });
+}
+
+} // namespace
+
+//
+// Implementations
+//
+
+// Split attention heads: [batch, seq, heads, depth] -> [batch, heads, seq, depth]
+NONIUS_BENCHMARK("cker::reference::Transpose(float) [1,128,12,64] perm [0,2,1,3]",
+                 [](nonius::chronometer meter) {
+                   run_reference(meter, {1, 128, 12, 64}, {0, 2, 1, 3});
+                 })
+
+NONIUS_BENCHMARK("cker::Transpose(float) [1,128,12,64] perm [0,2,1,3]",
+                 [](nonius::chronometer meter) {
+                   run(meter, {1, 128, 12, 64}, {0, 2, 1, 3});
+                 })
+
+// Attention scores: K^T of [batch, heads, seq, depth]
+NONIUS_BENCHMARK("cker::reference::Transpose(float) [1,12,128,64] perm [0,1,3,2]",
+                 [](nonius::chronometer meter) {
+                   run_reference(meter, {1, 12, 128, 64}, {0, 1, 3, 2});
+                 })
+
+NONIUS_BENCHMARK("cker::Transpose(float) [1,12,128,64] perm [0,1,3,2]",
+                 [](nonius::chronometer meter) {
+                   run(meter, {1, 12, 128, 64}, {0, 1, 3, 2});
+                 })
+
+// NHWC -> NCHW
+NONIUS_BENCHMARK("cker::reference::Transpose(float) [1,56,56,64] perm [0,3,1,2]",
+                 [](nonius::chronometer meter) {
+                   run_reference(meter, {1, 56, 56, 64}, {0, 3, 1, 2});
+                 })
+
+NONIUS_BENCHMARK("cker::Transpose(float) [1,56,56,64] perm [0,3,1,2]",
+                 [](nonius::chronometer meter) {
+                   run(meter, {1, 56, 56, 64}, {0, 3, 1, 2});
+                 })
+
+// NCHW -> NHWC
+NONIUS_BENCHMARK("cker::reference::Transpose(float) [1,64,56,56] perm [0,2,3,1]",
+                 [](nonius::chronometer meter) {
+                   run_reference(meter, {1, 64, 56, 56}, {0, 2, 3, 1});
+                 })
+
+NONIUS_BENCHMARK("cker::Transpose(float) [1,64,56,56] perm [0,2,3,1]",
+                 [](nonius::chronometer meter) {
+                   run(meter, {1, 64, 56, 56}, {0, 2, 3, 1});
+                 })
+
+// Matrix transpose of fully connected weights
+NONIUS_BENCHMARK("cker::reference::Transpose(float) [768,3072] perm [1,0]",
+                 [](nonius::chronometer meter) {
+                   run_reference(meter, {768, 3072}, {1, 0});
+                 })
+
+NONIUS_BENCHMARK("cker::Transpose(float) [768,3072] perm [1,0]",
+                 [](nonius::chronometer meter) {
+                   run(meter, {768, 3072}, {1, 0});
+                 })
+
+// Rank 5 and 6 permutations are not supported by the reference kernel
+NONIUS_BENCHMARK("cker::Transpose(float) [1,8,32,32,16] perm [0,4,2,3,1]",
+                 [](nonius::chronometer meter) {
+                   run(meter, {1, 8, 32, 32, 16}, {0, 4, 2, 3, 1});
+                 })
+
+NONIUS_BENCHMARK("cker::Transpose(float) [2,4,16,4,16,8] perm [0,1,3,2,5,4]",
+                 [](nonius::chronometer meter) {
+                   run(meter, {2, 4, 16, 4, 16, 8}, {0, 1, 3, 2, 5, 4});
+                 })
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Executor scheduling overhead benchmark
+ *
+ * Runs a wide graph of tiny Add operations, so that the time is dominated by job scheduling.
+ * Divide the measured time by WIDTH * DEPTH to get the overhead per operation.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <compiler/Compiler.h>
+#include <exec/Execution.h>
+#include <ir/Graph.h>
+#include <ir/operation/Add.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(WIDTH, 64);
+NONIUS_PARAM(DEPTH, 4);
+NONIUS_PARAM(THREADS, 0);
+
+namespace
+{
+
+using namespace onert;
+
+/**
+ * @brief Build WIDTH independent chains of DEPTH Add operations on a single element
+ *
+ *        in -> Add -> Add -> ... -> out[0]
+ *        in -> Add -> Add -> ... -> out[1]
+ *        ...
+ */
+std::shared_ptr<ir::Graph> buildWideGraph(int width, int depth)
+{
+  static float one = 1.0f;
+
+  auto graph = std::make_shared<ir::Graph>();
+  ir::Shape shape{1};
+  ir::TypeInfo type{ir::DataType::FLOAT32};
+
+  auto input = graph->addOperand(shape, type);
+  auto constant = graph->addOperand(shape, type);
+  graph->operands().at(constant).data(
+      std::make_unique<ir::CachedData>(reinterpret_cast<const uint8_t *>(&one), sizeof(float)));
+  graph->addInput(input);
+
+  ir::operation::Add::Param param;
+  param.activation = ir::Activation::NONE;
+  for (int w = 0; w < width; ++w)
+  {
+    auto lhs = input;
+    for (int d = 0; d < depth; ++d)
+    {
+      auto result = graph->addOperand(shape, type);
+      graph->addOperation(std::make_unique<ir::operation::Add>(
+          ir::OperandIndexSequence{lhs, constant}, ir::OperandIndexSequence{result}, param));
+      lhs = result;
+    }
+    graph->addOutput(lhs);
+  }
+  graph->finishBuilding();
+
+  return graph;
+}
+
+std::shared_ptr<exec::ExecutorMap> compile(const std::shared_ptr<ir::Graph> &graph,
+                                           const std::string &executor, int threads)
+{
+  auto subgs = std::make_shared<ir::Subgraphs>();
+  subgs->push(ir::SubgraphIndex{0}, graph);
+
+  compiler::Compiler compiler{subgs};
+  auto &options = compiler.options();
+  options.backend_list = {"cpu"};
+  options.executor = executor;
+  // A job per operation
+  options.op_seq_max_node = 1;
+  options.parallel_threads["cpu"] = threads > 0 ? threads : 1;
+  options.work_stealing_threads = threads;
+  compiler.compile();
+
+  std::shared_ptr<exec::ExecutorMap> executors;
+  compiler.release(executors);
+  return executors;
+}
+
+void run(nonius::chronometer &meter, const std::string &executor)
+{
+  const auto width = meter.param<WIDTH>();
+  const auto depth = meter.param<DEPTH>();
+
+  auto graph = buildWideGraph(width, depth);
+  auto executors = compile(graph, executor, meter.param<THREADS>());
+
+  float input = 0.0f;
+  std::vector<float> outputs(width);
+
+  exec::Execution execution{executors};
+  execution.setInput(ir::IOIndex{0}, &input, sizeof(float));
+  for (int w = 0; w < width; ++w)
+  {
+    execution.setOutput(ir::IOIndex{static_cast<uint32_t>(w)}, &outputs[w], sizeof(float));
+  }
+
+  meter.measure([&](int) {
+    // Run!
+    execution.execute();
+  });
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("Executor(Linear)", [](nonius::chronometer meter) { run(meter, "Linear"); })
+
+NONIUS_BENCHMARK("Executor(Dataflow)", [](nonius::chronometer meter) { run(meter, "Dataflow"); })
+
+NONIUS_BENCHMARK("Executor(Parallel)", [](nonius::chronometer meter) { run(meter, "Parallel"); })
+
+NONIUS_BENCHMARK("Executor(WorkStealing)",
+                 [](nonius::chronometer meter) { run(meter, "WorkStealing"); })
@@ -77,6 +77,7 @@ private:
 };
 
 template <> uint8_t RandomGenerator::generate<uint8_t>(void);
+template <> int8_t RandomGenerator::generate<int8_t>(void);
 template <> bool RandomGenerator::generate<bool>(void);
 template <> int32_t RandomGenerator::generate<int32_t>(void);
 
@@ -49,6 +49,12 @@ template <> uint8_t RandomGenerator::generate<uint8_t>(void)
   return static_cast<uint8_t>(shifted_relative_val);
 }
 
+template <> int8_t RandomGenerator::generate<int8_t>(void)
+{
+  // Same distribution as uint8_t, shifted to be centered around 0
+  return static_cast<int8_t>(static_cast<int32_t>(generate<uint8_t>()) - 128);
+}
+
 template <> bool RandomGenerator::generate<bool>(void)
 {
   std::uniform_int_distribution<> dist(0, 1); // [0, 1]
@@ -79,6 +79,12 @@ typedef enum {
   NNFW_TYPE_TENSOR_BOOL = 3,
   /** A tensor of 8 bit unsigned integer */
   NNFW_TYPE_TENSOR_UINT8 = 4,
+  /**
+   * A tensor of 8 bit signed integers that represent real numbers.
+   *
+   * real_value = (integer_value - zeroPoint) * scale.
+   */
+  NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED = 5,
 } NNFW_TYPE;
 
 /**
@@ -186,6 +192,21 @@ NNFW_STATUS nnfw_close_session(nnfw_session *session);
  */
 NNFW_STATUS nnfw_load_model_from_file(nnfw_session *session, const char *package_file_path);
 
+/**
+ * @brief     Load the model already loaded by another session
+ *
+ * The loaded graph and its constant data are shared with \p source instead of being loaded again.
+ * Weights rearranged by kernels for faster execution are shared as well when the sessions use the
+ * same backend, so only tensors for intermediate results are allocated per session.
+ * \p source can be in any state after its model is loaded, and can be closed before \p session.
+ *
+ * @param[in] session nnfw_session to load the model into
+ * @param[in] source  nnfw_session which has loaded the model to be shared
+ *
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_load_model_from_session(nnfw_session *session, const nnfw_session *source);
+
 /**
  * @brief     Apply i-th input's tensor info to resize input tensor
  *
@@ -252,6 +273,32 @@ NNFW_STATUS nnfw_prepare(nnfw_session *session);
  */
 NNFW_STATUS nnfw_run(nnfw_session *session);
 
+/**
+ * @brief     Run inference asynchronously
+ *
+ * <p>This function returns after inference is started. Call {@link nnfw_await} to wait for the
+ * inference to finish. Input and output buffers must be kept alive until then.</p>
+ *
+ * <p>A session has as many execution contexts as the config EXECUTION_CONTEXTS given before
+ * {@link nnfw_prepare}, 1 by default. Each context has its own input and output settings and
+ * memory for intermediate tensors, while weights are shared. After this call, the next context
+ * becomes the one that {@link nnfw_set_input}, {@link nnfw_set_output} and running functions
+ * apply to, so that the next inference can be set up while this one runs. If the next context is
+ * still running, those functions fail until it is awaited.</p>
+ *
+ * @param[in] session The session to run inference
+ * @return    @c NNFW_STATUS_NO_ERROR if inference is started successfully
+ */
+NNFW_STATUS nnfw_run_async(nnfw_session *session);
+
+/**
+ * @brief     Wait for the oldest inference started by {@link nnfw_run_async} to finish
+ *
+ * @param[in] session The session to wait for
+ * @return    @c NNFW_STATUS_NO_ERROR if the inference is finished successfully
+ */
+NNFW_STATUS nnfw_await(nnfw_session *session);
+
 /**
  * @brief     Set input buffer
  *
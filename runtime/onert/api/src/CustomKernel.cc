@@ -54,6 +54,9 @@ public:
       case ir::DataType::QUANT_UINT8_ASYMM:
         api_type.dtype = NNFW_TYPE_TENSOR_QUANT8_ASYMM;
         break;
+      case ir::DataType::QUANT_INT8_ASYMM:
+        api_type.dtype = NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED;
+        break;
       case ir::DataType::BOOL8:
         api_type.dtype = NNFW_TYPE_TENSOR_BOOL;
         break;
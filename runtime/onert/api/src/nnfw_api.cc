@@ -26,6 +26,7 @@ STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_INT32, 1);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_QUANT8_ASYMM, 2);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_BOOL, 3);
 STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_UINT8, 4);
+STATIC_ASSERT_ENUM_CHECK(NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED, 5);
 STATIC_ASSERT_ENUM_CHECK(NNFW_STATUS_NO_ERROR, 0);
 STATIC_ASSERT_ENUM_CHECK(NNFW_STATUS_ERROR, 1);
 STATIC_ASSERT_ENUM_CHECK(NNFW_LAYOUT_NONE, 0);
@@ -83,6 +84,20 @@ NNFW_STATUS nnfw_load_model_from_file(nnfw_session *session, const char *pacakge
   return session->load_model_from_file(pacakge_file_path);
 }
 
+/*
+ * Load the model which is loaded by another session, sharing its graph and constant data
+ *
+ * @param session nnfw_session loading the model
+ * @param source nnfw_session which has loaded the model
+ *
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_load_model_from_session(nnfw_session *session, const nnfw_session *source)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->load_model_from_session(source);
+}
+
 /*
  * Prepare session to be ready for inference
  * This phase may finalize model compilation, scheduling, and additional settings.
@@ -108,6 +123,30 @@ NNFW_STATUS nnfw_run(nnfw_session *session)
   return session->run();
 }
 
+/*
+ * Start inference asynchronously
+ *
+ * @param session the session to run inference
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_run_async(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->run_async();
+}
+
+/*
+ * Wait for the oldest asynchronous inference to finish
+ *
+ * @param session the session to wait for
+ * @return NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_await(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->await();
+}
+
 /*
  * Set input
  *
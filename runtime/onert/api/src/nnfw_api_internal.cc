@@ -16,17 +16,22 @@
 
 #include "nnfw_api_internal.h"
 #include "CustomKernelRegistry.h"
+#include "compiler/CompiledArtifact.h"
 #include "compiler/Compiler.h"
 #include "util/ConfigSource.h"
 #include "exec/Execution.h"
 #include "circle_loader.h"
 #include "tflite_loader.h"
 #include "json/json.h"
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <dirent.h>
+#include <sys/stat.h>
 #include <util/ConfigSource.h>
 #include <misc/string_helpers.h>
 
@@ -63,6 +68,65 @@ static onert::ir::Layout convertLayout(NNFW_LAYOUT layout)
   return onert::ir::Layout::UNKNOWN;
 }
 
+static uint64_t hashFile(const std::string &path)
+{
+  std::ifstream ifs{path, std::ios::binary};
+  if (!ifs)
+    throw std::runtime_error{"Cannot open " + path};
+
+  uint64_t hash = onert::compiler::CompiledArtifact::hash(nullptr, 0);
+  std::vector<char> buffer(64 * 1024);
+  while (ifs)
+  {
+    ifs.read(buffer.data(), buffer.size());
+    hash = onert::compiler::CompiledArtifact::hash(buffer.data(), ifs.gcount(), hash);
+  }
+  return hash;
+}
+
+// Hash of the model file contents. The size and modification time of the file are checked first,
+// so that a model prepared again in the same process is not read again unless it has changed.
+static uint64_t modelFileSignature(const std::string &path)
+{
+  struct FileStamp
+  {
+    uint64_t size;
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    uint64_t hash;
+  };
+  static std::mutex mutex;
+  static std::unordered_map<std::string, FileStamp> stamps;
+
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0)
+    throw std::runtime_error{"Cannot stat " + path};
+  FileStamp stamp{static_cast<uint64_t>(st.st_size), static_cast<int64_t>(st.st_mtim.tv_sec),
+                  static_cast<int64_t>(st.st_mtim.tv_nsec), 0};
+
+  std::lock_guard<std::mutex> lock{mutex};
+  auto it = stamps.find(path);
+  if (it != stamps.end() && it->second.size == stamp.size &&
+      it->second.mtime_sec == stamp.mtime_sec && it->second.mtime_nsec == stamp.mtime_nsec)
+  {
+    return it->second.hash;
+  }
+  stamp.hash = hashFile(path);
+  stamps[path] = stamp;
+  return stamp.hash;
+}
+
+// Compilation and input tensor info updates modify the graph, so each compilation works on its own
+// copy. Operand data is shared with the source, not copied.
+static std::shared_ptr<onert::ir::Subgraphs> cloneSubgraphs(const onert::ir::Subgraphs &source)
+{
+  auto subgraphs = std::make_shared<onert::ir::Subgraphs>();
+  source.iterate([&](const onert::ir::SubgraphIndex &index, const onert::ir::Graph &graph) {
+    subgraphs->push(index, std::make_shared<onert::ir::Graph>(graph));
+  });
+  return subgraphs;
+}
+
 nnfw_session::nnfw_session()
     : _subgraphs{nullptr}, _execution{nullptr},
       _kernel_registry{std::make_shared<onert::frontend::custom::KernelRegistry>()},
@@ -71,7 +135,21 @@ nnfw_session::nnfw_session()
   // DO NOTHING
 }
 
-nnfw_session::~nnfw_session() = default;
+nnfw_session::~nnfw_session()
+{
+  // Execution threads must not outlive their contexts
+  for (auto ind : _running_executions)
+  {
+    try
+    {
+      _executions.at(ind)->waitFinish();
+    }
+    catch (const std::exception &e)
+    {
+      std::cerr << "Error during nnfw_session::~nnfw_session : " << e.what() << std::endl;
+    }
+  }
+}
 
 NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
 {
@@ -114,20 +192,24 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
 
     auto model_file_path = package_dir + std::string("/") + models[0].asString(); // first model
     auto model_type = model_types[0].asString(); // first model's type
+    std::shared_ptr<onert::ir::Subgraphs> model;
     if (model_type == "tflite")
     {
-      _subgraphs = onert::tflite_loader::loadModel(model_file_path.c_str());
+      model = onert::tflite_loader::loadModel(model_file_path.c_str());
     }
     else if (model_type == "circle")
     {
-      _subgraphs = onert::circle_loader::loadModel(model_file_path.c_str());
+      model = onert::circle_loader::loadModel(model_file_path.c_str());
     }
     else
     {
       std::cerr << "Unsupported model type in MANIFEST" << std::endl;
       return NNFW_STATUS_ERROR;
     }
-    _subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+    setModel(model);
+    _model_file_path = model_file_path;
+    _compiler->options().artifact_path =
+        package_dir + std::string("/metadata/") + models[0].asString() + ".artifact";
   }
   catch (const std::exception &e)
   {
@@ -135,7 +217,30 @@ NNFW_STATUS nnfw_session::load_model_from_file(const char *package_dir)
     return NNFW_STATUS_ERROR;
   }
 
-  _compiler = std::make_unique<onert::compiler::Compiler>(_subgraphs);
+  _state = State::MODEL_LOADED;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::load_model_from_session(const nnfw_session *source)
+{
+  if (!isStateInitialized())
+    return NNFW_STATUS_ERROR;
+
+  if (!source || !source->_model)
+  {
+    std::cerr << "source session has no loaded model" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    setModel(source->_model);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during model loading : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
 
   _state = State::MODEL_LOADED;
   return NNFW_STATUS_NO_ERROR;
@@ -172,11 +277,38 @@ NNFW_STATUS nnfw_session::prepare()
     using onert::util::config_source;
     config_source(std::move(_source));
 
+    auto &options = _compiler->options();
+    if (options.artifact_cache && !_model_file_path.empty())
+    {
+      options.model_hash = modelFileSignature(_model_file_path);
+    }
+
+    // Each additional execution context compiles its own copy of the graphs so that it has its
+    // own tensors. Constant data and packed weights are shared among the contexts.
+    std::vector<std::unique_ptr<onert::compiler::Compiler>> context_compilers;
+    for (uint32_t i = 1; i < _num_executions; ++i)
+    {
+      auto subgraphs = cloneSubgraphs(*_subgraphs);
+      subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+      context_compilers.emplace_back(std::make_unique<onert::compiler::Compiler>(subgraphs));
+      context_compilers.back()->options() = options;
+    }
+
     _subgraphs.reset();
     _compiler->compile();
     std::shared_ptr<onert::exec::ExecutorMap> executors;
     _compiler->release(executors);
-    _execution = std::make_shared<onert::exec::Execution>(executors);
+    _executions.emplace_back(std::make_shared<onert::exec::Execution>(executors));
+
+    for (auto &compiler : context_compilers)
+    {
+      compiler->compile();
+      compiler->release(executors);
+      _executions.emplace_back(std::make_shared<onert::exec::Execution>(executors));
+    }
+    _current_execution = 0;
+    _output_execution = 0;
+    _execution = _executions.front();
   }
   catch (const std::exception &e)
   {
@@ -197,8 +329,16 @@ NNFW_STATUS nnfw_session::run()
     return NNFW_STATUS_ERROR;
   }
 
+  if (isExecutionRunning())
+  {
+    std::cerr << "Error during nnfw_session::run : "
+              << "all execution contexts are running, await one first" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
   try
   {
+    _output_execution = _current_execution;
     _execution->execute();
   }
   catch (const std::exception &e)
@@ -211,6 +351,66 @@ NNFW_STATUS nnfw_session::run()
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::run_async()
+{
+  if (!isStatePrepared())
+  {
+    std::cerr << "Error during nnfw_session::run_async : "
+              << "run_async should be run after prepare" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  if (isExecutionRunning())
+  {
+    std::cerr << "Error during nnfw_session::run_async : "
+              << "all execution contexts are running, await one first" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    _execution->startExecute();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_async : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  // Let the next inference be set up on the next context while this one runs
+  _running_executions.push_back(_current_execution);
+  _current_execution = (_current_execution + 1) % _executions.size();
+  _execution = _executions.at(_current_execution);
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::await()
+{
+  if (_running_executions.empty())
+  {
+    std::cerr << "Error during nnfw_session::await : "
+              << "there is no inference started by run_async" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  const auto ind = _running_executions.front();
+  _running_executions.pop_front();
+  _output_execution = ind;
+
+  try
+  {
+    _executions.at(ind)->waitFinish();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::await : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const void *buffer,
                                     size_t length)
 {
@@ -220,6 +420,13 @@ NNFW_STATUS nnfw_session::set_input(uint32_t index, NNFW_TYPE /*type*/, const vo
     return NNFW_STATUS_ERROR;
   }
 
+  if (isExecutionRunning())
+  {
+    std::cerr << "Error during nnfw_session::set_input : "
+              << "all execution contexts are running, await one first" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
   if (!buffer && length != 0)
   {
     std::cerr
@@ -249,6 +456,13 @@ NNFW_STATUS nnfw_session::set_output(uint32_t index, NNFW_TYPE /*type*/, void *b
     return NNFW_STATUS_ERROR;
   }
 
+  if (isExecutionRunning())
+  {
+    std::cerr << "Error during nnfw_session::set_output : "
+              << "all execution contexts are running, await one first" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
   if (!buffer && length != 0)
   {
     std::cerr
@@ -315,6 +529,13 @@ NNFW_STATUS nnfw_session::output_size(uint32_t *number)
 
 NNFW_STATUS nnfw_session::set_input_layout(uint32_t index, NNFW_LAYOUT layout)
 {
+  if (isExecutionRunning())
+  {
+    std::cerr << "Error during nnfw_session::set_input_layout : "
+              << "all execution contexts are running, await one first" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
   try
   {
     if (layout != NNFW_LAYOUT_NONE && layout != NNFW_LAYOUT_CHANNELS_FIRST &&
@@ -335,6 +556,13 @@ NNFW_STATUS nnfw_session::set_input_layout(uint32_t index, NNFW_LAYOUT layout)
 
 NNFW_STATUS nnfw_session::set_output_layout(uint32_t index, NNFW_LAYOUT layout)
 {
+  if (isExecutionRunning())
+  {
+    std::cerr << "Error during nnfw_session::set_output_layout : "
+              << "all execution contexts are running, await one first" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
   try
   {
     if (layout != NNFW_LAYOUT_NONE && layout != NNFW_LAYOUT_CHANNELS_FIRST &&
@@ -369,6 +597,8 @@ static NNFW_TYPE datatype_to_nnfw_dtype(onert::ir::DataType dt)
       return NNFW_TYPE_TENSOR_BOOL;
     case DataType::UINT8:
       return NNFW_TYPE_TENSOR_UINT8;
+    case DataType::QUANT_INT8_ASYMM:
+      return NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED;
     case DataType::UINT32:
     case DataType::QUANT_INT8_SYMM:
     default:
@@ -420,6 +650,13 @@ NNFW_STATUS nnfw_session::apply_tensorinfo(uint32_t index, nnfw_tensorinfo ti)
   }
   else // when called after nnfw_session::prepare() but before excute()
   {
+    if (isExecutionRunning())
+    {
+      std::cerr << "Error during apply_tensorinfo : "
+                << "all execution contexts are running, await one first" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+
     onert::ir::Shape new_shape(ti.rank);
     for (int32_t i = 0; i < ti.rank; i++)
       new_shape.dim(i) = ti.dims[i];
@@ -440,6 +677,12 @@ NNFW_STATUS nnfw_session::input_tensorinfo(uint32_t index, nnfw_tensorinfo *ti)
                 << std::endl;
       return NNFW_STATUS_ERROR;
     }
+    if (_execution && isExecutionRunning())
+    {
+      std::cerr << "Error during nnfw_session::input_tensorinfo : "
+                << "all execution contexts are running, await one first" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
     if (index >= primary_subgraph()->getInputs().size())
     {
       std::cerr << "Error during nnfw_session::input_tensorinfo, index is out of range."
@@ -473,20 +716,38 @@ NNFW_STATUS nnfw_session::output_tensorinfo(uint32_t index, nnfw_tensorinfo *ti)
                 << std::endl;
       return NNFW_STATUS_ERROR;
     }
-    if (index >= primary_subgraph()->getOutputs().size())
+    // After run_async(), the current context is the one for the next inference, so outputs are
+    // reported from the context that has finished last
+    const onert::ir::Graph *graph = primary_subgraph();
+    std::shared_ptr<onert::exec::Execution> execution;
+    if (_execution)
+    {
+      if (isExecutionRunning(_output_execution))
+      {
+        std::cerr << "Error during nnfw_session::output_tensorinfo : "
+                  << "the inference is running, await it first" << std::endl;
+        return NNFW_STATUS_ERROR;
+      }
+      execution = _executions.at(_output_execution);
+      graph = &execution->primary_subgraph();
+    }
+    if (index >= graph->getOutputs().size())
     {
       std::cerr << "Error during nnfw_session::output_tensorinfo, index is out of range."
                 << std::endl;
       return NNFW_STATUS_ERROR;
     }
-    auto opidx = primary_subgraph()->getOutputs().at(index);
-    auto shape = primary_subgraph()->operands().at(opidx).shape();
+    auto opidx = graph->getOutputs().at(index);
+    // Shapes of outputs may change while running
+    auto shape = (execution && execution->isFinished())
+                     ? execution->getOutputShape(onert::ir::IOIndex{index})
+                     : graph->operands().at(opidx).shape();
     ti->rank = shape.rank();
     for (int j = 0; j < ti->rank; ++j)
     {
       ti->dims[j] = shape.dim(j);
     }
-    ti->dtype = datatype_to_nnfw_dtype(primary_subgraph()->operands().at(opidx).typeInfo().type());
+    ti->dtype = datatype_to_nnfw_dtype(graph->operands().at(opidx).typeInfo().type());
   }
   catch (const std::exception &e)
   {
@@ -621,6 +882,17 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.disable_compile = toBool(value);
   }
+  else if (skey == config::ARTIFACT_CACHE)
+  {
+    options.artifact_cache = toBool(value);
+  }
+  else if (skey == config::EXECUTION_CONTEXTS)
+  {
+    const auto num_executions = toInt(value);
+    if (num_executions < 1)
+      return NNFW_STATUS_ERROR;
+    _num_executions = num_executions;
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -628,6 +900,17 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   return NNFW_STATUS_NO_ERROR;
 }
 
+void nnfw_session::setModel(const std::shared_ptr<const onert::ir::Subgraphs> &model)
+{
+  _model = model;
+
+  _subgraphs = cloneSubgraphs(*_model);
+  _subgraphs->primary()->bindKernelBuilder(_kernel_registry->getBuilder());
+
+  _compiler = std::make_unique<onert::compiler::Compiler>(_subgraphs);
+  _num_executions = std::max(onert::util::getConfigInt(onert::util::config::EXECUTION_CONTEXTS), 1);
+}
+
 onert::ir::Graph *nnfw_session::primary_subgraph()
 {
   if (_subgraphs)
@@ -731,3 +1014,11 @@ bool nnfw_session::isStatePrepared()
     return false;
   }
 }
+
+bool nnfw_session::isExecutionRunning() { return isExecutionRunning(_current_execution); }
+
+bool nnfw_session::isExecutionRunning(size_t ind)
+{
+  return std::find(_running_executions.begin(), _running_executions.end(), ind) !=
+         _running_executions.end();
+}
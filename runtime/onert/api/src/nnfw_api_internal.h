@@ -22,8 +22,10 @@
 
 #include <util/GeneralConfigSource.h>
 
+#include <deque>
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace onert
 {
@@ -64,8 +66,11 @@ public:
   ~nnfw_session();
 
   NNFW_STATUS load_model_from_file(const char *package_file_path);
+  NNFW_STATUS load_model_from_session(const nnfw_session *source);
   NNFW_STATUS prepare();
   NNFW_STATUS run();
+  NNFW_STATUS run_async();
+  NNFW_STATUS await();
 
   NNFW_STATUS set_input(uint32_t index, NNFW_TYPE type, const void *buffer, size_t length);
   NNFW_STATUS set_output(uint32_t index, NNFW_TYPE type, void *buffer, size_t length);
@@ -94,13 +99,29 @@ private:
   bool isStateInitialized();
   bool isStateModelLoaded();
   bool isStatePrepared();
+  bool isExecutionRunning();
+  bool isExecutionRunning(size_t ind);
+  void setModel(const std::shared_ptr<const onert::ir::Subgraphs> &model);
 
 private:
   State _state{State::INITIALIZED};
+  // Model as it is loaded, which is never modified so that it can be shared between sessions
+  std::shared_ptr<const onert::ir::Subgraphs> _model;
   std::shared_ptr<onert::ir::Subgraphs> _subgraphs;
   std::unique_ptr<onert::compiler::Compiler> _compiler;
+  // Execution context that inputs, outputs and runs apply to, which is one of _executions
   std::shared_ptr<onert::exec::Execution> _execution;
+  // Execution contexts with their own compiled executors, so that each has its own tensors
+  std::vector<std::shared_ptr<onert::exec::Execution>> _executions;
+  uint32_t _num_executions{1};
+  size_t _current_execution{0};
+  // Execution context whose outputs are reported, which is the one run() or await() finished last
+  size_t _output_execution{0};
+  // Indices of execution contexts started by run_async() and not awaited yet, oldest first
+  std::deque<size_t> _running_executions;
   std::shared_ptr<onert::frontend::custom::KernelRegistry> _kernel_registry;
+  // Model file of the nnpackage, which is hashed to validate compiled artifact
+  std::string _model_file_path;
 
 protected:
   std::unique_ptr<onert::util::GeneralConfigSource> _source;
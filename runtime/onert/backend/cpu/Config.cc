@@ -16,6 +16,9 @@
 
 #include "Config.h"
 
+#include <cker/eigen/EigenSupport.h>
+#include <util/ConfigSource.h>
+
 namespace onert
 {
 namespace backend
@@ -23,7 +26,12 @@ namespace backend
 namespace cpu
 {
 
-bool Config::initialize() { return true; }
+bool Config::initialize()
+{
+  // Size of the thread pool shared by all multithreaded kernels, such as float Conv2D
+  nnfw::cker::eigen_support::SetMaxNumThreads(util::getConfigInt(util::config::EIGEN_THREADS));
+  return true;
+}
 
 ir::Layout Config::supportLayout(const ir::Operation &, ir::Layout) { return ir::Layout::NHWC; }
 
@@ -36,9 +36,12 @@ public:
                       const std::shared_ptr<TensorBuilder> &tensor_builder);
 
 public:
-  void visit(const ir::operation::Conv2D &) override;
-  void visit(const ir::operation::DepthwiseConv2D &) override;
-  void visit(const ir::operation::FullyConnected &) override;
+  void registerDefaultInitializer(const ir::OperandIndex &index, const ir::Operand &obj) override;
+
+  /**
+   * @brief Register an initializer that makes the tensor refer to the operand data directly
+   */
+  void registerExternalInitializer(const ir::OperandIndex &index, const ir::Operand &obj);
 
 private:
   std::shared_ptr<ITensorBuilder> tensor_builder() const override { return _tensor_builder; }
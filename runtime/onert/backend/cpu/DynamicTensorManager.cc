@@ -31,6 +31,15 @@ DynamicTensorManager::DynamicTensorManager(const std::shared_ptr<TensorRegistry>
   // DO NOTHING
 }
 
+DynamicTensorManager::~DynamicTensorManager()
+{
+  const auto &stats = _dynamic_mem_mgr->stats();
+  VERBOSE(DynamicTensorManager) << "Memory pool stats: peak " << stats.peak_bytes
+                                << " bytes, reserved " << stats.reserved_bytes << " bytes, "
+                                << stats.hits << " hits, " << stats.misses << " misses"
+                                << std::endl;
+}
+
 void DynamicTensorManager::applyShape(const ir::OperandIndex &ind, const ir::Shape &new_shape)
 {
   auto tensor = (*_tensors)[ind];
@@ -38,14 +47,11 @@ void DynamicTensorManager::applyShape(const ir::OperandIndex &ind, const ir::Sha
 
   bool previously_dynamic = tensor->is_dynamic();
 
-  auto allocTensorMem = [&](bool overwrite = false) {
+  // NOTE The tensor may still have the Allocator which has been emptied by deallocation
+  auto allocTensorMem = [&]() {
     auto capacity = tensor->total_size();
     auto alloc = _dynamic_mem_mgr->allocate(ind, capacity);
-
-    if (overwrite)
-      tensor->overwriteBuffer(alloc);
-    else
-      tensor->setBuffer(alloc);
+    tensor->overwriteBuffer(alloc);
   };
 
   if (!previously_dynamic)
@@ -54,7 +60,7 @@ void DynamicTensorManager::applyShape(const ir::OperandIndex &ind, const ir::Sha
     // issue is that staticTensorManager might have allocate this memory
     setShape(tensor.get(), new_shape);
     tensor->set_dynamic();
-    allocTensorMem(true);
+    allocTensorMem();
   }
   else if (tensor->buffer() == nullptr)
   {
@@ -76,7 +82,8 @@ void DynamicTensorManager::applyShape(const ir::OperandIndex &ind, const ir::Sha
       allocTensorMem();
     }
     else
-    { // when buffer with same size was already allocated, do nothing
+    { // when buffer with same size was already allocated, only the shape may differ
+      setShape(tensor.get(), new_shape);
     }
   }
 }
@@ -93,7 +100,7 @@ void DynamicTensorManager::allocate(const ir::OperandIndex &ind, const ir::Shape
     auto capacity = tensor->total_size();
     auto alloc = _dynamic_mem_mgr->allocate(ind, capacity);
 
-    tensor->setBuffer(alloc);
+    tensor->overwriteBuffer(alloc);
   };
 
   if (tensor->buffer() == nullptr)
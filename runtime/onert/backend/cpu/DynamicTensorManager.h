@@ -32,8 +32,6 @@ namespace backend
 namespace cpu
 {
 
-// TODO Find optimized algorithm to manage memory.
-
 /**
  * @brief Class to manage dynamic tensor and its memory
  */
@@ -42,7 +40,7 @@ class DynamicTensorManager : public backend::IDynamicTensorManager
 public:
   DynamicTensorManager(const std::shared_ptr<TensorRegistry> &reg);
 
-  virtual ~DynamicTensorManager() = default;
+  virtual ~DynamicTensorManager();
 
   void applyShape(const ir::OperandIndex &ind, const ir::Shape &new_shape) override;
 
@@ -63,10 +61,15 @@ public:
   void deallocInput(ir::OperationIndex op_ind) override;
   void deallocSubgraphOutput(ir::OperandIndex ind) override;
 
+  /**
+   * @brief Get statistics of the memory pool for dynamic tensors
+   */
+  const cpu_common::DynamicMemoryStats &memoryStats() const { return _dynamic_mem_mgr->stats(); }
+
 private:
   /**
    * @brief Memory manager for dynamic tensor.
-   * @todo  DynamicMemoryManager is not optimized. Optimized one is needed
+   * @note  Memory is pooled and kept across executions
    */
   std::shared_ptr<cpu_common::DynamicMemoryManager> _dynamic_mem_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
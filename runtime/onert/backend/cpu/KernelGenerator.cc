@@ -34,6 +34,7 @@
 #include "ops/GatherLayer.h"
 #include "ops/LogLayer.h"
 #include "ops/LogisticLayer.h"
+#include "ops/LSTMLayer.h"
 #include "ops/MaxLayer.h"
 #include "ops/MaxPoolLayer.h"
 #include "ops/MeanLayer.h"
@@ -50,9 +51,11 @@
 #include "ops/ReLULayer.h"
 #include "ops/ReshapeLayer.h"
 #include "ops/ReverseLayer.h"
+#include "ops/RNNLayer.h"
 #include "ops/RoundLayer.h"
 #include "ops/RsqrtLayer.h"
 #include "ops/SelectLayer.h"
+#include "ops/SeparableConvolutionLayer.h"
 #include "ops/ShapeLayer.h"
 #include "ops/SinLayer.h"
 #include "ops/SliceLayer.h"
@@ -101,19 +104,30 @@ void KernelGenerator::visit(const ir::OpSequence &op_seq)
   assert(_tensor_builder->tensorRegistry());
 
   auto dyn_tensor_manager = _tensor_builder->dynamicTensorManager();
-  auto dyn_shape_inferer = std::make_unique<shape_inference::DynamicInferer>(
-      _ctx, dyn_tensor_manager, _tensor_builder->tensorRegistry());
 
-  _return_fn_seq =
-      _tensor_builder->supportDynamicTensor()
-          ? std::make_unique<exec::FunctionSequenceForDynamicBackend>(
-                op_seq, _operations_ctx, std::move(dyn_shape_inferer), dyn_tensor_manager)
-          : std::make_unique<exec::FunctionSequence>();
+  _return_fn_seq = _tensor_builder->supportDynamicTensor()
+                       ? std::make_unique<exec::FunctionSequenceForDynamicBackend>(
+                             op_seq, _ctx, _operations_ctx, dyn_tensor_manager,
+                             _tensor_builder->tensorRegistry())
+                       : std::make_unique<exec::FunctionSequence>();
 
   _current_op_seq_layout = op_seq.getLayout();
   for (const auto &operation_idx : op_seq.operations())
   {
     const auto &node = _operations_ctx.at(operation_idx);
+
+    // Constant tensors refer to the operand data. Bind it before the kernel is generated, as
+    // kernels may read constants while they are configured and references are counted below.
+    for (const auto &ind : node.getInputs() | ir::Remove::UNDEFINED)
+    {
+      const auto &operand = _ctx.at(ind);
+      auto tensor = _tensor_builder->at(ind);
+      if (tensor && operand.isConstant() && tensor->buffer() == nullptr)
+      {
+        tensor->setData(operand.shareData());
+      }
+    }
+
     node.accept(*this);
     _return_fn_seq->append(releaseFunction());
 
@@ -198,6 +212,45 @@ void KernelGenerator::visit(const ir::operation::DepthwiseConv2D &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::SeparableConv2D &node)
+{
+  using ir::operation::SeparableConv2D;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(SeparableConv2D::Input::INPUT)};
+  const auto dw_ker_index{node.getInputs().at(SeparableConv2D::Input::DEPTHWISE_KERNEL)};
+  const auto dw_bias_index{node.getInputs().at(SeparableConv2D::Input::DEPTHWISE_BIAS)};
+  const auto pw_ker_index{node.getInputs().at(SeparableConv2D::Input::POINTWISE_KERNEL)};
+  const auto pw_bias_index{node.getInputs().at(SeparableConv2D::Input::POINTWISE_BIAS)};
+
+  const auto stride = node.param().stride;
+  const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature(_current_op_seq_layout);
+  // The pointwise convolution keeps height and width of the depthwise one
+  const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature(_current_op_seq_layout);
+  // Kernel format is [1, kernel_height, kernel_width, depth_out].
+  const auto &dw_ker_shape = _ctx.at(dw_ker_index).shape();
+  const auto ker_height = dw_ker_shape.dim(1);
+  const auto ker_width = dw_ker_shape.dim(2);
+  const auto padding = ir::calculatePadding(node.param().padding, ifm_shape, ofm_shape, stride,
+                                            ker_width, ker_height);
+
+  auto ofm_alloc = _tensor_builder->at(ofm_index).get();
+  auto ifm_alloc = _tensor_builder->at(ifm_index).get();
+  auto dw_ker_alloc = _tensor_builder->at(dw_ker_index).get();
+  auto dw_bias_alloc = _tensor_builder->at(dw_bias_index).get();
+  auto pw_ker_alloc = _tensor_builder->at(pw_ker_index).get();
+  auto pw_bias_alloc = _tensor_builder->at(pw_bias_index).get();
+
+  auto fn = std::make_unique<ops::SeparableConvolutionLayer>();
+
+  fn->configure(ifm_alloc, dw_ker_alloc, dw_bias_alloc, pw_ker_alloc, pw_bias_alloc, padding.left,
+                padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
+                node.param().multiplier, node.param().depthwise_activation,
+                node.param().activation, ofm_alloc);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::MaxPool2D &node)
 {
   const auto ofm_index{node.getOutputs().at(0)};
@@ -1234,6 +1287,112 @@ void KernelGenerator::visit(const ir::operation::Tile &node)
   fn->configure(input_alloc, multiples_alloc, output_alloc);
   _return_fn = std::move(fn);
 }
+
+void KernelGenerator::visit(const ir::operation::LSTM &node)
+{
+  using ir::operation::LSTM;
+
+  const auto scratch_buffer_index{node.getOutputs().at(LSTM::Output::SCRATCH_BUFFER)};
+  const auto output_state_out_index{node.getOutputs().at(LSTM::Output::OUTPUT_STATE_OUT)};
+  const auto cell_state_out_index{node.getOutputs().at(LSTM::Output::CELL_STATE_OUT)};
+  const auto output_index{node.getOutputs().at(LSTM::Output::OUTPUT)};
+
+  // The scratch buffer holds 3 gates with CIFG(no input gate) and 4 gates without it
+  const auto cell_bias_index{node.getInputs().at(LSTM::Input::CELL_BIAS)};
+  const auto n_cell = _ctx.at(cell_bias_index).shape().dim(0);
+  const bool use_cifg = _ctx.at(scratch_buffer_index).shape().dim(1) == n_cell * 3;
+
+  // Operands of CIFG, peephole and projection are optional, and absent ones have no elements
+  bool constant_weights = true;
+  auto alloc = [&](LSTM::Input input) -> Tensor * {
+    const auto index = node.getInputs().at(input);
+    if (index.undefined() || _ctx.at(index).shape().num_elements() == 0)
+      return nullptr;
+    if (use_cifg &&
+        (input == LSTM::Input::INPUT_TO_INPUT_WEIGHTS ||
+         input == LSTM::Input::RECURRENT_TO_INPUT_WEIGHTS ||
+         input == LSTM::Input::CELL_TO_INPUT_WEIGHTS || input == LSTM::Input::INPUT_GATE_BIAS))
+      return nullptr;
+    if (input != LSTM::Input::INPUT && input != LSTM::Input::OUTPUT_STATE_IN &&
+        input != LSTM::Input::CELL_STATE_IN)
+      constant_weights &= _ctx.at(index).isConstant();
+    return _tensor_builder->at(index).get();
+  };
+
+  auto scratch_buffer_alloc = _tensor_builder->at(scratch_buffer_index).get();
+  auto output_state_out_alloc = _tensor_builder->at(output_state_out_index).get();
+  auto cell_state_out_alloc = _tensor_builder->at(cell_state_out_index).get();
+  auto output_alloc = _tensor_builder->at(output_index).get();
+
+  auto fn = std::make_unique<ops::LSTMLayer>();
+
+  auto input_alloc = alloc(LSTM::Input::INPUT);
+  auto input_to_input_weights_alloc = alloc(LSTM::Input::INPUT_TO_INPUT_WEIGHTS);
+  auto input_to_forget_weights_alloc = alloc(LSTM::Input::INPUT_TO_FORGET_WEIGHTS);
+  auto input_to_cell_weights_alloc = alloc(LSTM::Input::INPUT_TO_CELL_WEIGHTS);
+  auto input_to_output_weights_alloc = alloc(LSTM::Input::INPUT_TO_OUTPUT_WEIGHTS);
+  auto recurrent_to_input_weights_alloc = alloc(LSTM::Input::RECURRENT_TO_INPUT_WEIGHTS);
+  auto recurrent_to_forget_weights_alloc = alloc(LSTM::Input::RECURRENT_TO_FORGET_WEIGHTS);
+  auto recurrent_to_cell_weights_alloc = alloc(LSTM::Input::RECURRENT_TO_CELL_WEIGHTS);
+  auto recurrent_to_output_weights_alloc = alloc(LSTM::Input::RECURRENT_TO_OUTPUT_WEIGHTS);
+  auto cell_to_input_weights_alloc = alloc(LSTM::Input::CELL_TO_INPUT_WEIGHTS);
+  auto cell_to_forget_weights_alloc = alloc(LSTM::Input::CELL_TO_FORGET_WEIGHTS);
+  auto cell_to_output_weights_alloc = alloc(LSTM::Input::CELL_TO_OUTPUT_WEIGHTS);
+  auto input_gate_bias_alloc = alloc(LSTM::Input::INPUT_GATE_BIAS);
+  auto forget_gate_bias_alloc = alloc(LSTM::Input::FORGET_GATE_BIAS);
+  auto cell_bias_alloc = alloc(LSTM::Input::CELL_BIAS);
+  auto output_gate_bias_alloc = alloc(LSTM::Input::OUTPUT_GATE_BIAS);
+  auto projection_weights_alloc = alloc(LSTM::Input::PROJECTION_WEIGHTS);
+  auto projection_bias_alloc = alloc(LSTM::Input::PROJECTION_BIAS);
+  auto output_state_in_alloc = alloc(LSTM::Input::OUTPUT_STATE_IN);
+  auto cell_state_in_alloc = alloc(LSTM::Input::CELL_STATE_IN);
+
+  fn->configure(
+      input_alloc, input_to_input_weights_alloc, input_to_forget_weights_alloc,
+      input_to_cell_weights_alloc, input_to_output_weights_alloc, recurrent_to_input_weights_alloc,
+      recurrent_to_forget_weights_alloc, recurrent_to_cell_weights_alloc,
+      recurrent_to_output_weights_alloc, cell_to_input_weights_alloc, cell_to_forget_weights_alloc,
+      cell_to_output_weights_alloc, input_gate_bias_alloc, forget_gate_bias_alloc, cell_bias_alloc,
+      output_gate_bias_alloc, projection_weights_alloc, projection_bias_alloc,
+      output_state_in_alloc, cell_state_in_alloc, node.param().activation,
+      node.param().cell_threshold, node.param().projection_threshold, scratch_buffer_alloc,
+      output_state_out_alloc, cell_state_out_alloc, output_alloc, constant_weights);
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::RNN &node)
+{
+  const auto output_index{node.getOutputs().at(ir::operation::RNN::Output::OUTPUT)};
+  const auto hidden_state_out_index{
+      node.getOutputs().at(ir::operation::RNN::Output::HIDDEN_STATE_OUT)};
+
+  const auto input_index{node.getInputs().at(ir::operation::RNN::Input::INPUT)};
+  const auto weights_index{node.getInputs().at(ir::operation::RNN::Input::WEIGHTS)};
+  const auto recurrent_weights_index{
+      node.getInputs().at(ir::operation::RNN::Input::RECURRENT_WEIGHTS)};
+  const auto bias_index{node.getInputs().at(ir::operation::RNN::Input::BIAS)};
+  const auto hidden_state_in_index{node.getInputs().at(ir::operation::RNN::Input::HIDDEN_STATE_IN)};
+
+  auto output_alloc = _tensor_builder->at(output_index).get();
+  auto hidden_state_out_alloc = _tensor_builder->at(hidden_state_out_index).get();
+  auto input_alloc = _tensor_builder->at(input_index).get();
+  auto weights_alloc = _tensor_builder->at(weights_index).get();
+  auto recurrent_weights_alloc = _tensor_builder->at(recurrent_weights_index).get();
+  auto bias_alloc = _tensor_builder->at(bias_index).get();
+  auto hidden_state_in_alloc = _tensor_builder->at(hidden_state_in_index).get();
+
+  auto fn = std::make_unique<ops::RNNLayer>();
+
+  const bool constant_weights = _ctx.at(weights_index).isConstant() &&
+                                _ctx.at(recurrent_weights_index).isConstant() &&
+                                _ctx.at(bias_index).isConstant();
+
+  fn->configure(input_alloc, weights_alloc, recurrent_weights_alloc, bias_alloc,
+                hidden_state_in_alloc, node.param().activation, output_alloc,
+                hidden_state_out_alloc, constant_weights);
+  _return_fn = std::move(fn);
+}
+
 } // namespace cpu
 } // namespace backend
 } // namespace onert
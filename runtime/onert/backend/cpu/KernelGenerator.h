@@ -44,6 +44,7 @@ public:
   void visit(const ir::OpSequence &) override;
   void visit(const ir::operation::Conv2D &) override;
   void visit(const ir::operation::DepthwiseConv2D &) override;
+  void visit(const ir::operation::SeparableConv2D &) override;
   void visit(const ir::operation::MaxPool2D &) override;
   void visit(const ir::operation::AvgPool2D &) override;
   void visit(const ir::operation::Concat &) override;
@@ -100,6 +101,8 @@ public:
   void visit(const ir::operation::Tile &) override;
   void visit(const ir::operation::LogicalOr &) override;
   void visit(const ir::operation::Range &) override;
+  void visit(const ir::operation::LSTM &) override;
+  void visit(const ir::operation::RNN &) override;
 
 private:
   const ir::Operands &_ctx;
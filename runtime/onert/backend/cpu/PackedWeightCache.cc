@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PackedWeightCache.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+PackedWeightCache &PackedWeightCache::get()
+{
+  static PackedWeightCache cache;
+  return cache;
+}
+
+PackedWeightCache::PackedWeights
+PackedWeightCache::getOrPack(const std::shared_ptr<ir::Data> &source,
+                             const std::function<PackedWeights()> &pack)
+{
+  assert(source != nullptr);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto it = _entries.find(source.get());
+  if (it != _entries.end())
+  {
+    if (auto entry = it->second.lock())
+    {
+      // Aliasing constructor : the returned pointer keeps the whole entry alive
+      return PackedWeights{entry, entry->packed.get()};
+    }
+  }
+
+  // Drop entries whose kernels are all gone
+  for (auto e = _entries.begin(); e != _entries.end();)
+  {
+    if (e->second.expired())
+      e = _entries.erase(e);
+    else
+      ++e;
+  }
+
+  auto entry = std::make_shared<Entry>();
+  entry->source = source;
+  entry->packed = pack();
+  _entries[source.get()] = entry;
+  return PackedWeights{entry, entry->packed.get()};
+}
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
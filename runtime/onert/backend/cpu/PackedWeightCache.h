@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_PACKED_WEIGHT_CACHE_H__
+#define __ONERT_BACKEND_CPU_PACKED_WEIGHT_CACHE_H__
+
+#include <ir/Data.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+
+/**
+ * @brief Process-wide cache of weights rearranged by kernels, keyed by the constant data they come
+ *        from
+ *
+ * Sessions sharing a model share the constant data, so the kernels of every session get the same
+ * packed weights. An entry lives as long as a kernel holds it, and keeps its source data alive so
+ * that the key cannot be reused by other data meanwhile.
+ */
+class PackedWeightCache
+{
+public:
+  using PackedWeights = std::shared_ptr<const std::vector<float>>;
+
+public:
+  static PackedWeightCache &get();
+
+public:
+  /**
+   * @brief Get the packed weights of the given data, packing them with \p pack if there are none
+   * @note  \p pack is called at most once for the same data among concurrent callers
+   */
+  PackedWeights getOrPack(const std::shared_ptr<ir::Data> &source,
+                          const std::function<PackedWeights()> &pack);
+
+private:
+  PackedWeightCache() = default;
+
+private:
+  struct Entry
+  {
+    std::shared_ptr<ir::Data> source;
+    PackedWeights packed;
+  };
+
+  std::mutex _mutex;
+  std::unordered_map<const ir::Data *, std::weak_ptr<Entry>> _entries;
+};
+
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_PACKED_WEIGHT_CACHE_H__
@@ -26,30 +26,11 @@ namespace cpu
 {
 
 StaticTensorManager::StaticTensorManager(const std::shared_ptr<TensorRegistry> &reg)
-    : _const_mgr{new cpu_common::DynamicMemoryManager()},
-      _nonconst_mgr{new cpu_common::MemoryManager()}, _tensors{reg}
+    : _nonconst_mgr{new cpu_common::MemoryManager()}, _tensors{reg}
 {
   // DO NOTHING
 }
 
-void StaticTensorManager::allocateConsts(void)
-{
-  for (auto &pair : (*_tensors))
-  {
-    const auto &ind = pair.first;
-    auto tensor = pair.second;
-    if (_as_constants[ind])
-    {
-      auto mem_alloc = _const_mgr->allocate(ind, tensor->total_size());
-      tensor->setBuffer(mem_alloc);
-      auto buffer = mem_alloc->base();
-      VERBOSE(CPU_StaticTensorManager) << "CONSTANT TENSOR(#" << ind.value()
-                                       << "): " << static_cast<void *>(buffer)
-                                       << "size : " << tensor->total_size() << std::endl;
-    }
-  }
-}
-
 void StaticTensorManager::allocateNonconsts(void)
 {
   _nonconst_mgr->allocate();
@@ -69,8 +50,6 @@ void StaticTensorManager::allocateNonconsts(void)
   }
 }
 
-void StaticTensorManager::deallocateConsts(void) { _const_mgr->deallocate(); }
-
 void StaticTensorManager::deallocateNonconsts(void) { _nonconst_mgr->deallocate(); }
 
 void StaticTensorManager::buildTensor(const ir::OperandIndex &ind,
@@ -38,9 +38,7 @@ public:
   StaticTensorManager(const std::shared_ptr<TensorRegistry> &reg);
   virtual ~StaticTensorManager() = default;
 
-  void allocateConsts(void);
   void allocateNonconsts(void);
-  void deallocateConsts(void);
   void deallocateNonconsts(void);
 
   void buildTensor(const ir::OperandIndex &ind, const ir::OperandInfo &tensor_info, bool as_const);
@@ -51,9 +49,9 @@ public:
   void iterate(const std::function<void(const ir::OperandIndex &)> &fn);
 
 private:
-  std::unique_ptr<cpu_common::DynamicMemoryManager> _const_mgr;
   std::unique_ptr<cpu_common::MemoryManager> _nonconst_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
+  // Constant tensors are not allocated, they refer to the operand data (see ConstantInitializer)
   ir::OperandIndexMap<bool> _as_constants;
 };
 
@@ -20,8 +20,11 @@
 #include "Allocator.h"
 
 #include <backend/ITensor.h>
+#include <ir/Data.h>
 #include <ir/OperandInfo.h>
 
+#include <cstdint>
+
 namespace onert
 {
 namespace backend
@@ -45,25 +48,54 @@ public:
   // Only one of two method 'setBuffer' must be called once
   void setBuffer(uint8_t *buffer)
   {
-    assert(_buffer == nullptr && _allocator == nullptr);
+    assert(_buffer == nullptr && _allocator == nullptr && _data == nullptr);
     _buffer = buffer;
   }
   void setBuffer(const std::shared_ptr<cpu_common::Allocator> &alloc)
   {
-    assert(_buffer == nullptr && _allocator == nullptr);
+    assert(_buffer == nullptr && _allocator == nullptr && _data == nullptr);
     _allocator = alloc;
   }
 
+  /**
+   * @brief Use constant data as the buffer without copying it
+   * @note  The data is kept alive until the tensor releases it. It may be read-only memory such as
+   *        a mapped model file, so the tensor never writes it nor gives it as writable memory.
+   *        Data not aligned to the element size is copied, as kernels read elements directly.
+   */
+  void setData(const std::shared_ptr<ir::Data> &data)
+  {
+    assert(_buffer == nullptr && _allocator == nullptr && _data == nullptr);
+    assert(data != nullptr && data->size() == total_size());
+    const auto element_size = ir::sizeOfDataType(data_type());
+    if (reinterpret_cast<uintptr_t>(data->base()) % element_size != 0)
+      _data = std::make_shared<ir::CachedData>(data->base(), data->size());
+    else
+      _data = data;
+  }
+
+  /**
+   * @brief Get the constant data given by setData
+   * @return The data, or nullptr if the buffer is not from constant data
+   */
+  std::shared_ptr<ir::Data> shareData() const { return _data; }
+
   // This works just as setBuffer but it simply overwrite existing Allocator without nullptr check
-  void overwriteBuffer(const std::shared_ptr<cpu_common::Allocator> &alloc) { _allocator = alloc; }
+  void overwriteBuffer(const std::shared_ptr<cpu_common::Allocator> &alloc)
+  {
+    assert(_data == nullptr);
+    _allocator = alloc;
+  }
 
 public:
   uint8_t *buffer() const override
   {
     if (_allocator != nullptr)
       return _allocator->base();
-    else
-      return _buffer;
+    // NOTE ITensor gives only non-const buffers, but kernels never write their constant inputs
+    if (_data != nullptr)
+      return const_cast<uint8_t *>(_data->base());
+    return _buffer;
   }
   /**
    * @brief Get dimension by index
@@ -83,8 +115,18 @@ public:
   ir::DataType data_type() const override { return _info.typeInfo().type(); }
   float data_scale() const { return _info.typeInfo().scale(); }
   int32_t data_offset() const { return _info.typeInfo().offset(); }
+  const std::vector<float> &data_scales() const { return _info.typeInfo().scales(); }
+  const std::vector<int32_t> &data_offsets() const { return _info.typeInfo().offsets(); }
   bool has_padding() const override { return false; }
   void access(const std::function<void(ITensor &tensor)> &fn) final;
+  bool setExternalBuffer(uint8_t *buffer) override
+  {
+    // Constant and dynamic tensors own their memory through _data or _allocator
+    if (_allocator != nullptr || _data != nullptr || is_dynamic())
+      return false;
+    _buffer = buffer;
+    return true;
+  }
   bool is_dynamic() const override { return _info.isDynamic(); }
   void set_dynamic() override { _info.setDynamic(); }
 
@@ -92,20 +134,26 @@ public:
   {
     assert(is_dynamic() ||
            // when not dynamic
-           (_buffer != nullptr || _allocator != nullptr));
+           (_buffer != nullptr || _allocator != nullptr || _data != nullptr));
 
     ++_num_references;
   }
   void decrease_ref()
   {
-    assert(_buffer != nullptr || _allocator != nullptr);
+    assert(_buffer != nullptr || _allocator != nullptr || _data != nullptr);
     assert(_num_references > 0);
     --_num_references;
     // Only constant tensor has allocator pointer
     if (_num_references == 0)
     {
-      if (_buffer != nullptr)
+      if (_data != nullptr)
+      {
+        _data = nullptr;
+      }
+      else if (_buffer != nullptr)
+      {
         _buffer = nullptr;
+      }
       else
       {
         _allocator->release();
@@ -137,6 +185,7 @@ private:
   uint8_t *_buffer;
   int32_t _num_references;
   std::shared_ptr<cpu_common::Allocator> _allocator;
+  std::shared_ptr<ir::Data> _data;
 };
 
 } // namespace cpu
@@ -79,7 +79,6 @@ bool TensorBuilder::isRegistered(const ir::OperandIndex &ind) const
 
 void TensorBuilder::prepare(void)
 {
-  _static_tensor_mgr->allocateConsts();
   _static_tensor_mgr->allocateNonconsts();
 }
 
@@ -16,6 +16,8 @@
 
 #include "ConvolutionLayer.h"
 
+#include "../PackedWeightCache.h"
+
 #include <cker/operation/Conv.h>
 
 namespace onert
@@ -57,8 +59,21 @@ void ConvolutionLayer::convFloat32()
   if (!_prepare)
   {
     bool is_replaced_weights = false;
-    kernel.prepare(getTensorShape(_kernel), reinterpret_cast<const float *>(_kernel->buffer()),
-                   op_params.padding_type, is_replaced_weights);
+    const auto filter_shape = getTensorShape(_kernel);
+    const auto filter_data = reinterpret_cast<const float *>(_kernel->buffer());
+    const auto filter_source = _kernel->shareData();
+    if (filter_source)
+    {
+      // Kernels in other sessions on the same model reuse the packed filter
+      auto packed_filter = PackedWeightCache::get().getOrPack(filter_source, [&]() {
+        return nnfw::cker::Conv::PackFilter(filter_shape, filter_data);
+      });
+      kernel.prepare(packed_filter, is_replaced_weights);
+    }
+    else
+    {
+      kernel.prepare(filter_shape, filter_data, op_params.padding_type, is_replaced_weights);
+    }
 
     if (is_replaced_weights)
     {
@@ -115,6 +130,42 @@ void ConvolutionLayer::convQuant8()
          getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeInt8(_activation, _output, &output_activation_min,
+                               &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.input_offset = -_input->data_offset();
+  // Filters with non-zero zero points are rejected by configure
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  if (!_prepare)
+  {
+    kernel.prepareQuant(getTensorShape(_input), getTensorShape(_kernel), getTensorShape(_output),
+                        _strideWidth, _strideHeight);
+    _prepare = true;
+  }
+  kernel(op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+         getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+         getTensorShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+         getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+         getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
 void ConvolutionLayer::configure(const Tensor *input, const Tensor *kernel, const Tensor *bias,
                                  const ir::PaddingType paddingType, const uint32_t paddingLeft,
                                  const uint32_t paddingRight, const uint32_t paddingTop,
@@ -134,6 +185,14 @@ void ConvolutionLayer::configure(const Tensor *input, const Tensor *kernel, cons
   _strideHeight = strideHeight;
   _activation = activation;
   _output = output;
+
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    // Quantization parameters are static, so requantization factors are computed only once
+    GetQuantizedConvolutionMultipliersAndShifts(
+        _input, _kernel, _output, getSizeOfDimension(_kernel, 0), &_per_channel_output_multiplier,
+        &_per_channel_output_shift);
+  }
 }
 
 void ConvolutionLayer::run()
@@ -146,6 +205,10 @@ void ConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    convQuant8PerChannel();
+  }
 }
 
 #undef ANDROID_NN_CONV_PARAMETERS
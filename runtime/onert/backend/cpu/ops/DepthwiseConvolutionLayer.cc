@@ -94,6 +94,37 @@ void DepthwiseConvolutionLayer::convQuant8()
       getTensorShape(_output), reinterpret_cast<uint8_t *>(_output->buffer()));
 }
 
+void DepthwiseConvolutionLayer::convQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeInt8(_activation, _output, &output_activation_min,
+                               &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.input_offset = -_input->data_offset();
+  // Filters with non-zero zero points are rejected by configure
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::DepthwiseConvPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getTensorShape(_input), reinterpret_cast<const int8_t *>(_input->buffer()),
+      getTensorShape(_kernel), reinterpret_cast<const int8_t *>(_kernel->buffer()),
+      getTensorShape(_bias), reinterpret_cast<const int32_t *>(_bias->buffer()),
+      getTensorShape(_output), reinterpret_cast<int8_t *>(_output->buffer()),
+      _per_channel_acc_buffer.data());
+}
+
 void DepthwiseConvolutionLayer::configure(const Tensor *input, const Tensor *kernel,
                                           const Tensor *bias, const uint32_t paddingLeft,
                                           const uint32_t paddingRight, const uint32_t paddingTop,
@@ -113,6 +144,15 @@ void DepthwiseConvolutionLayer::configure(const Tensor *input, const Tensor *ker
   _multiplier = multiplier;
   _activation = activation;
   _output = output;
+
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    // Quantization parameters are static, so requantization factors are computed only once
+    GetQuantizedConvolutionMultipliersAndShifts(
+        _input, _kernel, _output, getSizeOfDimension(_kernel, 3), &_per_channel_output_multiplier,
+        &_per_channel_output_shift);
+    _per_channel_acc_buffer.resize(getSizeOfDimension(_kernel, 3));
+  }
 }
 
 void DepthwiseConvolutionLayer::run()
@@ -125,6 +165,10 @@ void DepthwiseConvolutionLayer::run()
   {
     convQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    convQuant8PerChannel();
+  }
 }
 
 } // namespace ops
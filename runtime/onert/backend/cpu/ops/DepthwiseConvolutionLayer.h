@@ -21,6 +21,7 @@
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
+#include <vector>
 
 namespace onert
 {
@@ -41,6 +42,8 @@ public:
 
   void convQuant8();
 
+  void convQuant8PerChannel();
+
   void configure(const Tensor *input, const Tensor *kernel, const Tensor *bias,
                  const uint32_t paddingLeft, const uint32_t paddingRight, const uint32_t paddingTop,
                  const uint32_t paddingBottom, const uint32_t strideW, const uint32_t strideH,
@@ -71,6 +74,10 @@ private:
   uint32_t _multiplier;
 
   ir::Activation _activation;
+
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
+  std::vector<int32_t> _per_channel_acc_buffer;
 };
 
 } // namespace ops
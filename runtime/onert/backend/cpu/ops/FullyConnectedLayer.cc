@@ -102,6 +102,39 @@ void FullyConnectedLayer::fullyConnectedHybrid()
       getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()), temp_arena);
 }
 
+void FullyConnectedLayer::fullyConnectedQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeInt8(_activation, _output, &output_activation_min,
+                               &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = -_input->data_offset();
+  // Filters with non-zero zero points are rejected by configure
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_offset();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  if (_per_channel_offset_terms.empty())
+  {
+    // Weights and bias of per-channel quantization are constant, so their terms are computed once
+    nnfw::cker::PerChannelOffsetTerms(
+        getSizeOfDimension(_weights, 0), getSizeOfDimension(_weights, 1),
+        reinterpret_cast<const int8_t *>(_weights->buffer()),
+        reinterpret_cast<const int32_t *>(_bias ? _bias->buffer() : nullptr),
+        op_params.input_offset, &_per_channel_offset_terms);
+  }
+
+  nnfw::cker::FullyConnectedPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      _per_channel_offset_terms.data(), getTensorShape(_input),
+      reinterpret_cast<const int8_t *>(_input->buffer()), getTensorShape(_weights),
+      reinterpret_cast<const int8_t *>(_weights->buffer()), getTensorShape(_output),
+      reinterpret_cast<int8_t *>(_output->buffer()));
+}
+
 void FullyConnectedLayer::configure(const Tensor *input, const Tensor *weights, const Tensor *bias,
                                     ir::Activation activation, Tensor *output)
 {
@@ -110,6 +143,14 @@ void FullyConnectedLayer::configure(const Tensor *input, const Tensor *weights,
   _bias = bias;
   _activation = activation;
   _output = output;
+
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    // Quantization parameters are static, so requantization factors are computed only once
+    GetQuantizedConvolutionMultipliersAndShifts(
+        _input, _weights, _output, getSizeOfDimension(_weights, 0), &_per_channel_output_multiplier,
+        &_per_channel_output_shift);
+  }
 }
 
 void FullyConnectedLayer::run()
@@ -129,6 +170,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    fullyConnectedQuant8PerChannel();
+  }
 }
 
 } // namespace ops
@@ -21,6 +21,7 @@
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
+#include <vector>
 
 namespace nnfw
 {
@@ -52,6 +53,8 @@ public:
 
   void fullyConnectedHybrid();
 
+  void fullyConnectedQuant8PerChannel();
+
   void configure(const Tensor *input, const Tensor *weights, const Tensor *bias,
                  ir::Activation activation, Tensor *output);
 
@@ -71,6 +74,10 @@ private:
 
   ir::Activation _activation;
   std::unique_ptr<nnfw::cker::FCTempArena> _temp_arena;
+
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int32_t> _per_channel_output_shift;
+  std::vector<int32_t> _per_channel_offset_terms;
 };
 
 } // namespace ops
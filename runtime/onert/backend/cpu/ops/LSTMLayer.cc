@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LSTMLayer.h"
+
+#include <cker/operation/LSTM.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+namespace
+{
+
+template <typename T> nnfw::cker::RecurrentWeight<T> getWeight(const Tensor *tensor)
+{
+  nnfw::cker::RecurrentWeight<T> weight;
+  if (tensor != nullptr)
+  {
+    weight.data = reinterpret_cast<const T *>(tensor->buffer());
+    weight.scale = tensor->data_scale();
+  }
+  return weight;
+}
+
+const float *getBias(const Tensor *tensor)
+{
+  return tensor ? reinterpret_cast<const float *>(tensor->buffer()) : nullptr;
+}
+
+} // namespace
+
+LSTMLayer::LSTMLayer()
+    : _input(nullptr), _input_to_input_weights(nullptr), _input_to_forget_weights(nullptr),
+      _input_to_cell_weights(nullptr), _input_to_output_weights(nullptr),
+      _recurrent_to_input_weights(nullptr), _recurrent_to_forget_weights(nullptr),
+      _recurrent_to_cell_weights(nullptr), _recurrent_to_output_weights(nullptr),
+      _cell_to_input_weights(nullptr), _cell_to_forget_weights(nullptr),
+      _cell_to_output_weights(nullptr), _input_gate_bias(nullptr), _forget_gate_bias(nullptr),
+      _cell_bias(nullptr), _output_gate_bias(nullptr), _projection_weights(nullptr),
+      _projection_bias(nullptr), _output_state_in(nullptr), _cell_state_in(nullptr),
+      _scratch_buffer(nullptr), _output_state_out(nullptr), _cell_state_out(nullptr),
+      _output(nullptr), _activation(ir::Activation::NONE), _cell_threshold(0.f),
+      _projection_threshold(0.f), _constant_weights(true), _lstm_kernel(new nnfw::cker::LSTM())
+{
+  // DO NOTHING
+}
+
+LSTMLayer::~LSTMLayer() = default;
+
+template <typename T> void LSTMLayer::prepare()
+{
+  nnfw::cker::LSTMWeights<T> weights;
+  weights.input_to_input = getWeight<T>(_input_to_input_weights);
+  weights.input_to_forget = getWeight<T>(_input_to_forget_weights);
+  weights.input_to_cell = getWeight<T>(_input_to_cell_weights);
+  weights.input_to_output = getWeight<T>(_input_to_output_weights);
+  weights.recurrent_to_input = getWeight<T>(_recurrent_to_input_weights);
+  weights.recurrent_to_forget = getWeight<T>(_recurrent_to_forget_weights);
+  weights.recurrent_to_cell = getWeight<T>(_recurrent_to_cell_weights);
+  weights.recurrent_to_output = getWeight<T>(_recurrent_to_output_weights);
+  weights.cell_to_input = getWeight<T>(_cell_to_input_weights);
+  weights.cell_to_forget = getWeight<T>(_cell_to_forget_weights);
+  weights.cell_to_output = getWeight<T>(_cell_to_output_weights);
+  weights.projection = getWeight<T>(_projection_weights);
+  weights.input_gate_bias = getBias(_input_gate_bias);
+  weights.forget_gate_bias = getBias(_forget_gate_bias);
+  weights.cell_bias = getBias(_cell_bias);
+  weights.output_gate_bias = getBias(_output_gate_bias);
+  weights.projection_bias = getBias(_projection_bias);
+
+  const int n_input = getSizeOfDimension(_input_to_output_weights, 1);
+  const int n_cell = getSizeOfDimension(_input_to_output_weights, 0);
+  const int n_output = getSizeOfDimension(_recurrent_to_output_weights, 1);
+  _lstm_kernel->prepare(n_input, n_cell, n_output, weights);
+}
+
+void LSTMLayer::lstm()
+{
+  nnfw::cker::LSTMParams op_params;
+  op_params.activation = convertActivationType(_activation);
+  op_params.cell_clip = _cell_threshold;
+  op_params.proj_clip = _projection_threshold;
+
+  (*_lstm_kernel)(op_params, getTensorShape(_input),
+                  reinterpret_cast<const float *>(_input->buffer()),
+                  reinterpret_cast<const float *>(_output_state_in->buffer()),
+                  reinterpret_cast<const float *>(_cell_state_in->buffer()),
+                  reinterpret_cast<float *>(_scratch_buffer->buffer()),
+                  reinterpret_cast<float *>(_output_state_out->buffer()),
+                  reinterpret_cast<float *>(_cell_state_out->buffer()),
+                  reinterpret_cast<float *>(_output->buffer()));
+}
+
+void LSTMLayer::lstmFloat32()
+{
+  if (!_lstm_kernel->prepared() || !_constant_weights)
+  {
+    prepare<float>();
+  }
+  lstm();
+}
+
+void LSTMLayer::lstmHybrid()
+{
+  if (!_lstm_kernel->prepared() || !_constant_weights)
+  {
+    prepare<int8_t>();
+  }
+  lstm();
+}
+
+void LSTMLayer::configure(
+    const Tensor *input, const Tensor *input_to_input_weights,
+    const Tensor *input_to_forget_weights, const Tensor *input_to_cell_weights,
+    const Tensor *input_to_output_weights, const Tensor *recurrent_to_input_weights,
+    const Tensor *recurrent_to_forget_weights, const Tensor *recurrent_to_cell_weights,
+    const Tensor *recurrent_to_output_weights, const Tensor *cell_to_input_weights,
+    const Tensor *cell_to_forget_weights, const Tensor *cell_to_output_weights,
+    const Tensor *input_gate_bias, const Tensor *forget_gate_bias, const Tensor *cell_bias,
+    const Tensor *output_gate_bias, const Tensor *projection_weights,
+    const Tensor *projection_bias, const Tensor *output_state_in, const Tensor *cell_state_in,
+    ir::Activation activation, float cell_threshold, float projection_threshold,
+    Tensor *scratch_buffer, Tensor *output_state_out, Tensor *cell_state_out, Tensor *output,
+    bool constant_weights)
+{
+  _input = input;
+  _input_to_input_weights = input_to_input_weights;
+  _input_to_forget_weights = input_to_forget_weights;
+  _input_to_cell_weights = input_to_cell_weights;
+  _input_to_output_weights = input_to_output_weights;
+  _recurrent_to_input_weights = recurrent_to_input_weights;
+  _recurrent_to_forget_weights = recurrent_to_forget_weights;
+  _recurrent_to_cell_weights = recurrent_to_cell_weights;
+  _recurrent_to_output_weights = recurrent_to_output_weights;
+  _cell_to_input_weights = cell_to_input_weights;
+  _cell_to_forget_weights = cell_to_forget_weights;
+  _cell_to_output_weights = cell_to_output_weights;
+  _input_gate_bias = input_gate_bias;
+  _forget_gate_bias = forget_gate_bias;
+  _cell_bias = cell_bias;
+  _output_gate_bias = output_gate_bias;
+  _projection_weights = projection_weights;
+  _projection_bias = projection_bias;
+  _output_state_in = output_state_in;
+  _cell_state_in = cell_state_in;
+  _activation = activation;
+  _cell_threshold = cell_threshold;
+  _projection_threshold = projection_threshold;
+  _scratch_buffer = scratch_buffer;
+  _output_state_out = output_state_out;
+  _cell_state_out = cell_state_out;
+  _output = output;
+  _constant_weights = constant_weights;
+}
+
+void LSTMLayer::run()
+{
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    if (_input_to_output_weights->data_type() == OperandType::QUANT_INT8_SYMM)
+    {
+      lstmHybrid();
+    }
+    else
+    {
+      lstmFloat32();
+    }
+  }
+  else
+  {
+    throw std::runtime_error{"LSTM: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
+
+#include "../Tensor.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+class LSTM;
+}
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+// Optional operands are nullptr if they are absent
+class LSTMLayer : public ::onert::exec::IFunction
+{
+public:
+  LSTMLayer();
+  ~LSTMLayer();
+
+public:
+  void lstmFloat32();
+
+  void lstmHybrid();
+
+  void configure(const Tensor *input, const Tensor *input_to_input_weights,
+                 const Tensor *input_to_forget_weights, const Tensor *input_to_cell_weights,
+                 const Tensor *input_to_output_weights, const Tensor *recurrent_to_input_weights,
+                 const Tensor *recurrent_to_forget_weights,
+                 const Tensor *recurrent_to_cell_weights,
+                 const Tensor *recurrent_to_output_weights, const Tensor *cell_to_input_weights,
+                 const Tensor *cell_to_forget_weights, const Tensor *cell_to_output_weights,
+                 const Tensor *input_gate_bias, const Tensor *forget_gate_bias,
+                 const Tensor *cell_bias, const Tensor *output_gate_bias,
+                 const Tensor *projection_weights, const Tensor *projection_bias,
+                 const Tensor *output_state_in, const Tensor *cell_state_in,
+                 ir::Activation activation, float cell_threshold, float projection_threshold,
+                 Tensor *scratch_buffer, Tensor *output_state_out, Tensor *cell_state_out,
+                 Tensor *output, bool constant_weights);
+
+  void run();
+  void runSync()
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  template <typename T> void prepare();
+  void lstm();
+
+private:
+  const Tensor *_input;
+  const Tensor *_input_to_input_weights;
+  const Tensor *_input_to_forget_weights;
+  const Tensor *_input_to_cell_weights;
+  const Tensor *_input_to_output_weights;
+  const Tensor *_recurrent_to_input_weights;
+  const Tensor *_recurrent_to_forget_weights;
+  const Tensor *_recurrent_to_cell_weights;
+  const Tensor *_recurrent_to_output_weights;
+  const Tensor *_cell_to_input_weights;
+  const Tensor *_cell_to_forget_weights;
+  const Tensor *_cell_to_output_weights;
+  const Tensor *_input_gate_bias;
+  const Tensor *_forget_gate_bias;
+  const Tensor *_cell_bias;
+  const Tensor *_output_gate_bias;
+  const Tensor *_projection_weights;
+  const Tensor *_projection_bias;
+  const Tensor *_output_state_in;
+  const Tensor *_cell_state_in;
+  Tensor *_scratch_buffer;
+  Tensor *_output_state_out;
+  Tensor *_cell_state_out;
+  Tensor *_output;
+
+  ir::Activation _activation;
+  float _cell_threshold;
+  float _projection_threshold;
+  // Weights given as model inputs may change between runs, so they are packed on every run
+  bool _constant_weights;
+
+  std::unique_ptr<nnfw::cker::LSTM> _lstm_kernel;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_LSTMLAYER_H__
@@ -93,6 +93,34 @@ void GetQuantizedConvolutionMultiplier(const Tensor *input, const Tensor *filter
   *multiplier = input_product_scale / output_scale;
 }
 
+void GetQuantizedConvolutionMultipliersAndShifts(const Tensor *input, const Tensor *filter,
+                                                 const Tensor *output, int num_channels,
+                                                 std::vector<int32_t> *per_channel_multiplier,
+                                                 std::vector<int32_t> *per_channel_shift)
+{
+  // Kernels take filters as symmetrically quantized and ignore their zero points
+  const auto &filter_offsets = filter->data_offsets();
+  if (filter->data_offset() != 0 ||
+      std::any_of(filter_offsets.begin(), filter_offsets.end(),
+                  [](int32_t offset) { return offset != 0; }))
+    throw std::runtime_error("Quantized int8 filter with non-zero zero point is not supported.");
+
+  // A per-tensor quantized filter shares its scale among all the channels
+  const auto &filter_scales = filter->data_scales();
+  assert(filter_scales.empty() || filter_scales.size() == static_cast<size_t>(num_channels));
+  per_channel_multiplier->resize(num_channels);
+  per_channel_shift->resize(num_channels);
+  for (int i = 0; i < num_channels; ++i)
+  {
+    const double filter_scale = filter_scales.empty() ? filter->data_scale() : filter_scales[i];
+    const double effective_output_scale =
+        static_cast<double>(input->data_scale()) * filter_scale / output->data_scale();
+    int shift = 0;
+    QuantizeMultiplier(effective_output_scale, &per_channel_multiplier->at(i), &shift);
+    per_channel_shift->at(i) = shift;
+  }
+}
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift)
 {
@@ -144,11 +172,13 @@ void CalculateActivationRangeFloat(ir::Activation activation, float *activation_
   }
 }
 
-void CalculateActivationRangeUint8(ir::Activation activation, const Tensor *output,
-                                   int32_t *act_min, int32_t *act_max)
+namespace
+{
+
+void CalculateActivationRangeQuantized(ir::Activation activation, const Tensor *output,
+                                       int32_t qmin, int32_t qmax, int32_t *act_min,
+                                       int32_t *act_max)
 {
-  const int32_t qmin = std::numeric_limits<uint8_t>::min();
-  const int32_t qmax = std::numeric_limits<uint8_t>::max();
   const auto scale = output->data_scale();
   const auto zero_point = output->data_offset();
   auto quantize = [scale, zero_point](float f) {
@@ -185,6 +215,22 @@ void CalculateActivationRangeUint8(ir::Activation activation, const Tensor *outp
   }
 }
 
+} // namespace
+
+void CalculateActivationRangeUint8(ir::Activation activation, const Tensor *output,
+                                   int32_t *act_min, int32_t *act_max)
+{
+  CalculateActivationRangeQuantized(activation, output, std::numeric_limits<uint8_t>::min(),
+                                    std::numeric_limits<uint8_t>::max(), act_min, act_max);
+}
+
+void CalculateActivationRangeInt8(ir::Activation activation, const Tensor *output,
+                                  int32_t *act_min, int32_t *act_max)
+{
+  CalculateActivationRangeQuantized(activation, output, std::numeric_limits<int8_t>::min(),
+                                    std::numeric_limits<int8_t>::max(), act_min, act_max);
+}
+
 bool HaveSameShapes(const Tensor *input1, const Tensor *input2)
 {
   if (input1 == input2)
@@ -231,6 +277,7 @@ uint32_t sizeOfData(OperandType type, const std::vector<uint32_t> &dimensions)
     case OperandType::BOOL8:
     case OperandType::QUANT_UINT8_ASYMM:
     case OperandType::QUANT_INT8_SYMM:
+    case OperandType::QUANT_INT8_ASYMM:
       size = 1;
       break;
     default:
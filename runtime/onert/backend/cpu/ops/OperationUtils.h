@@ -108,6 +108,10 @@ convertActivationType(const ir::Activation activation)
       return nnfw::cker::FusedActivationFunctionType::kRelu1;
     case ir::Activation::RELU6:
       return nnfw::cker::FusedActivationFunctionType::kRelu6;
+    case ir::Activation::TANH:
+      return nnfw::cker::FusedActivationFunctionType::kTanh;
+    case ir::Activation::SIGMOID:
+      return nnfw::cker::FusedActivationFunctionType::kSigmoid;
     default:
       throw std::runtime_error{"CPU backend: Cannot convert activation type"};
   }
@@ -138,6 +142,11 @@ void GetQuantizedConvolutionMultiplier(const Tensor *inputDescr, const Tensor *f
                                        const Tensor *biasDescr, const Tensor *outputDescr,
                                        double *multiplier);
 
+void GetQuantizedConvolutionMultipliersAndShifts(const Tensor *input, const Tensor *filter,
+                                                 const Tensor *output, int num_channels,
+                                                 std::vector<int32_t> *per_channel_multiplier,
+                                                 std::vector<int32_t> *per_channel_shift);
+
 void QuantizeMultiplierGreaterThanOne(double double_multiplier, int32_t *quantized_multiplier,
                                       int *left_shift);
 
@@ -147,6 +156,9 @@ void CalculateActivationRangeFloat(ir::Activation activation, float *activation_
 void CalculateActivationRangeUint8(ir::Activation activation, const Tensor *output,
                                    int32_t *act_min, int32_t *act_max);
 
+void CalculateActivationRangeInt8(ir::Activation activation, const Tensor *output,
+                                  int32_t *act_min, int32_t *act_max);
+
 bool HaveSameShapes(const Tensor *input1, const Tensor *input2);
 
 int32_t CalculateInputRadius(int input_integer_bits, int input_left_shift);
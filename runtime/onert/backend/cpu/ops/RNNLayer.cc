@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RNNLayer.h"
+
+#include <cker/operation/RNN.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+namespace
+{
+
+template <typename T> nnfw::cker::RecurrentWeight<T> getWeight(const Tensor *tensor)
+{
+  nnfw::cker::RecurrentWeight<T> weight;
+  weight.data = reinterpret_cast<const T *>(tensor->buffer());
+  weight.scale = tensor->data_scale();
+  return weight;
+}
+
+} // namespace
+
+RNNLayer::RNNLayer()
+    : _input(nullptr), _weights(nullptr), _recurrent_weights(nullptr), _bias(nullptr),
+      _hidden_state_in(nullptr), _output(nullptr), _hidden_state_out(nullptr),
+      _activation(ir::Activation::NONE), _constant_weights(true), _rnn_kernel(new nnfw::cker::RNN())
+{
+  // DO NOTHING
+}
+
+RNNLayer::~RNNLayer() = default;
+
+void RNNLayer::rnn()
+{
+  (*_rnn_kernel)(convertActivationType(_activation), getTensorShape(_input),
+                 reinterpret_cast<const float *>(_input->buffer()),
+                 reinterpret_cast<const float *>(_hidden_state_in->buffer()),
+                 reinterpret_cast<const float *>(_bias->buffer()),
+                 reinterpret_cast<float *>(_output->buffer()),
+                 reinterpret_cast<float *>(_hidden_state_out->buffer()));
+}
+
+void RNNLayer::rnnFloat32()
+{
+  if (!_rnn_kernel->prepared() || !_constant_weights)
+  {
+    _rnn_kernel->prepare(getSizeOfDimension(_weights, 1), getSizeOfDimension(_weights, 0),
+                         getWeight<float>(_weights), getWeight<float>(_recurrent_weights));
+  }
+  rnn();
+}
+
+void RNNLayer::rnnHybrid()
+{
+  if (!_rnn_kernel->prepared() || !_constant_weights)
+  {
+    _rnn_kernel->prepare(getSizeOfDimension(_weights, 1), getSizeOfDimension(_weights, 0),
+                         getWeight<int8_t>(_weights), getWeight<int8_t>(_recurrent_weights));
+  }
+  rnn();
+}
+
+void RNNLayer::configure(const Tensor *input, const Tensor *weights,
+                         const Tensor *recurrent_weights, const Tensor *bias,
+                         const Tensor *hidden_state_in, ir::Activation activation, Tensor *output,
+                         Tensor *hidden_state_out, bool constant_weights)
+{
+  _input = input;
+  _weights = weights;
+  _recurrent_weights = recurrent_weights;
+  _bias = bias;
+  _hidden_state_in = hidden_state_in;
+  _activation = activation;
+  _output = output;
+  _hidden_state_out = hidden_state_out;
+  _constant_weights = constant_weights;
+}
+
+void RNNLayer::run()
+{
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    if (_weights->data_type() == OperandType::QUANT_INT8_SYMM)
+    {
+      rnnHybrid();
+    }
+    else
+    {
+      rnnFloat32();
+    }
+  }
+  else
+  {
+    throw std::runtime_error{"RNN: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
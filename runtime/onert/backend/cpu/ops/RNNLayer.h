@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_RNNLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_RNNLAYER_H__
+
+#include "../Tensor.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+class RNN;
+}
+} // namespace nnfw
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class RNNLayer : public ::onert::exec::IFunction
+{
+public:
+  RNNLayer();
+  ~RNNLayer();
+
+public:
+  void rnnFloat32();
+
+  void rnnHybrid();
+
+  void configure(const Tensor *input, const Tensor *weights, const Tensor *recurrent_weights,
+                 const Tensor *bias, const Tensor *hidden_state_in, ir::Activation activation,
+                 Tensor *output, Tensor *hidden_state_out, bool constant_weights);
+
+  void run();
+  void runSync()
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  void rnn();
+
+private:
+  const Tensor *_input;
+  const Tensor *_weights;
+  const Tensor *_recurrent_weights;
+  const Tensor *_bias;
+  const Tensor *_hidden_state_in;
+  Tensor *_output;
+  Tensor *_hidden_state_out;
+
+  ir::Activation _activation;
+  // Weights given as model inputs may change between runs, so they are packed on every run
+  bool _constant_weights;
+
+  std::unique_ptr<nnfw::cker::RNN> _rnn_kernel;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_RNNLAYER_H__
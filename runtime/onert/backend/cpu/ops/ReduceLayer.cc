@@ -32,15 +32,14 @@ namespace ops
 namespace
 {
 
-template <typename T>
+template <typename T, typename Reducer>
 void evalLogic(const Tensor *input, Tensor *output, const std::vector<int> &axes, bool keep_dims,
-               T init_value, nnfw::cker::Reduce &reduce_kernel,
-               T reducer(const T current, const T in))
+               nnfw::cker::Reduce &reduce_kernel)
 {
   reduce_kernel.prepare(input->num_dimensions(), axes.size());
-  bool result = reduce_kernel.ReduceGeneric<T>(
+  bool result = reduce_kernel.ReduceWith<T, Reducer>(
       getTensorShape(input), reinterpret_cast<const T *>(input->buffer()), getTensorShape(output),
-      reinterpret_cast<T *>(output->buffer()), axes, keep_dims, init_value, reducer);
+      reinterpret_cast<T *>(output->buffer()), axes, keep_dims);
 
   if (!result)
   {
@@ -55,22 +54,20 @@ void evalType(const Tensor *input, Tensor *output, const std::vector<int> &axes,
   switch (reduce_type)
   {
     case ReduceType::kSum:
-      return evalLogic<T>(input, output, axes, keep_dims, static_cast<T>(0), reduce_kernel,
-                          [](const T current, const T in) -> T { return in + current; });
+      return evalLogic<T, nnfw::cker::optimized::SumReducer<T>>(input, output, axes, keep_dims,
+                                                                reduce_kernel);
       break;
     case ReduceType::kProd:
-      return evalLogic<T>(input, output, axes, keep_dims, static_cast<T>(1), reduce_kernel,
-                          [](const T current, const T in) -> T { return in * current; });
+      return evalLogic<T, nnfw::cker::optimized::ProdReducer<T>>(input, output, axes, keep_dims,
+                                                                 reduce_kernel);
       break;
     case ReduceType::kMax:
-      return evalLogic<T>(
-          input, output, axes, keep_dims, std::numeric_limits<T>::lowest(), reduce_kernel,
-          [](const T current, const T in) -> T { return (in > current) ? in : current; });
+      return evalLogic<T, nnfw::cker::optimized::MaxReducer<T>>(input, output, axes, keep_dims,
+                                                                reduce_kernel);
       break;
     case ReduceType::kMin:
-      return evalLogic<T>(
-          input, output, axes, keep_dims, std::numeric_limits<T>::max(), reduce_kernel,
-          [](const T current, const T in) -> T { return (in < current) ? in : current; });
+      return evalLogic<T, nnfw::cker::optimized::MinReducer<T>>(input, output, axes, keep_dims,
+                                                                reduce_kernel);
       break;
     default:
       throw std::runtime_error{"Reduce: Unsupported reduce type"};
@@ -85,14 +82,12 @@ void evalType<bool>(const Tensor *input, Tensor *output, const std::vector<int>
   switch (reduce_type)
   {
     case ReduceType::kAny:
-      return evalLogic<bool>(
-          input, output, axes, keep_dims, false, reduce_kernel,
-          [](const bool current, const bool in) -> bool { return in || current; });
+      return evalLogic<bool, nnfw::cker::optimized::AnyReducer>(input, output, axes, keep_dims,
+                                                                reduce_kernel);
       break;
     case ReduceType::kAll:
-      return evalLogic<bool>(
-          input, output, axes, keep_dims, true, reduce_kernel,
-          [](const bool current, const bool in) -> bool { return in && current; });
+      return evalLogic<bool, nnfw::cker::optimized::AllReducer>(input, output, axes, keep_dims,
+                                                                reduce_kernel);
       break;
     default:
       throw std::runtime_error{"Reduce: Unsupported reduce type"};
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SeparableConvolutionLayer.h"
+
+#include <cker/operation/SeparableConv.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+SeparableConvolutionLayer::SeparableConvolutionLayer()
+    : _input(nullptr), _dw_kernel(nullptr), _dw_bias(nullptr), _pw_kernel(nullptr),
+      _pw_bias(nullptr), _output(nullptr), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
+      _paddingBottom(0), _strideWidth(0), _strideHeight(0), _multiplier(0),
+      _dw_activation(ir::Activation::NONE), _activation(ir::Activation::NONE)
+{
+  // DO NOTHING
+}
+
+void SeparableConvolutionLayer::convFloat32()
+{
+  float dw_activation_min, dw_activation_max;
+  CalculateActivationRangeFloat(_dw_activation, &dw_activation_min, &dw_activation_max);
+  float output_activation_min, output_activation_max;
+  CalculateActivationRangeFloat(_activation, &output_activation_min, &output_activation_max);
+
+  nnfw::cker::SeparableConvParams op_params;
+  op_params.padding_type = nnfw::cker::PaddingType::kNone;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.depth_multiplier = _multiplier;
+  op_params.depthwise_activation_min = dw_activation_min;
+  op_params.depthwise_activation_max = dw_activation_max;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+
+  nnfw::cker::SeparableConv(
+      op_params, getTensorShape(_input), reinterpret_cast<const float *>(_input->buffer()),
+      getTensorShape(_dw_kernel), reinterpret_cast<const float *>(_dw_kernel->buffer()),
+      getTensorShape(_dw_bias), reinterpret_cast<const float *>(_dw_bias->buffer()),
+      getTensorShape(_pw_kernel), reinterpret_cast<const float *>(_pw_kernel->buffer()),
+      getTensorShape(_pw_bias), reinterpret_cast<const float *>(_pw_bias->buffer()),
+      getTensorShape(_output), reinterpret_cast<float *>(_output->buffer()));
+}
+
+void SeparableConvolutionLayer::configure(const Tensor *input, const Tensor *dw_kernel,
+                                          const Tensor *dw_bias, const Tensor *pw_kernel,
+                                          const Tensor *pw_bias, const uint32_t paddingLeft,
+                                          const uint32_t paddingRight, const uint32_t paddingTop,
+                                          const uint32_t paddingBottom, const uint32_t strideWidth,
+                                          const uint32_t strideHeight, const uint32_t multiplier,
+                                          const ir::Activation dw_activation,
+                                          const ir::Activation activation, Tensor *output)
+{
+  _input = input;
+  _dw_kernel = dw_kernel;
+  _dw_bias = dw_bias;
+  _pw_kernel = pw_kernel;
+  _pw_bias = pw_bias;
+  _paddingLeft = paddingLeft;
+  _paddingRight = paddingRight;
+  _paddingTop = paddingTop;
+  _paddingBottom = paddingBottom;
+  _strideWidth = strideWidth;
+  _strideHeight = strideHeight;
+  _multiplier = multiplier;
+  _dw_activation = dw_activation;
+  _activation = activation;
+  _output = output;
+}
+
+void SeparableConvolutionLayer::run()
+{
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    convFloat32();
+  }
+  else
+  {
+    throw std::runtime_error{"SeparableConv: unsupported data type"};
+  }
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
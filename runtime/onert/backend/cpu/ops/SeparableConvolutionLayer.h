@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_SEPARABLECONVOLUTIONLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_SEPARABLECONVOLUTIONLAYER_H__
+
+#include "../Tensor.h"
+#include "OperationUtils.h"
+
+#include <exec/IFunction.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class SeparableConvolutionLayer : public ::onert::exec::IFunction
+{
+public:
+  SeparableConvolutionLayer();
+
+public:
+  void convFloat32();
+
+  void configure(const Tensor *input, const Tensor *dw_kernel, const Tensor *dw_bias,
+                 const Tensor *pw_kernel, const Tensor *pw_bias, const uint32_t paddingLeft,
+                 const uint32_t paddingRight, const uint32_t paddingTop,
+                 const uint32_t paddingBottom, const uint32_t strideW, const uint32_t strideH,
+                 const uint32_t multiplier, const ir::Activation dw_activation,
+                 const ir::Activation activation, Tensor *output);
+
+  void run();
+  void runSync()
+  {
+    // this abstract method is used just for profiling and called for
+    // backend::acl_common::AclFunction
+    run();
+  }
+
+private:
+  const Tensor *_input;
+  const Tensor *_dw_kernel;
+  const Tensor *_dw_bias;
+  const Tensor *_pw_kernel;
+  const Tensor *_pw_bias;
+  Tensor *_output;
+
+  uint32_t _paddingLeft;
+  uint32_t _paddingTop;
+  uint32_t _paddingRight;
+  uint32_t _paddingBottom;
+
+  uint32_t _strideWidth;
+  uint32_t _strideHeight;
+
+  uint32_t _multiplier;
+
+  ir::Activation _dw_activation;
+  ir::Activation _activation;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_SEPARABLECONVOLUTIONLAYER_H__
@@ -38,12 +38,22 @@ class Allocator
 {
 public:
   Allocator(uint32_t capacity);
+  /**
+   * @brief Construct an Allocator taking the ownership of memory allocated elsewhere
+   * @param base Memory to own
+   */
+  Allocator(std::unique_ptr<uint8_t[]> &&base) : _base{std::move(base)} {}
   /**
    * @brief Get memory base pointer
    * @return base pointer
    */
   uint8_t *base() const { return _base.get(); }
   void release() { _base.reset(); }
+  /**
+   * @brief Give up the ownership of memory without freeing it
+   * @return The memory, or nullptr if it has been released
+   */
+  std::unique_ptr<uint8_t[]> detach() { return std::move(_base); }
 
 private:
   std::unique_ptr<uint8_t[]> _base;
@@ -16,7 +16,9 @@
 
 #include "MemoryManager.h"
 
+#include <algorithm>
 #include <cassert>
+#include <stdexcept>
 
 #include <MemoryPlannerFactory.h>
 #include "util/ConfigSource.h"
@@ -70,22 +72,77 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
   return _mem_alloc->base() + mem_blk.offset;
 }
 
+size_t DynamicMemoryManager::sizeClass(size_t size)
+{
+  constexpr size_t min_size_class = 64;
+  if (size <= min_size_class)
+    return min_size_class;
+
+  // Four size classes between two powers of two keep the waste under 25%
+  size_t msb = min_size_class;
+  while ((msb << 1) <= size)
+    msb <<= 1;
+  const size_t step = msb / 4;
+  return (size + step - 1) / step * step;
+}
+
 std::shared_ptr<cpu_common::Allocator> DynamicMemoryManager::allocate(const ir::OperandIndex &ind,
                                                                       uint32_t capacity)
 {
-  auto mem_alloc = std::make_shared<cpu_common::Allocator>(capacity);
+  recycle(ind);
+
+  const auto size_class = sizeClass(capacity);
+  std::unique_ptr<uint8_t[]> base;
+  auto &free_blocks = _free_blocks[size_class];
+  if (!free_blocks.empty())
+  {
+    base = std::move(free_blocks.back());
+    free_blocks.pop_back();
+    _stats.hits++;
+  }
+  else
+  {
+    base = std::make_unique<uint8_t[]>(size_class);
+    _stats.reserved_bytes += size_class;
+    _stats.misses++;
+  }
+
+  _in_use_bytes += size_class;
+  _stats.peak_bytes = std::max(_stats.peak_bytes, _in_use_bytes);
+
+  auto mem_alloc = std::make_shared<cpu_common::Allocator>(std::move(base));
   _mem_alloc_map[ind] = mem_alloc;
+  _size_class_map[ind] = size_class;
   return mem_alloc;
 }
 
+void DynamicMemoryManager::recycle(const ir::OperandIndex &ind)
+{
+  auto find = _size_class_map.find(ind);
+  if (find == _size_class_map.end() || find->second == 0)
+    return;
+
+  const auto size_class = find->second;
+  find->second = 0;
+  _in_use_bytes -= size_class;
+
+  auto base = _mem_alloc_map.at(ind)->detach();
+  if (base == nullptr)
+  {
+    // The memory has been freed by the owner of the Allocator
+    _stats.reserved_bytes -= size_class;
+    return;
+  }
+  _free_blocks[size_class].emplace_back(std::move(base));
+}
+
 void DynamicMemoryManager::deallocate(const ir::OperandIndex &ind)
 {
   auto find = _mem_alloc_map.find(ind);
   if (find == _mem_alloc_map.end())
     throw std::runtime_error("Cannot find Allocator for the requested index");
 
-  auto alloc = find->second;
-  alloc.reset();
+  recycle(ind);
 }
 
 void DynamicMemoryManager::deallocate(void)
@@ -94,6 +151,13 @@ void DynamicMemoryManager::deallocate(void)
   {
     mem_alloc.second->release();
   }
+  for (auto &size_class : _size_class_map)
+  {
+    size_class.second = 0;
+  }
+  _free_blocks.clear();
+  _in_use_bytes = 0;
+  _stats.reserved_bytes = 0;
 }
 
 } // namespace cpu_common
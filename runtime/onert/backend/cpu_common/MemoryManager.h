@@ -21,6 +21,9 @@
 #include "MemoryPlanner.h"
 #include "ir/OperandIndexMap.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -52,18 +55,65 @@ private:
   std::shared_ptr<cpu_common::Allocator> _mem_alloc;
 };
 
+/**
+ * @brief Statistics of DynamicMemoryManager
+ */
+struct DynamicMemoryStats
+{
+  // Largest number of bytes given to tensors at the same time
+  size_t peak_bytes = 0;
+  // Number of bytes held by the manager, including ones kept in the pool
+  size_t reserved_bytes = 0;
+  // Number of allocations served from the pool
+  uint64_t hits = 0;
+  // Number of allocations which needed new memory
+  uint64_t misses = 0;
+};
+
+/**
+ * @brief Memory manager for dynamic tensors
+ *
+ * Deallocated memory is kept in a pool bucketed by size class and reused by later allocations,
+ * so running a dynamic model repeatedly does not go to the heap once the pool is warmed up.
+ */
 class DynamicMemoryManager
 {
 public:
   DynamicMemoryManager() = default;
   virtual ~DynamicMemoryManager() = default;
 
+  /**
+   * @brief Allocate memory for an operand
+   * @note  Memory given to the operand before goes back to the pool
+   */
   std::shared_ptr<cpu_common::Allocator> allocate(const ir::OperandIndex &ind, uint32_t capacity);
+  /**
+   * @brief Return memory of an operand to the pool
+   * @note  Allocator given to the operand has no memory afterwards
+   */
   void deallocate(const ir::OperandIndex &ind);
+  /**
+   * @brief Free all memory including the pool
+   */
   void deallocate(void);
 
+  const DynamicMemoryStats &stats() const { return _stats; }
+
+  /**
+   * @brief Get the size class which memory of the given size is taken from
+   */
+  static size_t sizeClass(size_t size);
+
+private:
+  void recycle(const ir::OperandIndex &ind);
+
 private:
   ir::OperandIndexMap<std::shared_ptr<cpu_common::Allocator>> _mem_alloc_map;
+  // Size class of memory given to each operand, 0 if the operand has none
+  ir::OperandIndexMap<size_t> _size_class_map;
+  std::unordered_map<size_t, std::vector<std::unique_ptr<uint8_t[]>>> _free_blocks;
+  size_t _in_use_bytes = 0;
+  DynamicMemoryStats _stats;
 };
 
 } // namespace cpu_common
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "MemoryManager.h"
+
+using onert::backend::cpu_common::DynamicMemoryManager;
+using onert::ir::OperandIndex;
+
+TEST(DynamicMemoryManager, size_class)
+{
+  ASSERT_EQ(DynamicMemoryManager::sizeClass(1), 64);
+  ASSERT_EQ(DynamicMemoryManager::sizeClass(64), 64);
+  ASSERT_EQ(DynamicMemoryManager::sizeClass(65), 80);
+  ASSERT_EQ(DynamicMemoryManager::sizeClass(128), 128);
+  ASSERT_EQ(DynamicMemoryManager::sizeClass(1000), 1024);
+  ASSERT_EQ(DynamicMemoryManager::sizeClass(1025), 1280);
+}
+
+TEST(DynamicMemoryManager, reuse_deallocated)
+{
+  DynamicMemoryManager mgr;
+
+  auto alloc0 = mgr.allocate(OperandIndex{0}, 1000);
+  ASSERT_NE(alloc0->base(), nullptr);
+  auto base0 = alloc0->base();
+  mgr.deallocate(OperandIndex{0});
+  ASSERT_EQ(alloc0->base(), nullptr);
+
+  // Memory of the same size class comes from the pool
+  auto alloc1 = mgr.allocate(OperandIndex{1}, 900);
+  ASSERT_EQ(alloc1->base(), base0);
+
+  const auto &stats = mgr.stats();
+  ASSERT_EQ(stats.hits, 1);
+  ASSERT_EQ(stats.misses, 1);
+  ASSERT_EQ(stats.peak_bytes, 1024);
+  ASSERT_EQ(stats.reserved_bytes, 1024);
+}
+
+TEST(DynamicMemoryManager, reallocate_same_operand)
+{
+  DynamicMemoryManager mgr;
+
+  auto alloc0 = mgr.allocate(OperandIndex{0}, 100);
+  auto alloc1 = mgr.allocate(OperandIndex{0}, 2000);
+  ASSERT_EQ(alloc0->base(), nullptr);
+  ASSERT_NE(alloc1->base(), nullptr);
+
+  auto alloc2 = mgr.allocate(OperandIndex{1}, 100);
+  ASSERT_NE(alloc2->base(), nullptr);
+
+  const auto &stats = mgr.stats();
+  ASSERT_EQ(stats.hits, 1);
+  ASSERT_EQ(stats.misses, 2);
+  ASSERT_EQ(stats.peak_bytes, 2048 + 112);
+
+  mgr.deallocate();
+  ASSERT_EQ(alloc1->base(), nullptr);
+  ASSERT_EQ(alloc2->base(), nullptr);
+  ASSERT_EQ(mgr.stats().reserved_bytes, 0);
+}
+
+TEST(DynamicMemoryManager, neg_deallocate_unknown)
+{
+  DynamicMemoryManager mgr;
+
+  EXPECT_ANY_THROW(mgr.deallocate(OperandIndex{0}));
+}
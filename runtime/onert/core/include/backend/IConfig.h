@@ -41,6 +41,10 @@ struct IConfig
 
   virtual bool supportDynamicTensor() = 0;
   virtual bool supportFP16() = 0;
+  // Whether contexts and kernels for different graphs can be generated at the same time
+  virtual bool supportConcurrentCompile() { return false; }
+  // Whether kernels of the backend can run at the same time on different threads
+  virtual bool supportConcurrentExecution() { return false; }
 
   // Timer is used for backend profiling. In case of default (nullptr) timer profiler won't work.
   virtual std::unique_ptr<util::ITimer> timer() { return nullptr; }
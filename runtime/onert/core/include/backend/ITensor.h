@@ -47,6 +47,15 @@ public:
   virtual bool has_padding() const = 0;
   virtual void access(const std::function<void(ITensor &tensor)> &fn) = 0;
 
+  /**
+   * @brief Make the tensor use a buffer given by the caller instead of its own memory
+   * @note  The caller must keep the buffer alive and large enough while the tensor uses it.
+   *        This can be called repeatedly to switch the tensor between buffers.
+   * @return false if the memory of the tensor cannot be replaced, e.g. constant tensors,
+   *         dynamic tensors or tensors whose memory is managed by a library
+   */
+  virtual bool setExternalBuffer(uint8_t * /* buffer */) { return false; }
+
   /**
    * @brief Return true if the tensor needs dynamic allocation, meaning that during compile-time
    *        the outpus shape cannot be known and the output shape is calculated during
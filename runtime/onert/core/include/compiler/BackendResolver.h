@@ -41,6 +41,8 @@ public:
     _gen_map[index] = backend;
   }
 
+  void removeBackend(const ir::OperationIndex &index) { _gen_map.erase(index); }
+
   void
   iterate(const std::function<void(const ir::OperationIndex &, const backend::Backend &)> &fn) const
   {
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  CompiledArtifact.h
+ * @brief This file contains CompiledArtifact class to reuse compilation results
+ */
+
+#ifndef __ONERT_COMPILER_COMPILED_ARTIFACT_H__
+#define __ONERT_COMPILER_COMPILED_ARTIFACT_H__
+
+#include "compiler/Compiler.h"
+#include "ir/Index.h"
+#include "ir/OpCode.h"
+#include "ir/OperationIndexMap.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Compilation results which are saved to a file to skip them on the next compilation
+ *
+ * An artifact is valid only for the model and the compiler options it has been made with. This
+ * is checked with the key given when it is loaded. The file is not portable between hosts of
+ * different endianness.
+ */
+class CompiledArtifact
+{
+public:
+  /**
+   * @brief Backend assignment of a subgraph decided by a scheduler
+   */
+  struct Schedule
+  {
+    // Backend id of each operation
+    ir::OperationIndexMap<std::string> backends;
+    // Kind of each operation, to check if the schedule fits a graph
+    ir::OperationIndexMap<ir::OpCode> opcodes;
+    // Ranks of operations given by HEScheduler, nullptr if not used
+    std::shared_ptr<ir::OperationIndexMap<int64_t>> indexed_ranks;
+  };
+
+public:
+  // Version of the file format, which must be increased whenever the format changes
+  static constexpr uint32_t VERSION = 2;
+
+  /**
+   * @brief Hash data with 64-bit FNV-1a
+   * @param data Data to hash
+   * @param size Size of data in bytes
+   * @param seed Hash of the previous data to continue hashing, or the default to start
+   * @return Hash value
+   */
+  static uint64_t hash(const void *data, size_t size, uint64_t seed = 0xcbf29ce484222325ULL);
+  /**
+   * @brief Make the key of the artifact for a model and compiler options
+   * @param model_hash Hash of the model
+   * @param options    Compiler options
+   * @return Key value
+   */
+  static uint64_t makeKey(uint64_t model_hash, const CompilerOptions &options);
+
+public:
+  CompiledArtifact(uint64_t key) : _key{key} {}
+
+public:
+  /**
+   * @brief Load an artifact file
+   * @param path File path
+   * @return @c true if loaded, @c false if the file does not exist, is broken or has a different
+   *         version or key. Nothing is changed when @c false is returned.
+   */
+  bool load(const std::string &path);
+  /**
+   * @brief Save to an artifact file
+   * @param path File path
+   * @note  Throws if the file cannot be written. The file is replaced at once, so that a reader
+   *        never sees a partially written file.
+   */
+  void save(const std::string &path) const;
+
+  uint64_t key() const { return _key; }
+  /**
+   * @brief Find the schedule of a subgraph
+   * @return The schedule, or nullptr if there is none
+   */
+  const Schedule *schedule(const ir::SubgraphIndex &index) const;
+  void schedule(const ir::SubgraphIndex &index, const Schedule &schedule)
+  {
+    _schedules[index] = schedule;
+  }
+
+private:
+  uint64_t _key;
+  std::unordered_map<ir::SubgraphIndex, Schedule> _schedules;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_COMPILED_ARTIFACT_H__
@@ -54,11 +54,17 @@ struct CompilerOptions
   int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
   int op_seq_max_node;        //< Number of nodes that can be
   std::string executor;       //< Executor name to use
+  std::unordered_map<std::string, int> parallel_threads; //< Threads per backend for Parallel
+  int work_stealing_threads; //< Workers of WorkStealing executor, 0 for the number of cores
+  int compile_threads; //< Threads to compile subgraphs concurrently, 0 for the number of cores
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
   bool he_scheduler;      //< HEScheduler if true, ManualScheduler otherwise
   bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
   bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
   bool fp16_enable;       //< Whether fp16 mode ON/OFF
+  bool artifact_cache;    //< Whether to save and reuse compiled artifact
+  std::string artifact_path; //< File of compiled artifact, which is not used if empty
+  uint64_t model_hash;       //< Hash of the model file to validate compiled artifact
 };
 
 CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs);
@@ -106,6 +112,11 @@ public:
 
 private:
   void checkProfilerConditions();
+  /**
+   * @brief   Get the number of threads to compile subgraphs
+   * @return  1 if any of backends cannot be compiled concurrently
+   */
+  uint32_t numCompileThreads() const;
   std::shared_ptr<ir::Graph> &primary_subgraph() { return _subgraphs->at(ir::SubgraphIndex{0}); }
 
 private:
@@ -25,6 +25,12 @@
 #include "exec/IExecutor.h"
 #include "IODescription.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
 #include <thread>
 
 namespace onert
@@ -45,6 +51,10 @@ public:
    * @param[in] executor  Model executor
    */
   Execution(const std::shared_ptr<ExecutorMap> &executors);
+  /**
+   * @brief Destroy the Execution object, after finishing executions started by startExecute()
+   */
+  ~Execution();
 
 public:
   /**
@@ -122,14 +132,15 @@ public:
 
   /**
    * @brief Start asynchronous execution
-   * @note  It returns after execution thread is started
+   * @note  It returns after queueing execution to the execution thread, which is kept for the
+   *        lifetime of this object so that thread-local contexts of kernels are reused
    *        It should be called after setting input and output buffer
    */
   void startExecute(void);
 
   /**
    * @brief Return when execution is finished
-   * @note  It waits until execution is finished
+   * @note  It waits until execution is finished, and throws the exception thrown by execution
    */
   void waitFinish(void);
 
@@ -147,12 +158,20 @@ private:
     return _executors->at(ir::SubgraphIndex{0});
   };
   std::unique_ptr<IExecutor> &primary_executor() { return _executors->at(ir::SubgraphIndex{0}); };
+  void runExecThread(void);
 
 private:
   const std::shared_ptr<ExecutorMap> _executors;
   IODescription _io_desc;
   std::unique_ptr<std::thread> _exec_thread;
-  bool finished{false};
+  std::mutex _exec_mutex;
+  std::condition_variable _exec_cv;
+  std::queue<std::function<void()>> _exec_jobs;
+  // Number of jobs queued or running
+  size_t _exec_pending{0};
+  bool _exec_terminate{false};
+  std::exception_ptr _exec_exception;
+  std::atomic<bool> finished{false};
 };
 
 } // namespace exec
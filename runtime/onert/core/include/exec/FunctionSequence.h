@@ -18,6 +18,7 @@
 #define __ONERT_EXEC_FUNCTION_SEQUENCE_H__
 
 #include <memory>
+#include <list>
 #include <vector>
 #include <functional>
 
@@ -71,27 +72,59 @@ protected:
 /**
  * @brief Function sequence used for backend that supports dynamic tensor
  *        Such backend cannot use class FunctionSequence but use this class
+ *
+ * Shapes inferred while running are memoized by the shapes of the tensors coming into the
+ * sequence. When those repeat, e.g. inputs bucketed into a few sizes, the recorded shapes are
+ * applied without running shape inference of each operation.
  */
 class FunctionSequenceForDynamicBackend : public FunctionSequence
 {
 public:
-  FunctionSequenceForDynamicBackend(
-      const ir::OpSequence &op_seq, const ir::Operations &operations,
-      std::unique_ptr<shape_inference::DynamicInferer> dyn_shape_inferer,
-      backend::IDynamicTensorManager *dyn_tensor_manager)
-      : _op_seq(op_seq), _operations_ctx(operations),
-        _dyn_shape_inferer(std::move(dyn_shape_inferer)), _dyn_tensor_manager(dyn_tensor_manager)
-  { /* empty */
-  }
+  FunctionSequenceForDynamicBackend(const ir::OpSequence &op_seq, const ir::Operands &operands,
+                                    const ir::Operations &operations,
+                                    backend::IDynamicTensorManager *dyn_tensor_manager,
+                                    const std::shared_ptr<backend::ITensorRegistry> &tensor_registry);
+  ~FunctionSequenceForDynamicBackend();
 
   void run() override;
 
+public:
+  /// @brief Maximum number of shape plans kept, least recently used ones are dropped
+  static constexpr size_t MAX_SHAPE_PLANS = 8;
+
+private:
+  class ShapeRecorder;
+
+  /// @brief Shapes applied to outputs by shape inference of an operation
+  using AppliedShapes = std::vector<std::pair<ir::OperandIndex, ir::Shape>>;
+
+  /**
+   * @brief Shapes of the tensors coming into the sequence, and the shapes applied by shape
+   *        inference of each operation of the sequence
+   */
+  struct ShapePlan
+  {
+    std::vector<ir::Shape> input_shapes;
+    std::vector<bool> input_dynamics;
+    std::vector<AppliedShapes> applied;
+  };
+
+  ShapePlan *findShapePlan(const ShapePlan &key);
+  void inferShape(const ir::Operation &op, AppliedShapes &applied);
+
 private:
   const ir::OpSequence &_op_seq;
   const ir::Operations &_operations_ctx;
+  backend::IDynamicTensorManager *_dyn_tensor_manager;
+  std::shared_ptr<backend::ITensorRegistry> _tensor_registry;
+  /// @brief dynamic tensor manager for shape inference, which records shapes it applies
+  std::unique_ptr<ShapeRecorder> _shape_recorder;
   /// @brief shape inferer at execution time
   std::unique_ptr<shape_inference::DynamicInferer> _dyn_shape_inferer;
-  backend::IDynamicTensorManager *_dyn_tensor_manager;
+  /// @brief non-constant operands used by the sequence but defined out of it
+  std::vector<ir::OperandIndex> _input_operands;
+  /// @brief shape plans, most recently used first
+  std::list<ShapePlan> _shape_plans;
 };
 
 } // namespace exec
@@ -49,7 +49,6 @@ private:
 public:
   virtual void run() override
   {
-    assert(_src_tensors.size() > 0);
     assert(_src_tensors.size() == _dst_tensors.size());
     auto src_it = _src_tensors.begin();
     auto dst_it = _dst_tensors.begin();
@@ -80,6 +79,7 @@ public:
             permute<uint8_t>(src_tensor, dst_tensor, rank);
             break;
           case ir::DataType::QUANT_INT8_SYMM:
+          case ir::DataType::QUANT_INT8_ASYMM:
             permute<int8_t>(src_tensor, dst_tensor, rank);
             break;
           default:
@@ -269,6 +269,7 @@ private:
       case ir::DataType::UINT8:
         return typeid(uint8_t);
       case ir::DataType::QUANT_INT8_SYMM:
+      case ir::DataType::QUANT_INT8_ASYMM:
         return typeid(int8_t);
       default:
         throw std::runtime_error("IPermuteFunction: Not supported data type");
@@ -59,6 +59,14 @@ public:
    */
   void execute(const exec::IODescription &desc) final;
 
+public:
+  /**
+   * @brief   Return whether interpreter has a kernel for the operation
+   * @param[in] opcode  Operation code to check
+   * @return  @c true if interpreter can run the operation, otherwise @c false
+   */
+  static bool isSupported(ir::OpCode opcode);
+
 private:
   const ir::Graph &_graph;
   ir::OperandIndexMap<std::shared_ptr<ITensor>> _tensor_map;
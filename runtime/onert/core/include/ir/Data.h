@@ -18,6 +18,9 @@
 #define __ONERT_IR_DATA_H__
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 
 namespace onert
 {
@@ -69,6 +72,39 @@ private:
   const size_t _size;
 };
 
+/**
+ * @brief Data which refers to a region of a file mapped with mmap
+ *
+ *        Pages are read only when they are accessed, and they are shared with other processes
+ *        mapping the same file. All the data of a file share one mapping, which is unmapped when
+ *        the last of them is destroyed.
+ */
+class MMapedData final : public Data
+{
+public:
+  /**
+   * @brief Construct a new MMapedData object
+   *
+   * @param mapping Base address of the mapped file, which owns the mapping
+   * @param offset  Offset of the data in the file
+   * @param size    Size of the data
+   */
+  MMapedData(const std::shared_ptr<const uint8_t> &mapping, size_t offset, size_t size)
+      : _mapping{mapping}, _offset{offset}, _size{size}
+  {
+    // DO NOTHING
+  }
+
+public:
+  size_t size(void) const override { return _size; }
+  const uint8_t *base(void) const override { return _mapping.get() + _offset; }
+
+private:
+  std::shared_ptr<const uint8_t> _mapping;
+  const size_t _offset;
+  const size_t _size;
+};
+
 } // namespace ir
 } // namespace onert
 
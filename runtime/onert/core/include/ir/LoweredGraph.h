@@ -21,6 +21,7 @@
 #include "ir/LowerInfoMap.h"
 #include "ir/OpSequences.h"
 #include "compiler/BackendResolver.h"
+#include "compiler/CompiledArtifact.h"
 #include "compiler/Compiler.h"
 
 namespace onert
@@ -36,7 +37,15 @@ namespace ir
 class LoweredGraph
 {
 public:
-  LoweredGraph(const Graph &graph, const compiler::CompilerOptions &options);
+  /**
+   * @brief Lower a graph
+   * @param graph    Graph to lower
+   * @param options  Compiler options
+   * @param schedule Backend assignment of a previous compilation to use instead of scheduling,
+   *                 or nullptr to schedule
+   */
+  LoweredGraph(const Graph &graph, const compiler::CompilerOptions &options,
+               const compiler::CompiledArtifact::Schedule *schedule = nullptr);
 
   Graph &graph() { return _graph; }
   const Graph &graph() const { return _graph; }
@@ -54,6 +63,10 @@ public:
   const backend::BackendContexts &backend_contexts() { return _backend_contexts; }
   const backend::BackendContexts &backend_contexts() const { return _backend_contexts; }
   std::shared_ptr<ir::OperationIndexMap<int64_t>> indexed_ranks() { return _indexed_ranks; }
+  /**
+   * @brief Get the backend assignment decided before any operation is fused
+   */
+  const compiler::CompiledArtifact::Schedule &schedule() const { return _schedule; }
 
 private:
   void makeOpSequences(OperandIndexMap<std::unique_ptr<operand::LowerInfo>> &operands_lower_info,
@@ -66,12 +79,14 @@ private:
                  Layout layout);
   OpSequenceIndex appendFreshSingleOpSequence(const OperationIndex &node_index,
                                               const Operation &node);
+  bool applySchedule(const compiler::CompiledArtifact::Schedule &schedule);
 
 private:
   Graph _graph;
   backend::BackendContexts _backend_contexts;
   std::unique_ptr<compiler::BackendResolver> _backend_resolver; // TODO Remove this
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
+  compiler::CompiledArtifact::Schedule _schedule;
   LowerInfoMap _lower_info_map;
   // Pass(for Perm) can accept only graph so that Graph has OpSequences as a member
   OpSequences _op_seqs;
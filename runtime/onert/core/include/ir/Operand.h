@@ -65,6 +65,10 @@ public:
     _const = true;
   }
   const Data *data(void) const { return _data.get(); }
+  /**
+   * @brief Get shared ownership of data so that it can outlive the operand's reference
+   */
+  std::shared_ptr<Data> shareData(void) const { return _data; }
 
   void releaseData(void) { _data.reset(); }
 
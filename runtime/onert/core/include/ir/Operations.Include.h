@@ -101,3 +101,4 @@
 #include "ir/operation/ZerosLike.h"
 #include "ir/operation/Tile.h"
 #include "ir/operation/Range.h"
+#include "ir/operation/SeparableConv2D.h"
@@ -18,6 +18,7 @@
 #define __ONERT_IR_TYPEINFO_H__
 
 #include <cstdint>
+#include <vector>
 
 #include "ir/DataType.h"
 
@@ -32,14 +33,39 @@ public:
   TypeInfo() = delete;
 
   explicit TypeInfo(DataType type, float scale = 0, int32_t offset = 0)
-      : _type(type), _scale(scale), _offset(offset)
+      : _type(type), _scale(scale), _offset(offset), _quantized_dimension(0)
+  {
+  }
+
+  /**
+   * @brief Construct TypeInfo with per-channel(axis) quantization parameters
+   *
+   * @param type                Data type
+   * @param scales              Scale of each channel
+   * @param offsets             Zero point of each channel
+   * @param quantized_dimension Axis that channels lie on
+   */
+  TypeInfo(DataType type, const std::vector<float> &scales, const std::vector<int32_t> &offsets,
+           int32_t quantized_dimension)
+      : _type(type), _scale(scales.at(0)), _offset(offsets.at(0)), _scales(scales),
+        _offsets(offsets), _quantized_dimension(quantized_dimension)
   {
   }
 
 public:
   DataType type() const { return _type; }
+  /**
+   * @brief Per-tensor scale. For a per-channel quantized tensor it is the scale of channel 0
+   */
   float scale() const { return _scale; }
+  /**
+   * @brief Per-tensor zero point. For a per-channel quantized tensor it is that of channel 0
+   */
   int32_t offset() const { return _offset; }
+  bool isPerChannel() const { return !_scales.empty(); }
+  const std::vector<float> &scales() const { return _scales; }
+  const std::vector<int32_t> &offsets() const { return _offsets; }
+  int32_t quantized_dimension() const { return _quantized_dimension; }
 
 public:
   void type(const DataType type) { _type = type; }
@@ -48,6 +74,10 @@ private:
   DataType _type;
   float _scale;
   int32_t _offset;
+  // Per-channel quantization parameters, empty if the tensor is quantized per-tensor
+  std::vector<float> _scales;
+  std::vector<int32_t> _offsets;
+  int32_t _quantized_dimension;
 };
 
 bool operator==(const TypeInfo &lhs, const TypeInfo &rhs);
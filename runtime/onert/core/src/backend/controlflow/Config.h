@@ -42,6 +42,8 @@ public:
     return false;
   }
   bool supportFP16() override { return false; }
+  bool supportConcurrentCompile() override { return true; }
+  bool supportConcurrentExecution() override { return true; }
 
   std::unique_ptr<util::ITimer> timer() override { return std::make_unique<util::CPUTimer>(); }
 };
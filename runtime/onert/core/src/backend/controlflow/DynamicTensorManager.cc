@@ -33,6 +33,13 @@ DynamicTensorManager::DynamicTensorManager(const std::shared_ptr<TensorRegistry>
   // DO NOTHING
 }
 
+void DynamicTensorManager::applyShape(const ir::OperandIndex &ind, const ir::Shape &new_shape)
+{
+  // allocate() compares the size of the current shape, so it must come first
+  allocate(ind, new_shape);
+  changeShape(ind, new_shape);
+}
+
 void DynamicTensorManager::allocate(const ir::OperandIndex &ind, const ir::Shape &new_shape)
 {
   auto tensor = (*_tensors)[ind];
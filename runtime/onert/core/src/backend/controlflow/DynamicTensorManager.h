@@ -44,10 +44,11 @@ public:
 
   virtual ~DynamicTensorManager() = default;
 
-  void applyShape(const ir::OperandIndex & /*ind*/, const ir::Shape & /*new_shape*/) override
-  {
-    // TODO Write code later
-  }
+  /**
+   * @brief Set new shape to the tensor, and allocate memory for it if it is not allocated or its
+   *        size changes
+   */
+  void applyShape(const ir::OperandIndex &ind, const ir::Shape &new_shape) override;
 
   /**
    * @brief Allocate memory for dynamic tensor.
@@ -20,6 +20,8 @@
 #include "exec/ExecutorBase.h"
 #include "PermuteLayer.h"
 
+#include <algorithm>
+
 namespace onert
 {
 namespace backend
@@ -29,6 +31,18 @@ namespace controlflow
 namespace kernel
 {
 
+namespace
+{
+
+bool isSameStaticTensor(const backend::ITensor &lhs, const backend::ITensor &rhs)
+{
+  return !lhs.is_dynamic() && !rhs.is_dynamic() && !lhs.has_padding() && !rhs.has_padding() &&
+         lhs.data_type() == rhs.data_type() && lhs.layout() == rhs.layout() &&
+         lhs.total_size() == rhs.total_size();
+}
+
+} // namespace
+
 WhileLayer::WhileLayer(std::vector<std::shared_ptr<backend::ITensor>> input_tensors,
                        std::vector<std::shared_ptr<backend::ITensor>> output_tensors,
                        const ir::SubgraphIndex &cond_subg_index,
@@ -40,6 +54,76 @@ WhileLayer::WhileLayer(std::vector<std::shared_ptr<backend::ITensor>> input_tens
   // At this point, executor_map may not have executors of cond subg and body subg
 }
 
+std::vector<bool> WhileLayer::bindLoopBuffers(
+    const std::vector<std::shared_ptr<backend::ITensor>> &cond_input_tensors,
+    const std::vector<std::shared_ptr<backend::ITensor>> &body_input_tensors,
+    const std::vector<std::shared_ptr<backend::ITensor>> &body_output_tensors)
+{
+  const auto num_vars = cond_input_tensors.size();
+  assert(body_input_tensors.size() == num_vars);
+  assert(body_output_tensors.size() == num_vars);
+
+  std::vector<bool> is_bound(num_vars, false);
+  _loop_buffers.resize(num_vars);
+  for (size_t i = 0; i < num_vars; ++i)
+  {
+    const auto &op_input = _input_tensors.at(i);
+    const auto &cond_input = cond_input_tensors.at(i);
+    const auto &body_input = body_input_tensors.at(i);
+    const auto &body_output = body_output_tensors.at(i);
+    if (op_input == nullptr || cond_input == nullptr || body_input == nullptr ||
+        body_output == nullptr)
+      continue;
+
+    // Tensors of different backends or layouts still need to be permuted
+    if (!isSameStaticTensor(*cond_input, *body_input) ||
+        !isSameStaticTensor(*body_input, *body_output))
+      continue;
+
+    // Subgraph tensors get new shapes and their own memory if the variable coming into the loop
+    // differs from them
+    if (op_input->is_dynamic() || op_input->total_size() != cond_input->total_size())
+      continue;
+
+    // A tensor that carries two variables cannot be bound to both of their buffers
+    const bool pass_through = (body_input == body_output);
+    bool is_shared = false;
+    for (size_t j = 0; j < num_vars; ++j)
+    {
+      if (j == i)
+        continue;
+      is_shared |= (body_output_tensors.at(j) == body_output);
+      is_shared |= (body_input_tensors.at(j) == body_output);
+      is_shared |= (body_output_tensors.at(j) == body_input);
+    }
+    if (is_shared)
+      continue;
+
+    auto &buf = _loop_buffers.at(i);
+    const auto size = body_input->total_size();
+    if (buf.size != size)
+    {
+      buf.front = std::make_unique<uint8_t[]>(size);
+      buf.back = std::make_unique<uint8_t[]>(size);
+      buf.size = size;
+    }
+    buf.pass_through = pass_through;
+
+    // A tensor that refuses the buffer keeps its own memory, so a partially bound variable is
+    // still correct with copies between distinct buffers
+    if (!pass_through && !body_output->setExternalBuffer(buf.back.get()))
+      continue;
+    if (!body_input->setExternalBuffer(buf.front.get()))
+      continue;
+    if (!cond_input->setExternalBuffer(buf.front.get()))
+      continue;
+
+    is_bound[i] = true;
+  }
+
+  return is_bound;
+}
+
 void WhileLayer::run()
 {
   // TODO Support dynamic tensor
@@ -51,6 +135,10 @@ void WhileLayer::run()
   // // Copy body subg outputs -> cond subg inputs
   // // Run cond subg
   // Copy cond subg inputs -> _dst_tensors
+  //
+  // Copies inside the loop are skipped for variables whose tensors can use the loop buffers.
+  // Inputs of cond and body subg share a buffer, and the buffer is swapped with the one of body
+  // subg output after each iteration.
   auto cond_exec = dynamic_cast<exec::ExecutorBase *>(_executor_map->at(_cond_subg_index).get());
   auto body_exec = dynamic_cast<exec::ExecutorBase *>(_executor_map->at(_body_subg_index).get());
   if ((cond_exec == nullptr) || (body_exec == nullptr))
@@ -62,12 +150,29 @@ void WhileLayer::run()
   const auto &body_input_tensors = body_exec->getInputTensors();
   const auto &body_output_tensors = body_exec->getOutputTensors();
 
+  const auto is_bound =
+      bindLoopBuffers(cond_input_tensors, body_input_tensors, body_output_tensors);
+
+  // nullptr makes PermuteLayer skip copying of the variable
+  auto cond_inputs_to_copy = cond_input_tensors;
+  auto body_inputs_to_copy = body_input_tensors;
+  auto body_outputs_to_copy = body_output_tensors;
+  for (size_t i = 0; i < is_bound.size(); ++i)
+  {
+    if (is_bound[i])
+    {
+      cond_inputs_to_copy[i] = nullptr;
+      body_inputs_to_copy[i] = nullptr;
+      body_outputs_to_copy[i] = nullptr;
+    }
+  }
+
   const auto permute_op_input_to_cond_input =
       std::make_shared<PermuteLayer>(_input_tensors, cond_input_tensors);
   const auto permute_cond_input_to_body_input =
-      std::make_shared<PermuteLayer>(cond_input_tensors, body_input_tensors);
+      std::make_shared<PermuteLayer>(cond_inputs_to_copy, body_inputs_to_copy);
   const auto permute_body_output_to_cond_input =
-      std::make_shared<PermuteLayer>(body_output_tensors, cond_input_tensors);
+      std::make_shared<PermuteLayer>(body_outputs_to_copy, cond_inputs_to_copy);
   const auto permute_cond_input_to_op_output =
       std::make_shared<PermuteLayer>(cond_input_tensors, _output_tensors);
 
@@ -77,6 +182,24 @@ void WhileLayer::run()
   permute_body_output_to_cond_input->prepare();
   permute_cond_input_to_op_output->prepare();
 
+  const auto swapLoopBuffers = [&]() {
+    for (size_t i = 0; i < is_bound.size(); ++i)
+    {
+      auto &buf = _loop_buffers.at(i);
+      if (!is_bound[i] || buf.pass_through)
+        continue;
+
+      std::swap(buf.front, buf.back);
+      // These cannot fail as the tensors have accepted the buffers in bindLoopBuffers()
+      if (!cond_input_tensors.at(i)->setExternalBuffer(buf.front.get()) ||
+          !body_input_tensors.at(i)->setExternalBuffer(buf.front.get()) ||
+          !body_output_tensors.at(i)->setExternalBuffer(buf.back.get()))
+      {
+        throw std::runtime_error{"While: Failed to swap loop buffers"};
+      }
+    }
+  };
+
   cond_exec->execute(_input_tensors, permute_op_input_to_cond_input);
 
   assert(cond_exec->getOutputTensors().size() == 1);
@@ -91,6 +214,7 @@ void WhileLayer::run()
   while (getResultCond(cond_output_tensor.get()))
   {
     body_exec->execute(cond_input_tensors, permute_cond_input_to_body_input);
+    swapLoopBuffers();
     cond_exec->execute(body_output_tensors, permute_body_output_to_cond_input);
   }
   permute_cond_input_to_op_output->run();
@@ -21,6 +21,9 @@
 #include <exec/IExecutor.h>
 #include <exec/IFunction.h>
 
+#include <memory>
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -51,12 +54,35 @@ public:
     run();
   }
 
+private:
+  /**
+   * @brief Double buffer of a loop-carried variable
+   *
+   * Inputs of cond and body subgraphs read @c front and outputs of body subgraph write @c back.
+   * They are swapped after each iteration instead of copying the body outputs to the cond inputs.
+   */
+  struct LoopBuffer
+  {
+    std::unique_ptr<uint8_t[]> front;
+    std::unique_ptr<uint8_t[]> back;
+    size_t size = 0;
+    // True if the body output is the body input itself, which needs no swap
+    bool pass_through = false;
+  };
+
+  std::vector<bool>
+  bindLoopBuffers(const std::vector<std::shared_ptr<backend::ITensor>> &cond_input_tensors,
+                  const std::vector<std::shared_ptr<backend::ITensor>> &body_input_tensors,
+                  const std::vector<std::shared_ptr<backend::ITensor>> &body_output_tensors);
+
 private:
   const ir::SubgraphIndex _cond_subg_index;
   const ir::SubgraphIndex _body_subg_index;
   const std::vector<std::shared_ptr<backend::ITensor>> _input_tensors;
   const std::vector<std::shared_ptr<backend::ITensor>> _output_tensors;
   const std::shared_ptr<exec::ExecutorMap> &_executor_map;
+  // NOTE Tensors of cond and body subgraphs keep pointing to these buffers after run()
+  std::vector<LoopBuffer> _loop_buffers;
 };
 
 } // namespace kernel
@@ -84,6 +84,13 @@ public:
   int32_t data_offset() const { return _info.typeInfo().offset(); }
   bool has_padding() const override { return false; }
   void access(const std::function<void(ITensor &tensor)> &fn) final;
+  bool setExternalBuffer(uint8_t *buffer) override
+  {
+    if (_allocator != nullptr || is_dynamic())
+      return false;
+    _buffer = buffer;
+    return true;
+  }
   bool is_dynamic() const override { return _info.isDynamic(); }
   void set_dynamic() override { _info.setDynamic(); }
 
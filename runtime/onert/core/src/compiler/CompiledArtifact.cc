@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/CompiledArtifact.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+#include <unistd.h>
+
+namespace onert
+{
+namespace compiler
+{
+
+namespace
+{
+
+const char kMagic[8] = {'O', 'N', 'E', 'R', 'T', 'A', 'R', 'T'};
+
+class Writer
+{
+public:
+  Writer(std::ofstream &ofs) : _ofs(ofs) {}
+
+  template <typename T> void write(const T &value)
+  {
+    _ofs.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+  void write(const std::string &str)
+  {
+    write(static_cast<uint32_t>(str.size()));
+    _ofs.write(str.data(), str.size());
+  }
+
+private:
+  std::ofstream &_ofs;
+};
+
+class Reader
+{
+public:
+  Reader(std::ifstream &ifs) : _ifs(ifs) {}
+
+  template <typename T> T read()
+  {
+    T value;
+    if (!_ifs.read(reinterpret_cast<char *>(&value), sizeof(T)))
+      throw std::runtime_error{"Unexpected end of compiled artifact"};
+    return value;
+  }
+  std::string readString()
+  {
+    const auto size = read<uint32_t>();
+    std::string str(size, '\0');
+    if (!_ifs.read(&str[0], size))
+      throw std::runtime_error{"Unexpected end of compiled artifact"};
+    return str;
+  }
+
+private:
+  std::ifstream &_ifs;
+};
+
+} // namespace
+
+constexpr uint32_t CompiledArtifact::VERSION;
+
+uint64_t CompiledArtifact::hash(const void *data, size_t size, uint64_t seed)
+{
+  constexpr uint64_t prime = 0x100000001b3ULL;
+  auto bytes = reinterpret_cast<const uint8_t *>(data);
+  uint64_t value = seed;
+  for (size_t i = 0; i < size; ++i)
+  {
+    value ^= bytes[i];
+    value *= prime;
+  }
+  return value;
+}
+
+uint64_t CompiledArtifact::makeKey(uint64_t model_hash, const CompilerOptions &options)
+{
+  auto hashValue = [](uint64_t seed, uint64_t value) { return hash(&value, sizeof(value), seed); };
+  auto hashString = [&](uint64_t seed, const std::string &str) {
+    return hash(str.data(), str.size(), hashValue(seed, str.size()));
+  };
+
+  uint64_t key = hashValue(model_hash, VERSION);
+  for (const auto &backend : options.backend_list)
+  {
+    key = hashString(key, backend);
+  }
+  key = hashString(key, options.executor);
+  key = hashValue(key, options.he_scheduler);
+
+  // Options of ManualScheduler are sorted as they are not ordered
+  const auto &ms_options = options.manual_scheduler_options;
+  key = hashString(key, ms_options.backend_for_all);
+  std::map<uint32_t, std::string> opcode_to_backend;
+  for (const auto &pair : ms_options.opcode_to_backend)
+  {
+    opcode_to_backend.emplace(static_cast<uint32_t>(pair.first), pair.second);
+  }
+  for (const auto &pair : opcode_to_backend)
+  {
+    key = hashString(hashValue(key, pair.first), pair.second);
+  }
+  std::map<uint32_t, std::string> index_to_backend;
+  for (const auto &pair : ms_options.index_to_backend)
+  {
+    index_to_backend.emplace(pair.first.value(), pair.second);
+  }
+  for (const auto &pair : index_to_backend)
+  {
+    key = hashString(hashValue(key, pair.first), pair.second);
+  }
+
+  return key;
+}
+
+bool CompiledArtifact::load(const std::string &path)
+{
+  std::ifstream ifs{path, std::ios::binary};
+  if (!ifs)
+  {
+    VERBOSE(CompiledArtifact) << "No compiled artifact at " << path << std::endl;
+    return false;
+  }
+
+  try
+  {
+    Reader reader{ifs};
+    char magic[sizeof(kMagic)];
+    for (auto &c : magic)
+      c = reader.read<char>();
+    if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0)
+      throw std::runtime_error{"Not a compiled artifact"};
+
+    const auto version = reader.read<uint32_t>();
+    const auto key = reader.read<uint64_t>();
+    if (version != VERSION || key != _key)
+    {
+      VERBOSE(CompiledArtifact) << "Compiled artifact at " << path << " is outdated" << std::endl;
+      return false;
+    }
+
+    std::unordered_map<ir::SubgraphIndex, Schedule> schedules;
+    const auto num_subgraphs = reader.read<uint32_t>();
+    for (uint32_t i = 0; i < num_subgraphs; ++i)
+    {
+      auto &schedule = schedules[ir::SubgraphIndex{reader.read<uint32_t>()}];
+
+      const auto num_operations = reader.read<uint32_t>();
+      for (uint32_t n = 0; n < num_operations; ++n)
+      {
+        const auto op_index = ir::OperationIndex{reader.read<uint32_t>()};
+        schedule.opcodes[op_index] = static_cast<ir::OpCode>(reader.read<uint32_t>());
+        schedule.backends[op_index] = reader.readString();
+      }
+
+      const auto has_ranks = reader.read<uint8_t>();
+      if (has_ranks)
+      {
+        schedule.indexed_ranks = std::make_shared<ir::OperationIndexMap<int64_t>>();
+        const auto num_ranks = reader.read<uint32_t>();
+        for (uint32_t n = 0; n < num_ranks; ++n)
+        {
+          const auto op_index = ir::OperationIndex{reader.read<uint32_t>()};
+          (*schedule.indexed_ranks)[op_index] = reader.read<int64_t>();
+        }
+      }
+    }
+
+    _schedules = std::move(schedules);
+  }
+  catch (const std::exception &e)
+  {
+    VERBOSE(CompiledArtifact) << "Compiled artifact at " << path << " is broken: " << e.what()
+                              << std::endl;
+    return false;
+  }
+
+  VERBOSE(CompiledArtifact) << "Loaded compiled artifact from " << path << std::endl;
+  return true;
+}
+
+void CompiledArtifact::save(const std::string &path) const
+{
+  // Write to a temporary file and rename it to the path, so that another process loading the
+  // artifact meanwhile reads either the previous file or the new one
+  const auto temp_path = path + ".tmp" + std::to_string(getpid());
+  std::ofstream ofs{temp_path, std::ios::binary | std::ios::trunc};
+  if (!ofs)
+    throw std::runtime_error{"Cannot open " + temp_path + " to save compiled artifact"};
+
+  Writer writer{ofs};
+  for (const auto c : kMagic)
+    writer.write(c);
+  writer.write(VERSION);
+  writer.write(_key);
+
+  // Entries are sorted by index so that the same result makes the same file
+  std::vector<ir::SubgraphIndex> subg_indices;
+  for (const auto &pair : _schedules)
+    subg_indices.push_back(pair.first);
+  std::sort(subg_indices.begin(), subg_indices.end(),
+            [](const ir::SubgraphIndex &lhs, const ir::SubgraphIndex &rhs) {
+              return lhs.value() < rhs.value();
+            });
+
+  writer.write(static_cast<uint32_t>(subg_indices.size()));
+  for (const auto &subg_index : subg_indices)
+  {
+    const auto &schedule = _schedules.at(subg_index);
+    writer.write(subg_index.value());
+
+    const std::map<uint32_t, std::string> backends = [&]() {
+      std::map<uint32_t, std::string> ret;
+      for (const auto &pair : schedule.backends)
+        ret.emplace(pair.first.value(), pair.second);
+      return ret;
+    }();
+    writer.write(static_cast<uint32_t>(backends.size()));
+    for (const auto &pair : backends)
+    {
+      writer.write(pair.first);
+      writer.write(static_cast<uint32_t>(schedule.opcodes.at(ir::OperationIndex{pair.first})));
+      writer.write(pair.second);
+    }
+
+    writer.write(static_cast<uint8_t>(schedule.indexed_ranks != nullptr));
+    if (schedule.indexed_ranks)
+    {
+      const std::map<uint32_t, int64_t> ranks = [&]() {
+        std::map<uint32_t, int64_t> ret;
+        for (const auto &pair : *schedule.indexed_ranks)
+          ret.emplace(pair.first.value(), pair.second);
+        return ret;
+      }();
+      writer.write(static_cast<uint32_t>(ranks.size()));
+      for (const auto &pair : ranks)
+      {
+        writer.write(pair.first);
+        writer.write(pair.second);
+      }
+    }
+  }
+
+  ofs.close();
+  if (!ofs || std::rename(temp_path.c_str(), path.c_str()) != 0)
+  {
+    std::remove(temp_path.c_str());
+    throw std::runtime_error{"Failed to write compiled artifact to " + path};
+  }
+  VERBOSE(CompiledArtifact) << "Saved compiled artifact to " << path << std::endl;
+}
+
+const CompiledArtifact::Schedule *CompiledArtifact::schedule(const ir::SubgraphIndex &index) const
+{
+  auto it = _schedules.find(index);
+  if (it == _schedules.end())
+    return nullptr;
+  return &it->second;
+}
+
+} // namespace compiler
+} // namespace onert
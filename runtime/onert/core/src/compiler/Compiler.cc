@@ -23,6 +23,7 @@
 
 #include <backend/controlflow/Config.h>
 #include "compiler/BackendManager.h"
+#include "compiler/CompiledArtifact.h"
 #include "compiler/IScheduler.h"
 #include "compiler/ManualScheduler.h"
 #include "compiler/HEScheduler.h"
@@ -30,18 +31,124 @@
 #include "ir/operation/LowerInfo.h"
 #include "dumper/dot/DotDumper.h"
 #include "compiler/Linear.h"
+#include "exec/ThreadPool.h"
 #include "interp/InterpExecutor.h"
 #include "util/ConfigSource.h"
 #include "util/logging.h"
 #include "ir/OperationDumper.h"
 #include "misc/string_helpers.h"
 
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <thread>
+
 namespace onert
 {
 
 namespace compiler
 {
 
+namespace
+{
+
+/**
+ * @brief Function to run a compilation job on exec::ThreadPool
+ * @note  An exception thrown by the job is kept to be rethrown by the compiling thread
+ */
+class CompileJob final : public exec::IFunction
+{
+public:
+  CompileJob(const std::function<void()> &fn, std::exception_ptr &error) : _fn{fn}, _error(error)
+  {
+    // DO NOTHING
+  }
+
+  void run() override
+  {
+    try
+    {
+      _fn();
+    }
+    catch (...)
+    {
+      _error = std::current_exception();
+    }
+  }
+
+  void runSync() override { run(); }
+
+private:
+  std::function<void()> _fn;
+  std::exception_ptr &_error;
+};
+
+/**
+ * @brief Call the function for each subgraph, concurrently if more than one thread is given
+ * @note  The function must not share writable data between subgraphs. If some of the calls
+ *        throw, the exception of the first subgraph in the given order is rethrown.
+ */
+void forEachSubgraph(const std::vector<ir::SubgraphIndex> &indices, uint32_t num_threads,
+                     const std::function<void(size_t, const ir::SubgraphIndex &)> &fn)
+{
+  if (num_threads <= 1 || indices.size() <= 1)
+  {
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+      fn(i, indices[i]);
+    }
+    return;
+  }
+
+  std::vector<std::exception_ptr> errors(indices.size());
+  {
+    exec::ThreadPool pool{static_cast<uint32_t>(std::min<size_t>(num_threads, indices.size()))};
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+      pool.enqueue(std::make_unique<CompileJob>([&, i]() { fn(i, indices[i]); }, errors[i]));
+    }
+    pool.finish();
+  }
+
+  for (const auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
+}
+
+/**
+ * @brief Parse an entry of PARALLEL_THREADS, which is "<backend>=<number of threads>"
+ * @return The backend and the number of threads
+ * @throw  std::runtime_error if the entry is malformed or the number is not positive
+ */
+std::pair<std::string, int> parseParallelThreads(const std::string &key_val_str)
+{
+  auto invalid = [&](const std::string &reason) {
+    return std::runtime_error("PARALLEL_THREADS: invalid entry '" + key_val_str + "', " + reason);
+  };
+
+  const auto key_val = nnfw::misc::split(key_val_str, '=');
+  if (key_val.size() != 2 || key_val.at(0).empty())
+    throw invalid("expected <backend>=<number of threads>");
+
+  const auto &num_str = key_val.at(1);
+  auto is_digit = [](unsigned char c) { return std::isdigit(c) != 0; };
+  const bool is_number =
+      !num_str.empty() && std::all_of(num_str.begin(), num_str.end(), is_digit);
+  // Numbers of more than 9 digits may not fit in int
+  if (!is_number || num_str.size() > 9)
+    throw invalid("number of threads must be a positive integer");
+
+  const auto num_threads = std::stoi(num_str);
+  if (num_threads < 1)
+    throw invalid("number of threads must be positive");
+
+  return {key_val.at(0), num_threads};
+}
+
+} // namespace
+
 std::set<ir::OpCode> getControlFlowOp(const ir::Graph &graph)
 {
   std::set<ir::OpCode> cf_op_codes;
@@ -67,10 +174,36 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   options.graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   options.op_seq_max_node = util::getConfigInt(util::config::OP_SEQ_MAX_NODE);
   options.executor = util::getConfigString(util::config::EXECUTOR);
+  {
+    // Backend to number of threads for Parallel executor (e.g. "cpu=2;acl_cl=1")
+    auto threads_str = util::getConfigString(util::config::PARALLEL_THREADS);
+    for (const auto &key_val_str : nnfw::misc::split(threads_str, ';'))
+    {
+      if (key_val_str.empty())
+      {
+        continue;
+      }
+
+      const auto backend_threads = parseParallelThreads(key_val_str);
+      options.parallel_threads[backend_threads.first] = backend_threads.second;
+    }
+  }
+  options.work_stealing_threads = util::getConfigInt(util::config::WORK_STEALING_THREADS);
+  if (options.work_stealing_threads < 0)
+  {
+    throw std::runtime_error("WORK_STEALING_THREADS: number of threads must not be negative");
+  }
+  options.compile_threads = util::getConfigInt(util::config::COMPILE_THREADS);
+  if (options.compile_threads < 0)
+  {
+    throw std::runtime_error("COMPILE_THREADS: number of threads must not be negative");
+  }
   options.he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
+  options.artifact_cache = util::getConfigBool(util::config::ARTIFACT_CACHE);
+  options.model_hash = 0;
 
   {
     // Backend for all
@@ -184,11 +317,14 @@ void Compiler::compile(void)
     VERBOSE(Compiler) << "graph_dump_level         : " << _options.graph_dump_level << std::endl;
     VERBOSE(Compiler) << "op_seq_max_node          : " << _options.op_seq_max_node << std::endl;
     VERBOSE(Compiler) << "executor                 : " << _options.executor << std::endl;
+    VERBOSE(Compiler) << "compile_threads          : " << _options.compile_threads << std::endl;
     VERBOSE(Compiler) << "manual_scheduler_options : (Too many things to print)" << std::endl;
     VERBOSE(Compiler) << "he_scheduler             : " << _options.he_scheduler << std::endl;
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
     VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl;
+    VERBOSE(Compiler) << "artifact_cache           : " << _options.artifact_cache << std::endl;
+    VERBOSE(Compiler) << "artifact_path            : " << _options.artifact_path << std::endl;
     VERBOSE(Compiler) << std::noboolalpha;
   }
 
@@ -201,6 +337,16 @@ void Compiler::compile(void)
   //       execution between interpreter and compiled executor (including control flow)
   if (!checkCompilable())
   {
+    // Fail here rather than at execution if the interpreter cannot run the model either
+    _subgraphs->iterate([&](const ir::SubgraphIndex &, ir::Graph &subg) {
+      subg.operations().iterate([&](const ir::OperationIndex &, const ir::Operation &op) {
+        if (!interp::InterpExecutor::isSupported(op.opcode()))
+          throw std::runtime_error{"Compiler: " + op.name() +
+                                   " is not supported for models that cannot be compiled, "
+                                   "e.g. with non-constant parameters"};
+      });
+    });
+
     _executors = std::make_shared<exec::ExecutorMap>();
     _subgraphs->iterate([&](const ir::SubgraphIndex &index, ir::Graph &subg) {
       _executors->insert(std::make_pair(index, std::make_unique<interp::InterpExecutor>(subg)));
@@ -218,9 +364,39 @@ void Compiler::compile(void)
    ***************************************************/
   auto dump_level = static_cast<dumper::dot::DotDumper::Level>(_options.graph_dump_level);
 
+  // Backends are loaded here as BackendManager must not be modified by concurrent lowering
+  auto &backend_manager = BackendManager::get();
+  for (const auto &backend_str : _options.backend_list)
+  {
+    backend_manager.loadBackend(backend_str);
+  }
+  const auto num_threads = numCompileThreads();
+
+  // Subgraphs are compiled in the order of their indices so that the result does not depend on the
+  // number of threads
+  std::vector<ir::SubgraphIndex> subg_indices;
+  _subgraphs->iterate(
+      [&](const ir::SubgraphIndex &index, const ir::Graph &) { subg_indices.push_back(index); });
+  std::sort(subg_indices.begin(), subg_indices.end(),
+            [](const ir::SubgraphIndex &lhs, const ir::SubgraphIndex &rhs) {
+              return lhs.value() < rhs.value();
+            });
+
+  // Compiled artifact of the previous compilation replaces scheduling. Profiling mode does not
+  // use it as it needs to run HEScheduler.
+  std::unique_ptr<CompiledArtifact> artifact;
+  bool artifact_loaded = false;
+  if (_options.artifact_cache && !_options.artifact_path.empty() && !_options.he_profiling_mode)
+  {
+    artifact = std::make_unique<CompiledArtifact>(
+        CompiledArtifact::makeKey(_options.model_hash, _options));
+    artifact_loaded = artifact->load(_options.artifact_path);
+  }
+
   // Lower: Assign backend
-  std::unordered_map<ir::SubgraphIndex, std::unique_ptr<ir::LoweredGraph>> lowered_subgs;
-  _subgraphs->iterate([&](const ir::SubgraphIndex &index, ir::Graph &subg) {
+  std::vector<std::unique_ptr<ir::LoweredGraph>> lowered_subgs(subg_indices.size());
+  forEachSubgraph(subg_indices, num_threads, [&](size_t n, const ir::SubgraphIndex &index) {
+    auto &subg = *_subgraphs->at(index);
     onert::dumper::dot::DotDumper dot_dumper(subg, dump_level);
     dot_dumper.dump(nnfw::misc::str("before_lower_subg-", index.value()));
 
@@ -228,11 +404,12 @@ void Compiler::compile(void)
     setInputToDynamicTensor(subg);
 
     // Lower: Assign backend
-    lowered_subgs[index] = std::make_unique<ir::LoweredGraph>(subg, _options);
+    const auto schedule = artifact_loaded ? artifact->schedule(index) : nullptr;
+    lowered_subgs[n] = std::make_unique<ir::LoweredGraph>(subg, _options, schedule);
 
     // Check backend(s) for subgraph support FP16
     bool backends_support_fp16 = true;
-    auto &contexts = (*lowered_subgs[index]).backend_contexts();
+    auto &contexts = (*lowered_subgs[n]).backend_contexts();
     for (auto it = contexts.begin(); it != contexts.end(); it++)
     {
       backends_support_fp16 &= it->first->config()->supportFP16();
@@ -241,7 +418,7 @@ void Compiler::compile(void)
     if (_options.fp16_enable && backends_support_fp16)
     {
       // NOTE: the only acl_cl backend enables fp16 mode
-      Fp32ToFp16Converter(*lowered_subgs[index]).run();
+      Fp32ToFp16Converter(*lowered_subgs[n]).run();
     }
 
     subg.setSubgraphs(nullptr);
@@ -254,18 +431,32 @@ void Compiler::compile(void)
    *************************************************************/
 
   // operation validation
-  for (auto &pair : lowered_subgs)
+  for (auto &lowered_subg : lowered_subgs)
   {
-    auto &lowered_subg = pair.second;
     compiler::OperationValidator{lowered_subg->graph()}();
   }
 
-  _executors = std::make_shared<exec::ExecutorMap>();
-  for (auto &pair : lowered_subgs)
+  // The artifact is saved if it is new or some of subgraphs could not use it
+  bool save_artifact = false;
+  if (artifact)
+  {
+    for (size_t n = 0; n < subg_indices.size(); ++n)
+    {
+      const auto &schedule = lowered_subgs[n]->schedule();
+      const auto cached = artifact->schedule(subg_indices[n]);
+      if (!artifact_loaded || cached == nullptr || cached->backends != schedule.backends ||
+          cached->opcodes != schedule.opcodes)
+      {
+        save_artifact = true;
+      }
+      artifact->schedule(subg_indices[n], schedule);
+    }
+  }
+
+  for (size_t n = 0; n < subg_indices.size(); ++n)
   {
-    const auto &subg_index = pair.first;
-    auto &lowered_subg = pair.second;
-    auto indexed_ranks = lowered_subg->indexed_ranks();
+    const auto &subg_index = subg_indices[n];
+    auto &lowered_subg = lowered_subgs[n];
 
     onert::dumper::dot::DotDumper dot_dumper_lowered(lowered_subg.get(), dump_level);
     dot_dumper_lowered.dump("after_lower_subg-" + std::to_string(subg_index.value()));
@@ -273,11 +464,35 @@ void Compiler::compile(void)
     ir::OperationDumper dumper("START SUBGRAPH " + std::to_string(subg_index.value()));
     lowered_subg->graph().operations().iterate(
         [&](const ir::OperationIndex &, const ir::Operation &op) { op.accept(dumper); });
+  }
 
-    auto executor = std::unique_ptr<exec::IExecutor>{
-        ExecutorFactory::get().create(std::move(lowered_subg), _options, _executors)};
-    executor->setIndexedRanks(indexed_ranks);
-    _executors->insert(std::make_pair(subg_index, std::move(executor)));
+  // Executors only keep the map to find executors of child subgraphs at execution time, so they can
+  // be created before the map is filled
+  _executors = std::make_shared<exec::ExecutorMap>();
+  std::vector<std::unique_ptr<exec::IExecutor>> executors(subg_indices.size());
+  forEachSubgraph(subg_indices, num_threads, [&](size_t n, const ir::SubgraphIndex &) {
+    auto indexed_ranks = lowered_subgs[n]->indexed_ranks();
+    executors[n] = std::unique_ptr<exec::IExecutor>{
+        ExecutorFactory::get().create(std::move(lowered_subgs[n]), _options, _executors)};
+    executors[n]->setIndexedRanks(indexed_ranks);
+  });
+
+  for (size_t n = 0; n < subg_indices.size(); ++n)
+  {
+    _executors->insert(std::make_pair(subg_indices[n], std::move(executors[n])));
+  }
+
+  // Failing to save the artifact does not fail the compilation
+  if (save_artifact)
+  {
+    try
+    {
+      artifact->save(_options.artifact_path);
+    }
+    catch (const std::exception &e)
+    {
+      VERBOSE(Compiler) << e.what() << std::endl;
+    }
   }
 
   /********************************
@@ -286,6 +501,25 @@ void Compiler::compile(void)
   _state = State::COMPILED;
 }
 
+uint32_t Compiler::numCompileThreads() const
+{
+  // Backends which are not loaded are not used
+  const auto &backend_manager = BackendManager::get();
+  for (const auto &backend_str : _options.backend_list)
+  {
+    const auto backend = backend_manager.get(backend_str);
+    if (backend != nullptr && !backend->config()->supportConcurrentCompile())
+    {
+      VERBOSE(Compiler) << "Compile subgraphs one by one for backend " << backend_str << std::endl;
+      return 1;
+    }
+  }
+
+  if (_options.compile_threads > 0)
+    return static_cast<uint32_t>(_options.compile_threads);
+  return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
 bool Compiler::checkCompilable()
 {
   // Disable compile phase
@@ -301,12 +535,25 @@ bool Compiler::checkCompilable()
   for (uint32_t i = 0; i < _subgraphs->count(); ++i)
   {
     auto graph = _subgraphs->at(ir::SubgraphIndex{i});
-    ParamChecker paramChecker{graph};
+    ParamChecker paramChecker{*graph};
     paramChecker();
     if (paramChecker.haveNoneConstParam())
     {
       return false;
     }
+
+    // Operations that only cpu can run with non-const parameters are assigned to cpu by
+    // ManualScheduler, and the rest of the graph stays on the compiled backends
+    if (!paramChecker.cpuOnlyOperations().empty())
+    {
+      const auto &backends = _options.backend_list;
+      const bool cpu_available =
+          std::find(backends.begin(), backends.end(), "cpu") != backends.end();
+      if (_options.he_scheduler || !cpu_available)
+      {
+        return false;
+      }
+    }
   }
 
   return true;
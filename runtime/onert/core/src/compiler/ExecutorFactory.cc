@@ -21,6 +21,7 @@
 #include "exec/LinearExecutor.h"
 #include "exec/DataflowExecutor.h"
 #include "exec/ParallelExecutor.h"
+#include "exec/WorkStealingExecutor.h"
 #include "compiler/BackendManager.h"
 #include "compiler/ExecutionBuilder.h"
 #include "exec/ExecTime.h"
@@ -49,9 +50,12 @@ ExecutorFactory::ExecutorFactory()
 {
   _map["Linear"] = createLinearExecutor;
   _map["Dataflow"] = std::bind(createDataflowExecutor, std::placeholders::_1, std::placeholders::_2,
-                               std::placeholders::_3, false);
+                               std::placeholders::_3, DataflowType::Dataflow);
   _map["Parallel"] = std::bind(createDataflowExecutor, std::placeholders::_1, std::placeholders::_2,
-                               std::placeholders::_3, true);
+                               std::placeholders::_3, DataflowType::Parallel);
+  _map["WorkStealing"] =
+      std::bind(createDataflowExecutor, std::placeholders::_1, std::placeholders::_2,
+                std::placeholders::_3, DataflowType::WorkStealing);
 }
 
 exec::IExecutor *ExecutorFactory::create(std::unique_ptr<ir::LoweredGraph> lowered_graph,
@@ -260,7 +264,7 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<ir::LoweredGraph> lowered_
 
 exec::IExecutor *ExecutorFactory::createDataflowExecutor(
     std::unique_ptr<ir::LoweredGraph> lowered_graph, const compiler::CompilerOptions &options,
-    const std::shared_ptr<exec::ExecutorMap> &executor_map, bool parallel)
+    const std::shared_ptr<exec::ExecutorMap> &executor_map, DataflowType type)
 {
   const auto &backend_contexts = lowered_graph->backend_contexts();
 
@@ -345,10 +349,17 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
   }
 
   exec::ExecutorBase *exec = nullptr;
-  if (parallel)
+  if (type == DataflowType::Parallel)
   {
-    exec =
-        new exec::ParallelExecutor{std::move(lowered_graph), tensor_builders, std::move(code_map)};
+    exec = new exec::ParallelExecutor{std::move(lowered_graph), tensor_builders,
+                                      std::move(code_map), options.parallel_threads};
+  }
+  else if (type == DataflowType::WorkStealing)
+  {
+    assert(options.work_stealing_threads >= 0);
+    exec = new exec::WorkStealingExecutor{std::move(lowered_graph), tensor_builders,
+                                          std::move(code_map),
+                                          static_cast<uint32_t>(options.work_stealing_threads)};
   }
   else
   {
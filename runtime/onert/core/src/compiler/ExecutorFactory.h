@@ -40,6 +40,14 @@ public:
 private:
   ExecutorFactory();
 
+private:
+  enum class DataflowType
+  {
+    Dataflow,
+    Parallel,
+    WorkStealing
+  };
+
 private:
   static void initializeBackendContext(ir::LoweredGraph *lowered_graph);
   static void runTensorRegistration(ir::LoweredGraph *lowered_graph,
@@ -51,7 +59,7 @@ private:
   static exec::IExecutor *
   createDataflowExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                          const compiler::CompilerOptions &options,
-                         const std::shared_ptr<exec::ExecutorMap> &executor_map, bool parallel);
+                         const std::shared_ptr<exec::ExecutorMap> &executor_map, DataflowType type);
 
 private:
   std::unordered_map<
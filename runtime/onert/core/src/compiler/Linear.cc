@@ -258,7 +258,9 @@ void Linear::planTensors(const ir::LoweredGraph &lowered_graph,
           tensor_builder_map[ind]->notifyLastUse(ind);
 
           // plan for deallocation of dynamic tensor
-          if (tensor_builder_map[ind]->supportDynamicTensor())
+          // NOTE Inputs of a subgraph are not deallocated as its caller may still read them after
+          //      running it, e.g. While copies inputs of cond subgraph to body subgraph
+          if (tensor_builder_map[ind]->supportDynamicTensor() && !graph.getInputs().contains(ind))
           {
             assert(tensor_builder_map[ind]->dynamicTensorManager());
             tensor_builder_map[ind]->dynamicTensorManager()->planDealloc(op_idx, ind);
@@ -15,7 +15,9 @@
  */
 
 #include "ManualScheduler.h"
+#include "ParamChecker.h"
 #include "ir/OpCode.h"
+#include "ir/OperationIndexMap.h"
 #include "ir/Operations.Include.h"
 #include "backend/Backend.h"
 #include "backend/IConfig.h"
@@ -100,7 +102,56 @@ std::unique_ptr<BackendResolver> ManualScheduler::schedule(const ir::Graph &grap
     }
   }
 
-  // 4. Operations that are specially handled
+  // 4. Operations with non-const parameters that only cpu can run
+  //    Only these operations are moved to cpu instead of running the whole model on interpreter
+  ParamChecker param_checker{graph};
+  param_checker();
+  //    Their outputs are dynamic, and so are the outputs of the operations using them. Those
+  //    operations are moved to cpu as well if their backends do not support dynamic tensors.
+  std::vector<ir::OperationIndex> dynamic_ops;
+  ir::OperationIndexMap<bool> visited;
+  auto pushUses = [&](const ir::Operation &operation) {
+    for (const auto &output : operation.getOutputs() | ir::Remove::UNDEFINED)
+    {
+      for (const auto &use : graph.operands().at(output).getUses())
+        dynamic_ops.emplace_back(use);
+    }
+  };
+  auto setCpuBackend = [&](const ir::OperationIndex &index) {
+    const backend::Backend *cpu_backend = resolveBackend("cpu");
+    if (cpu_backend == nullptr)
+      throw std::runtime_error{"ManualScheduler: cpu backend is required for operation #" +
+                               std::to_string(index.value())};
+    backend_resolver->setBackend(index, cpu_backend);
+  };
+
+  for (const auto &index : param_checker.cpuOnlyOperations())
+  {
+    VERBOSE(ManualScheduler) << "Operation #" << index.value()
+                             << " has non-const parameters, use cpu backend" << std::endl;
+    setCpuBackend(index);
+    visited[index] = true;
+    pushUses(graph.operations().at(index));
+  }
+
+  while (!dynamic_ops.empty())
+  {
+    const auto index = dynamic_ops.back();
+    dynamic_ops.pop_back();
+    if (visited[index])
+      continue;
+    visited[index] = true;
+
+    if (!backend_resolver->getBackend(index)->config()->supportDynamicTensor())
+    {
+      VERBOSE(ManualScheduler) << "Operation #" << index.value()
+                               << " has dynamic inputs, use cpu backend" << std::endl;
+      setCpuBackend(index);
+    }
+    pushUses(graph.operations().at(index));
+  }
+
+  // 5. Operations that are specially handled
   //    All configuration above will be ignored(overwritten)
   op_type_map[ir::OpCode::Permute] = BackendManager::get().get("cpu");
 
@@ -117,12 +168,12 @@ const backend::Backend *ManualScheduler::resolveBackend(const std::string &id,
                                                         const backend::Backend *fallback)
 {
   // Ensure if the backend is available in the backend
-  const backend::Backend *backend = BackendManager::get().get(id);
-  if (!backend || _backend_contexts.find(backend) == _backend_contexts.end())
+  for (const auto &e : _backend_contexts)
   {
-    backend = fallback;
+    if (e.first->config()->id() == id)
+      return e.first;
   }
-  return backend;
+  return fallback;
 }
 
 } // namespace compiler
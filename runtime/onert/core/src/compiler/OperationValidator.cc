@@ -864,9 +864,12 @@ void OperationValidator::visit(const ir::operation::LSTM &node)
   bool has_projection_bias = _ctx.at(projection_bias_index).shape().dim(0);
 
   // NOTE The cell_to_input_weights do not exist in non-peephole although regular LSTM(non-CIFG).
+  // NOTE CIFG LSTM may have shaped input gate operands without data, so the number of gates in the
+  //      scratch buffer decides it.
   // true: no CIFG
   // false: CIFG
-  bool has_cifg_param = has_input_to_input_weights && has_recurrent_to_input_weights;
+  bool has_cifg_param = _ctx.at(scratch_buffer_index).shape().dim(1) ==
+                        _ctx.at(cell_state_out_index).shape().dim(1) * 4;
 
   // NOTE The cell_to_input_weights do not exist in regular CIFG although peephole.
   // true: peephole
@@ -25,8 +25,80 @@ namespace compiler
 
 void ParamChecker::operator()()
 {
-  _model->operations().iterate(
-      [&](const ir::OperationIndex &, const ir::Operation &node) { node.accept(*this); });
+  _model.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &node) {
+    _current = index;
+    node.accept(*this);
+  });
+}
+
+bool ParamChecker::isConstant(const ir::OperandIndex &index) const
+{
+  return _model.operands().at(index).isConstant();
+}
+
+// cpu backend reads these parameters at execution, so only the operation runs on cpu
+void ParamChecker::checkCpuParam(const std::vector<ir::OperandIndex> &params)
+{
+  for (const auto &param : params)
+  {
+    if (!isConstant(param))
+    {
+      _cpuOnlyOps.emplace_back(_current);
+      return;
+    }
+  }
+}
+
+// No compiled backend supports these parameters as non-const yet
+void ParamChecker::checkParam(const std::vector<ir::OperandIndex> &params)
+{
+  for (const auto &param : params)
+  {
+    if (!isConstant(param))
+      _nonConstParam = true;
+  }
+}
+
+void ParamChecker::visit(const ir::operation::BatchToSpaceND &node)
+{
+  checkParam({node.getInputs().at(ir::operation::BatchToSpaceND::Input::BLOCK_SIZE)});
+}
+
+void ParamChecker::visit(const ir::operation::ExpandDims &node)
+{
+  checkCpuParam({node.getInputs().at(ir::operation::ExpandDims::Input::AXIS)});
+}
+
+void ParamChecker::visit(const ir::operation::Pad &node)
+{
+  checkParam({node.getInputs().at(ir::operation::Pad::Input::PAD)});
+}
+
+void ParamChecker::visit(const ir::operation::Reshape &node)
+{
+  // Shape can be given as Param instead of input
+  if (node.getInputs().size() < 2)
+    return;
+  checkCpuParam({node.getInputs().at(ir::operation::Reshape::Input::SHAPE)});
+}
+
+void ParamChecker::visit(const ir::operation::Slice &node)
+{
+  checkCpuParam({node.getInputs().at(ir::operation::Slice::Input::BEGINS),
+                 node.getInputs().at(ir::operation::Slice::Input::SIZES)});
+}
+
+void ParamChecker::visit(const ir::operation::SpaceToBatchND &node)
+{
+  checkParam({node.getInputs().at(ir::operation::SpaceToBatchND::Input::BLOCK_SIZE),
+              node.getInputs().at(ir::operation::SpaceToBatchND::Input::PADDINGS)});
+}
+
+void ParamChecker::visit(const ir::operation::StridedSlice &node)
+{
+  checkCpuParam({node.getInputs().at(ir::operation::StridedSlice::Input::STARTS),
+                 node.getInputs().at(ir::operation::StridedSlice::Input::ENDS),
+                 node.getInputs().at(ir::operation::StridedSlice::Input::STRIDES)});
 }
 
 } // namespace compiler
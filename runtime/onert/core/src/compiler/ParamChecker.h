@@ -23,8 +23,11 @@
 #ifndef __ONERT_COMPILER_PARAM_CHECKER_H__
 #define __ONERT_COMPILER_PARAM_CHECKER_H__
 
+#include "ir/Index.h"
 #include "ir/OperationVisitor.h"
 
+#include <vector>
+
 namespace onert
 {
 namespace ir
@@ -49,7 +52,7 @@ public:
    * @brief Construct a new Param Checker object
    * @param[in] model Graph model to check
    */
-  ParamChecker(std::shared_ptr<ir::Graph> model) : _model{model} {}
+  ParamChecker(const ir::Graph &model) : _model{model} {}
 
 public:
   /**
@@ -58,13 +61,35 @@ public:
   void operator()();
   /**
    * @brief   Return analysis result if model have non-const parameter
-   * @return  @c true if there is non-const parameter, otherwise @c false
+   *          that no compiled backend can handle
+   * @return  @c true if there is such non-const parameter, otherwise @c false
    */
   bool haveNoneConstParam(void) { return _nonConstParam; }
+  /**
+   * @brief   Return operations having non-const parameter that cpu backend reads at execution
+   * @return  Indexes of the operations
+   */
+  const std::vector<ir::OperationIndex> &cpuOnlyOperations(void) const { return _cpuOnlyOps; }
+
+public:
+  void visit(const ir::operation::BatchToSpaceND &node) override;
+  void visit(const ir::operation::ExpandDims &node) override;
+  void visit(const ir::operation::Pad &node) override;
+  void visit(const ir::operation::Reshape &node) override;
+  void visit(const ir::operation::Slice &node) override;
+  void visit(const ir::operation::SpaceToBatchND &node) override;
+  void visit(const ir::operation::StridedSlice &node) override;
+
+private:
+  bool isConstant(const ir::OperandIndex &index) const;
+  void checkCpuParam(const std::vector<ir::OperandIndex> &params);
+  void checkParam(const std::vector<ir::OperandIndex> &params);
 
 private:
-  const std::shared_ptr<ir::Graph> _model;
+  const ir::Graph &_model;
   bool _nonConstParam{false};
+  ir::OperationIndex _current;
+  std::vector<ir::OperationIndex> _cpuOnlyOps;
 };
 
 } // namespace compiler
@@ -32,6 +32,18 @@ Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors
   _io_desc.outputs.resize(primary_subg.getOutputs().size());
 }
 
+Execution::~Execution()
+{
+  {
+    std::lock_guard<std::mutex> lock{_exec_mutex};
+    _exec_terminate = true;
+  }
+  _exec_cv.notify_all();
+
+  if (_exec_thread)
+    _exec_thread->join();
+}
+
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
 {
   // This should be called BEFORE setInput.
@@ -141,17 +153,73 @@ void Execution::execute()
 
 void Execution::startExecute()
 {
-  VERBOSE(Execution) << "Create asynchronous execution thread" << std::endl;
+  VERBOSE(Execution) << "Queue asynchronous execution" << std::endl;
 
-  _exec_thread = std::make_unique<std::thread>(&Execution::execute, this);
+  {
+    std::lock_guard<std::mutex> lock{_exec_mutex};
+    finished = false;
+    _exec_exception = nullptr;
+    if (!_exec_thread)
+    {
+      VERBOSE(Execution) << "Create asynchronous execution thread" << std::endl;
+      _exec_thread = std::make_unique<std::thread>(&Execution::runExecThread, this);
+    }
+    _exec_jobs.emplace([this]() { execute(); });
+    _exec_pending++;
+  }
+  _exec_cv.notify_all();
 }
 
 void Execution::waitFinish()
 {
   VERBOSE(Execution) << "Wait to finish execution" << std::endl;
 
-  _exec_thread->join();
+  std::unique_lock<std::mutex> lock{_exec_mutex};
+  _exec_cv.wait(lock, [this]() { return _exec_pending == 0; });
   finished = true;
+
+  if (_exec_exception)
+  {
+    auto exception = _exec_exception;
+    _exec_exception = nullptr;
+    std::rethrow_exception(exception);
+  }
+}
+
+void Execution::runExecThread(void)
+{
+  while (true)
+  {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock{_exec_mutex};
+      _exec_cv.wait(lock, [this]() { return _exec_terminate || !_exec_jobs.empty(); });
+      // Queued jobs are finished before terminating
+      if (_exec_jobs.empty())
+        return;
+      job = std::move(_exec_jobs.front());
+      _exec_jobs.pop();
+    }
+
+    std::exception_ptr exception;
+    try
+    {
+      job();
+    }
+    catch (...)
+    {
+      // Rethrown by waitFinish() on the caller's thread
+      exception = std::current_exception();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock{_exec_mutex};
+      if (exception)
+        _exec_exception = exception;
+      _exec_pending--;
+    }
+    _exec_cv.notify_all();
+  }
 }
 
 bool Execution::isFinished(void) const { return finished; }
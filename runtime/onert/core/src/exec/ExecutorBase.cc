@@ -19,11 +19,46 @@
 #include "backend/ITensor.h"
 #include "util/logging.h"
 
+#include <algorithm>
+
 namespace onert
 {
 namespace exec
 {
 
+namespace
+{
+
+bool isOverlapped(const void *a, size_t a_size, const void *b, size_t b_size)
+{
+  const auto a_begin = reinterpret_cast<uintptr_t>(a);
+  const auto b_begin = reinterpret_cast<uintptr_t>(b);
+  return a_begin < b_begin + b_size && b_begin < a_begin + a_size;
+}
+
+// An output buffer sharing memory with any other user buffer cannot be bound, since kernels would
+// overwrite inputs they have not read yet or other outputs
+bool isSharedBuffer(const IODescription &desc, uint32_t output_n)
+{
+  const auto &output = *desc.outputs.at(output_n);
+  for (const auto &input : desc.inputs)
+  {
+    if (input != nullptr && input->buffer != nullptr &&
+        isOverlapped(output.buffer, output.size, input->buffer, input->size))
+      return true;
+  }
+  for (uint32_t n = 0; n < desc.outputs.size(); ++n)
+  {
+    const auto &other = desc.outputs.at(n);
+    if (n != output_n && other != nullptr && other->buffer != nullptr &&
+        isOverlapped(output.buffer, output.size, other->buffer, other->size))
+      return true;
+  }
+  return false;
+}
+
+} // namespace
+
 ExecutorBase::ExecutorBase(std::unique_ptr<ir::LoweredGraph> &&lowered_graph,
                            const backend::TensorBuilderSet &tensor_builders)
     : _lowered_graph{std::move(lowered_graph)}, _graph{_lowered_graph->graph()}, _mutex()
@@ -81,6 +116,38 @@ ExecutorBase::ExecutorBase(std::unique_ptr<ir::LoweredGraph> &&lowered_graph,
   _input_tensors = build_input_tensor_list(_graph.getInputs());
   _output_tensors = build_output_tensor_list(_graph.getOutputs());
 
+  // A user buffer can be bound only to a tensor which is a single I/O of the graph. Tensors of
+  // custom operations keep their memory since custom kernels take the addresses of tensors when
+  // they are generated.
+  auto is_bindable = [&](const std::shared_ptr<backend::ITensor> &tensor,
+                         const ir::OperandIndex &ind) {
+    if (tensor == nullptr)
+      return false;
+    const auto num_ios = std::count(_input_tensors.begin(), _input_tensors.end(), tensor) +
+                         std::count(_output_tensors.begin(), _output_tensors.end(), tensor);
+    if (num_ios != 1)
+      return false;
+    const auto &operand = _graph.operands().at(ind);
+    auto is_custom = [&](const ir::OperationIndex &op_ind) {
+      return _graph.operations().at(op_ind).opcode() == ir::OpCode::Custom;
+    };
+    return std::none_of(operand.getUses().begin(), operand.getUses().end(), is_custom) &&
+           std::none_of(operand.getDef().begin(), operand.getDef().end(), is_custom);
+  };
+
+  _input_bindings.resize(_input_tensors.size());
+  for (uint32_t n = 0; n < _input_tensors.size(); ++n)
+  {
+    _input_bindings[n].bindable =
+        is_bindable(_input_tensors[n], _graph.getInputs().at(ir::IOIndex{n}));
+  }
+  _output_bindings.resize(_output_tensors.size());
+  for (uint32_t n = 0; n < _output_tensors.size(); ++n)
+  {
+    _output_bindings[n].bindable =
+        is_bindable(_output_tensors[n], _graph.getOutputs().at(ir::IOIndex{n}));
+  }
+
   // Prepare each TensorManager on each backend
   for (auto &tensor_builder : tensor_builders)
   {
@@ -115,6 +182,7 @@ std::unique_ptr<ISource> ExecutorBase::source(const ir::IOIndex &index, const ir
     case DataType::UINT8:
       return source<uint8_t>(index, buffer, length, io_layout);
     case DataType::QUANT_INT8_SYMM:
+    case DataType::QUANT_INT8_ASYMM:
       return source<int8_t>(index, buffer, length, io_layout);
     default:
       throw std::runtime_error("Not supported yet");
@@ -138,6 +206,7 @@ std::unique_ptr<ISink> ExecutorBase::sink(const ir::IOIndex &index, const ir::Ty
     case DataType::UINT8:
       return sink<uint8_t>(index, buffer, length, io_layout);
     case DataType::QUANT_INT8_SYMM:
+    case DataType::QUANT_INT8_ASYMM:
       return sink<int8_t>(index, buffer, length, io_layout);
     default:
       throw std::runtime_error("Not supported yet");
@@ -191,24 +260,21 @@ void ExecutorBase::execute(const std::vector<std::shared_ptr<backend::ITensor>>
       const auto orig_input_shape = getShape(input_tensor.get());
       const auto changed_input_shape =
           convertShape(getShape(src_tensor.get()), src_tensor->layout(), input_tensor->layout());
-      if (orig_input_shape != changed_input_shape)
+      if (dyn_alloc_info == _input_to_dyn_alloc_info.end())
       {
-        if (dyn_alloc_info == _input_to_dyn_alloc_info.end())
+        if (orig_input_shape != changed_input_shape)
         {
           // The input_tensor is a dynamic tensor of backend that doesn't support dynamic tensor
           throw std::runtime_error("Unknown dim is found at execution time for a backend that "
                                    "does not support dynamic tensor");
         }
-        else
-        {
-          const auto operand_ind = dyn_alloc_info->second.ind;
-          if (orig_input_shape != changed_input_shape)
-          {
-            dyn_alloc_info->second.dyn_tensor_manager->allocate(operand_ind, changed_input_shape);
-            // TODO Move changeInputShape() above allocate()
-            changeInputShape(operand_ind, changed_input_shape);
-          }
-        }
+      }
+      else if (orig_input_shape != changed_input_shape || input_tensor->is_dynamic())
+      {
+        // A dynamic input may have been deallocated after its last use in the previous execution
+        // although its shape is the same, and applyShape allocates it again in that case
+        const auto operand_ind = dyn_alloc_info->second.ind;
+        dyn_alloc_info->second.dyn_tensor_manager->applyShape(operand_ind, changed_input_shape);
       }
     }
   }
@@ -253,6 +319,12 @@ void ExecutorBase::execute(const IODescription &desc)
     handleDynamicInputTensor(input_index, desc);
 
     const auto &input = *desc.inputs.at(n);
+    if (bindUserBuffer(*_input_tensors[n], _input_bindings[n], input.info, input.buffer,
+                       input.size, input.layout))
+    {
+      continue;
+    }
+
     sources.at(n) =
         source(input_index, input.info.typeInfo(), input.buffer, input.size, input.layout);
 
@@ -261,7 +333,48 @@ void ExecutorBase::execute(const IODescription &desc)
     _input_tensors[n]->access(setter);
   }
 
-  executeImpl();
+  // Bind output buffers. Outputs may become dynamic while running if any input is dynamic, and
+  // then their memory is given by the dynamic tensor manager, so those are copied out.
+  const bool has_dynamic_input =
+      !desc.input_shape_signature.empty() ||
+      std::any_of(_input_tensors.begin(), _input_tensors.end(),
+                  [](const std::shared_ptr<backend::ITensor> &tensor) {
+                    return tensor != nullptr && tensor->is_dynamic();
+                  });
+  for (uint32_t n = 0; n < _graph.getOutputs().size() && !has_dynamic_input; ++n)
+  {
+    if (desc.outputs.at(n) == nullptr)
+      continue;
+
+    const auto &output = *desc.outputs.at(n);
+    if (isSharedBuffer(desc, n))
+      continue;
+
+    bindUserBuffer(*_output_tensors[n], _output_bindings[n], output.info, output.buffer,
+                   output.size, output.layout);
+  }
+
+  auto unbind_inputs = [&]() {
+    for (uint32_t n = 0; n < _input_tensors.size(); ++n)
+    {
+      if (_input_tensors[n] != nullptr)
+        unbindUserBuffer(*_input_tensors[n], _input_bindings[n]);
+    }
+  };
+
+  try
+  {
+    executeImpl();
+  }
+  catch (...)
+  {
+    unbind_inputs();
+    for (uint32_t n = 0; n < _output_tensors.size(); ++n)
+      unbindUserBuffer(*_output_tensors[n], _output_bindings[n]);
+    throw;
+  }
+
+  unbind_inputs();
 
   // Get output(s)
   for (uint32_t n = 0; n < _graph.getOutputs().size(); ++n)
@@ -279,12 +392,20 @@ void ExecutorBase::execute(const IODescription &desc)
     output.info.shape(
         convertShape(output_tensor_shape, _output_tensors[n]->layout(), output.layout));
 
-    sinks.at(n) =
-        sink(output_index, output.info.typeInfo(), output.buffer, output.size, output.layout);
+    // The output is already in the user buffer unless the tensor got other memory while running
+    const bool is_written =
+        _output_bindings[n].bound && _output_tensors[n]->buffer() == output.buffer;
+    unbindUserBuffer(*_output_tensors[n], _output_bindings[n]);
+
+    if (!is_written)
+    {
+      sinks.at(n) =
+          sink(output_index, output.info.typeInfo(), output.buffer, output.size, output.layout);
 
-    auto getter = [&](::onert::backend::ITensor &tensor) { sinks.at(n)->pull(tensor); };
+      auto getter = [&](::onert::backend::ITensor &tensor) { sinks.at(n)->pull(tensor); };
 
-    _output_tensors[n]->access(getter);
+      _output_tensors[n]->access(getter);
+    }
 
     // deallocate output tensors if it is dynamic
     {
@@ -337,5 +458,55 @@ void ExecutorBase::handleDynamicInputTensor(ir::IOIndex io_ind, const IODescript
   }
 }
 
+/**
+ * @brief Make the tensor use the user buffer as its memory instead of copying from/to it
+ *
+ * @note  The buffer is bound only if kernels can access it just as the memory of the tensor, i.e.
+ *        it has the same data type, layout and size without padding, and is aligned to the
+ *        element type. Otherwise the tensor keeps its own memory and the caller copies.
+ * @return true if the buffer is bound
+ */
+bool ExecutorBase::bindUserBuffer(backend::ITensor &tensor, UserBufferBinding &binding,
+                                  const ir::OperandInfo &info, const void *buffer, size_t length,
+                                  ir::Layout io_layout)
+{
+  if (!binding.bindable || buffer == nullptr || tensor.is_dynamic() || tensor.has_padding())
+    return false;
+
+  if (info.typeInfo().type() != tensor.data_type() || length != tensor.total_size())
+    return false;
+
+  // Tensors of rank 4 are permuted when their layout differs from the user's
+  const auto tensor_layout = tensor.layout();
+  const bool is_permuted = ((io_layout == ir::Layout::NHWC && tensor_layout == ir::Layout::NCHW) ||
+                            (io_layout == ir::Layout::NCHW && tensor_layout == ir::Layout::NHWC));
+  if (is_permuted && tensor.num_dimensions() >= 4)
+    return false;
+
+  const auto element_size = ir::sizeOfDataType(tensor.data_type());
+  if (reinterpret_cast<uintptr_t>(buffer) % element_size != 0)
+    return false;
+
+  auto own_buffer = binding.bound ? binding.own_buffer : tensor.buffer();
+  // NOTE Kernels do not write their inputs, so input buffers are bound as they are
+  if (!tensor.setExternalBuffer(const_cast<uint8_t *>(static_cast<const uint8_t *>(buffer))))
+    return false;
+
+  binding.bound = true;
+  binding.own_buffer = own_buffer;
+  return true;
+}
+
+void ExecutorBase::unbindUserBuffer(backend::ITensor &tensor, UserBufferBinding &binding)
+{
+  if (!binding.bound)
+    return;
+
+  // NOTE This fails only if the tensor has become dynamic, then the dynamic tensor manager gives
+  //      its memory
+  tensor.setExternalBuffer(binding.own_buffer);
+  binding.bound = false;
+}
+
 } // namespace exec
 } // namespace onert
@@ -155,6 +155,23 @@ protected:
     backend::IDynamicTensorManager *dyn_tensor_manager;
   };
 
+  /**
+   * @brief State of binding a user buffer as the memory of an input or output tensor
+   *        User buffers are bound only during execute(const IODescription &), and the tensor
+   *        gets back its own memory after that.
+   */
+  struct UserBufferBinding
+  {
+    /// @brief false if the tensor must keep its own memory, e.g. it is shared between I/Os
+    bool bindable = true;
+
+    /// @brief true while the tensor uses the user buffer
+    bool bound = false;
+
+    /// @brief memory of the tensor to restore after execution
+    uint8_t *own_buffer = nullptr;
+  };
+
   ExecutionObservee _subject;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
   std::unique_ptr<ir::LoweredGraph> _lowered_graph;
@@ -163,11 +180,17 @@ protected:
   std::vector<std::shared_ptr<backend::ITensor>> _output_tensors;
   std::unordered_map<std::shared_ptr<backend::ITensor>, DynAllocInfo> _input_to_dyn_alloc_info;
   std::unordered_map<std::shared_ptr<backend::ITensor>, DynAllocInfo> _output_to_dyn_alloc_info;
+  std::vector<UserBufferBinding> _input_bindings;
+  std::vector<UserBufferBinding> _output_bindings;
   backend::TensorManagerSet _tensor_mgrs;
   std::mutex _mutex;
 
 private:
   void handleDynamicInputTensor(ir::IOIndex input_index, const IODescription &desc);
+  bool bindUserBuffer(backend::ITensor &tensor, UserBufferBinding &binding,
+                      const ir::OperandInfo &info, const void *buffer, size_t length,
+                      ir::Layout io_layout);
+  void unbindUserBuffer(backend::ITensor &tensor, UserBufferBinding &binding);
 };
 
 } // namespace exec
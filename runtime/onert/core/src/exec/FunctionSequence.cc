@@ -21,6 +21,8 @@
 #include "backend/ITensorRegistry.h"
 #include "util/ShapeInference.h"
 
+#include <algorithm>
+
 namespace onert
 {
 namespace exec
@@ -64,25 +66,176 @@ void FunctionSequence::iterate(const std::function<void(IFunction &)> &fn)
   }
 }
 
+/**
+ * @brief Dynamic tensor manager which forwards to another one, recording shapes applied to it
+ */
+class FunctionSequenceForDynamicBackend::ShapeRecorder : public backend::IDynamicTensorManager
+{
+public:
+  ShapeRecorder(backend::IDynamicTensorManager *manager) : _manager{manager} {}
+
+  void record(AppliedShapes *applied) { _applied = applied; }
+
+  void applyShape(const ir::OperandIndex &ind, const ir::Shape &new_shape) override
+  {
+    if (_applied)
+      _applied->emplace_back(ind, new_shape);
+    _manager->applyShape(ind, new_shape);
+  }
+  void allocate(const ir::OperandIndex &ind, const ir::Shape &new_shape) override
+  {
+    // Outputs allocated here may have been deallocated when the plan is replayed, and applyShape
+    // allocates them again like this does
+    if (_applied)
+      _applied->emplace_back(ind, new_shape);
+    _manager->allocate(ind, new_shape);
+  }
+  void changeShape(const ir::OperandIndex &ind, const ir::Shape &new_shape) override
+  {
+    _manager->changeShape(ind, new_shape);
+  }
+  void planDealloc(ir::OperationIndex op_ind, ir::OperandIndex operand_ind) override
+  {
+    _manager->planDealloc(op_ind, operand_ind);
+  }
+  void deallocInput(ir::OperationIndex op_ind) override { _manager->deallocInput(op_ind); }
+  void deallocSubgraphOutput(ir::OperandIndex ind) override
+  {
+    _manager->deallocSubgraphOutput(ind);
+  }
+
+private:
+  backend::IDynamicTensorManager *_manager;
+  AppliedShapes *_applied = nullptr;
+};
+
+namespace
+{
+
+// Output shapes of these operations depend on values of their inputs as well as shapes, so their
+// shape inference runs always
+bool isShapeFromValues(const ir::Operation &op)
+{
+  return op.opcode() == ir::OpCode::Reshape || op.opcode() == ir::OpCode::ExpandDims;
+}
+
+} // namespace
+
+FunctionSequenceForDynamicBackend::FunctionSequenceForDynamicBackend(
+    const ir::OpSequence &op_seq, const ir::Operands &operands, const ir::Operations &operations,
+    backend::IDynamicTensorManager *dyn_tensor_manager,
+    const std::shared_ptr<backend::ITensorRegistry> &tensor_registry)
+    : _op_seq(op_seq), _operations_ctx(operations), _dyn_tensor_manager(dyn_tensor_manager),
+      _tensor_registry(tensor_registry),
+      _shape_recorder(std::make_unique<ShapeRecorder>(dyn_tensor_manager)),
+      _dyn_shape_inferer(std::make_unique<shape_inference::DynamicInferer>(
+          operands, _shape_recorder.get(), tensor_registry))
+{
+  ir::OperandIndexSequence defined;
+  for (const auto &op_ind : _op_seq.operations())
+  {
+    const auto &op = _operations_ctx.at(op_ind);
+    for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    {
+      if (!operands.at(ind).isConstant() && !defined.contains(ind) &&
+          std::find(_input_operands.begin(), _input_operands.end(), ind) == _input_operands.end())
+        _input_operands.emplace_back(ind);
+    }
+    defined = defined + op.getOutputs();
+  }
+}
+
+FunctionSequenceForDynamicBackend::~FunctionSequenceForDynamicBackend() = default;
+
+FunctionSequenceForDynamicBackend::ShapePlan *
+FunctionSequenceForDynamicBackend::findShapePlan(const ShapePlan &key)
+{
+  for (auto it = _shape_plans.begin(); it != _shape_plans.end(); ++it)
+  {
+    if (it->input_shapes == key.input_shapes && it->input_dynamics == key.input_dynamics)
+    {
+      _shape_plans.splice(_shape_plans.begin(), _shape_plans, it);
+      return &_shape_plans.front();
+    }
+  }
+  return nullptr;
+}
+
+void FunctionSequenceForDynamicBackend::inferShape(const ir::Operation &op,
+                                                   AppliedShapes &applied)
+{
+  _shape_recorder->record(&applied);
+  try
+  {
+    op.accept(*_dyn_shape_inferer);
+  }
+  catch (...)
+  {
+    _shape_recorder->record(nullptr);
+    throw;
+  }
+  _shape_recorder->record(nullptr);
+}
+
 void FunctionSequenceForDynamicBackend::run()
 {
   if (_op_seq.size() != _functions.size())
     throw std::runtime_error("operation and functions should be mapped one by one");
 
+  ShapePlan current;
+  for (const auto &ind : _input_operands)
+  {
+    auto tensor = _tensor_registry->getITensor(ind);
+    current.input_shapes.emplace_back(tensor ? getShape(tensor.get()) : ir::Shape{});
+    current.input_dynamics.emplace_back(tensor && tensor->is_dynamic());
+  }
+
+  // Replay shapes recorded for the same input shapes, or record new ones
+  ShapePlan *plan = findShapePlan(current);
+  if (plan == nullptr)
+    current.applied.resize(_functions.size());
+
   auto op_seq_iter = _op_seq.begin();
-  for (const auto &function : _functions)
+  for (size_t i = 0; i < _functions.size(); ++i, ++op_seq_iter)
   {
     // set shape of output and allocate memory when needed
     auto &op = _operations_ctx.at(*op_seq_iter);
-    op.accept(*_dyn_shape_inferer);
+    if (plan == nullptr)
+    {
+      inferShape(op, current.applied[i]);
+    }
+    else if (isShapeFromValues(op))
+    {
+      AppliedShapes applied;
+      inferShape(op, applied);
+      if (applied != plan->applied[i])
+      {
+        // Shapes of the rest depend on values which have changed, so record them again
+        current.applied.assign(plan->applied.begin(), plan->applied.begin() + i);
+        current.applied.emplace_back(std::move(applied));
+        current.applied.resize(_functions.size());
+        _shape_plans.pop_front();
+        plan = nullptr;
+      }
+    }
+    else
+    {
+      for (const auto &shape : plan->applied[i])
+        _dyn_tensor_manager->applyShape(shape.first, shape.second);
+    }
 
     // run kernel
-    function->run();
+    _functions[i]->run();
 
     // deallocate input tensors which is no longer used
     _dyn_tensor_manager->deallocInput(*op_seq_iter);
+  }
 
-    op_seq_iter++;
+  if (plan == nullptr)
+  {
+    _shape_plans.emplace_front(std::move(current));
+    if (_shape_plans.size() > MAX_SHAPE_PLANS)
+      _shape_plans.pop_back();
   }
 }
 
@@ -62,23 +62,24 @@ void ParallelExecutor::notify(uint32_t finished_job_id)
 
 ParallelExecutor::ParallelExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
                                    const backend::TensorBuilderSet &tensor_builders,
-                                   compiler::CodeMap &&code_map)
+                                   compiler::CodeMap &&code_map,
+                                   const std::unordered_map<std::string, int> &num_threads)
     : DataflowExecutor{std::move(lowered_graph), tensor_builders, std::move(code_map)}
 {
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
-}
 
-void ParallelExecutor::executeImpl()
-{
-  // Init scheduler
+  // Init scheduler once so that its worker threads are reused by every execution
   // TODO Consider to have distinct backend set in LowerInfoMap
   ir::BackendSet backends;
   for (auto &itr : _lowered_graph->getLowerInfo()->op_seq)
   {
     backends.add(itr.second->backend());
   }
-  _scheduler = std::make_unique<ParallelScheduler>(backends);
+  _scheduler = std::make_unique<ParallelScheduler>(backends, num_threads);
+}
 
+void ParallelExecutor::executeImpl()
+{
   assert(noWaitingJobs());
 
   // Execution setup
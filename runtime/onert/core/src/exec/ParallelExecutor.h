@@ -49,9 +49,11 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map OpSequence and its code map
+   * @param num_threads Number of worker threads for each backend id
    */
   ParallelExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
-                   const backend::TensorBuilderSet &tensor_builders, compiler::CodeMap &&code_map);
+                   const backend::TensorBuilderSet &tensor_builders, compiler::CodeMap &&code_map,
+                   const std::unordered_map<std::string, int> &num_threads = {});
 
   void executeImpl() override;
 
@@ -19,6 +19,7 @@
 #include <cassert>
 
 #include <memory>
+#include "backend/Backend.h"
 #include "util/logging.h"
 
 namespace onert
@@ -26,13 +27,23 @@ namespace onert
 namespace exec
 {
 
-ParallelScheduler::ParallelScheduler(const ir::BackendSet &backends)
+ParallelScheduler::ParallelScheduler(const ir::BackendSet &backends,
+                                     const std::unordered_map<std::string, int> &num_threads)
 {
   assert(!backends.empty());
 
   for (auto backend : backends)
   {
-    _thread_pools[backend] = std::make_unique<ThreadPool>();
+    uint32_t backend_num_threads = 1;
+    auto it = num_threads.find(backend->config()->id());
+    if (it != num_threads.end())
+    {
+      assert(it->second >= 1);
+      backend_num_threads = static_cast<uint32_t>(it->second);
+    }
+    VERBOSE(ParallelScheduler) << "Create " << backend_num_threads << " thread(s) for backend "
+                               << backend->config()->id() << std::endl;
+    _thread_pools[backend] = std::make_unique<ThreadPool>(backend_num_threads);
   }
 }
 
@@ -47,7 +58,7 @@ void ParallelScheduler::finish()
 {
   for (auto &itr : _thread_pools)
   {
-    itr.second->finish();
+    itr.second->wait();
   }
 }
 
@@ -19,6 +19,7 @@
 
 #include <unordered_map>
 #include <memory>
+#include <string>
 
 #include "exec/IFunction.h"
 #include "ir/BackendSet.h"
@@ -35,9 +36,11 @@ public:
   /**
    * @brief Constructs ParallelScheduler object
    *
-   * @param backends Backend set
+   * @param backends    Backend set
+   * @param num_threads Number of threads for each backend id. A backend not in the map gets 1
    */
-  ParallelScheduler(const ir::BackendSet &backends);
+  ParallelScheduler(const ir::BackendSet &backends,
+                    const std::unordered_map<std::string, int> &num_threads = {});
   /**
    * @brief Assign a task to the given backend
    *
@@ -47,6 +50,7 @@ public:
   void assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend);
   /**
    * @brief Block until all jobs are finished
+   * @note  Threads are not terminated so that the scheduler can be reused for the next run
    */
   void finish();
 
@@ -55,6 +55,8 @@ void ThreadPool::join()
   _threads.clear();
 }
 
+void ThreadPool::wait() { _worker.join(); }
+
 void ThreadPool::finish()
 {
   _worker.finish();
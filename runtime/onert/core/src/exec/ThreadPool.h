@@ -55,7 +55,12 @@ public:
   uint32_t numJobsInQueue();
 
   /**
-   * @brief Block until all jobs are finished
+   * @brief Block until all jobs are finished. Worker threads are kept alive for the next jobs
+   */
+  void wait();
+
+  /**
+   * @brief Block until all jobs are finished and terminate worker threads
    */
   void finish();
 
@@ -59,11 +59,24 @@ void WorkQueue::operator()()
         assert(((_state == State::FINISHING) || (_state == State::ONLINE)) && !_functions.empty());
         fn = std::move(_functions.front());
         _functions.pop();
+        ++_num_running_jobs;
       }
     }
 
     assert(fn);
     fn->run();
+    fn.reset();
+
+    bool idle = false;
+    {
+      std::unique_lock<std::mutex> lock{_mu};
+      --_num_running_jobs;
+      idle = _functions.empty() && _num_running_jobs == 0;
+    }
+    if (idle)
+    {
+      _cv_idle.notify_all();
+    }
   }
 }
 
@@ -94,6 +107,12 @@ void WorkQueue::finish()
   _cv.notify_all();
 }
 
+void WorkQueue::join()
+{
+  std::unique_lock<std::mutex> lock{_mu};
+  _cv_idle.wait(lock, [this] { return _functions.empty() && _num_running_jobs == 0; });
+}
+
 uint32_t WorkQueue::numJobsInQueue()
 {
   std::unique_lock<std::mutex> lock{_mu};
@@ -66,6 +66,11 @@ public:
    * @brief Flag as terminating so all the worker threads can terminate
    */
   void finish();
+  /**
+   * @brief Block until the job queue is empty and no worker thread is running a job. Worker
+   *        threads keep alive so that they can be reused for the next jobs
+   */
+  void join();
   /**
    * @brief Check if it has pending jobs. Even if this returns fals, WorkQueue threads may be still
    * running
@@ -77,8 +82,10 @@ public:
 private:
   State _state{State::ONLINE};
   std::queue<std::unique_ptr<IFunction>> _functions;
+  uint32_t _num_running_jobs{0};
   std::mutex _mu;
   std::condition_variable _cv;
+  std::condition_variable _cv_idle;
 };
 
 } // namespace exec
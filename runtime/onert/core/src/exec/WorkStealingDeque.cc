@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkStealingDeque.h"
+
+#include <cassert>
+
+namespace onert
+{
+namespace exec
+{
+
+namespace
+{
+
+uint32_t roundUpToPowerOf2(uint32_t value)
+{
+  uint32_t ret = 1;
+  while (ret < value)
+  {
+    ret <<= 1;
+  }
+  return ret;
+}
+
+} // namespace
+
+WorkStealingDeque::WorkStealingDeque(uint32_t capacity)
+    : _buffer(roundUpToPowerOf2(capacity)), _mask{static_cast<int64_t>(_buffer.size()) - 1}
+{
+}
+
+void WorkStealingDeque::push(uint32_t job)
+{
+  auto b = _bottom.load(std::memory_order_relaxed);
+  assert(b - _top.load(std::memory_order_acquire) < static_cast<int64_t>(_buffer.size()));
+  _buffer[b & _mask].store(job, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  _bottom.store(b + 1, std::memory_order_relaxed);
+}
+
+bool WorkStealingDeque::pop(uint32_t &job)
+{
+  auto b = _bottom.load(std::memory_order_relaxed) - 1;
+  _bottom.store(b, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto t = _top.load(std::memory_order_relaxed);
+
+  if (t > b)
+  {
+    // Empty
+    _bottom.store(b + 1, std::memory_order_relaxed);
+    return false;
+  }
+
+  job = _buffer[b & _mask].load(std::memory_order_relaxed);
+  if (t == b)
+  {
+    // The last job, race against thieves
+    bool won = _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                            std::memory_order_relaxed);
+    _bottom.store(b + 1, std::memory_order_relaxed);
+    return won;
+  }
+  return true;
+}
+
+bool WorkStealingDeque::steal(uint32_t &job)
+{
+  auto t = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto b = _bottom.load(std::memory_order_acquire);
+
+  if (t >= b)
+  {
+    // Empty
+    return false;
+  }
+
+  job = _buffer[t & _mask].load(std::memory_order_relaxed);
+  return _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed);
+}
+
+} // namespace exec
+} // namespace onert
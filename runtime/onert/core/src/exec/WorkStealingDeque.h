@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WORK_STEALING_DEQUE_H__
+#define __ONERT_EXEC_WORK_STEALING_DEQUE_H__
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Lock-free work-stealing deque of job indices (Chase-Lev)
+ *
+ *        The owner thread pushes and pops at the bottom, and other threads steal from the top.
+ *        The buffer does not grow, so its capacity must be enough to hold all the jobs that can
+ *        be in the deque at the same time.
+ */
+class WorkStealingDeque
+{
+public:
+  /**
+   * @brief Construct WorkStealingDeque object
+   *
+   * @param capacity Maximum number of jobs in the deque. It is rounded up to a power of 2
+   */
+  WorkStealingDeque(uint32_t capacity);
+
+public:
+  /**
+   * @brief Push a job at the bottom. Only the owner thread can call this
+   *
+   * @param job Job index
+   */
+  void push(uint32_t job);
+  /**
+   * @brief Pop a job from the bottom. Only the owner thread can call this
+   *
+   * @param[out] job Job index popped
+   * @return @c true if a job is popped, otherwise @c false
+   */
+  bool pop(uint32_t &job);
+  /**
+   * @brief Steal a job from the top. Any thread can call this
+   *
+   * @param[out] job Job index stolen
+   * @return @c true if a job is stolen, otherwise @c false
+   */
+  bool steal(uint32_t &job);
+
+private:
+  std::atomic<int64_t> _top{0};
+  std::atomic<int64_t> _bottom{0};
+  std::vector<std::atomic<uint32_t>> _buffer;
+  int64_t _mask;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WORK_STEALING_DEQUE_H__
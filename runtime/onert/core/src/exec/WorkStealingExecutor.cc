@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WorkStealingExecutor.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "util/logging.h"
+
+namespace onert
+{
+namespace exec
+{
+
+WorkStealingExecutor::WorkStealingExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
+                                           const backend::TensorBuilderSet &tensor_builders,
+                                           compiler::CodeMap &&code_map, uint32_t num_threads)
+    : DataflowExecutor{std::move(lowered_graph), tensor_builders, std::move(code_map)}
+{
+  VERBOSE(WorkStealingExecutor) << "Constructing WorkStealing Executor" << std::endl;
+
+  if (num_threads == 0)
+  {
+    num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  // Resolve everything needed to run a job once, so that running a job needs no lookup
+  const auto num_jobs = static_cast<uint32_t>(_finished_jobs.size());
+  _jobs.resize(num_jobs);
+  for (uint32_t i = 0; i < num_jobs; ++i)
+  {
+    assert(_finished_jobs[i]->index() == i);
+    auto op_seq_index = _job_to_op_seq.at(i);
+    auto &info = _jobs[i];
+    info.fn = _finished_jobs[i]->fn();
+    info.op_seq = &_lowered_graph->op_seqs().at(op_seq_index);
+    info.backend = _lowered_graph->getLowerInfo()->op_seq.at(op_seq_index)->backend();
+    info.backend_mutex = nullptr;
+    if (!info.backend->config()->supportConcurrentExecution())
+    {
+      auto &mutex = _backend_mutexes[info.backend];
+      if (!mutex)
+      {
+        mutex = std::make_unique<std::mutex>();
+      }
+      info.backend_mutex = mutex.get();
+    }
+    info.successors.assign(_output_info[i].begin(), _output_info[i].end());
+  }
+  _dep_counters.reset(new std::atomic<uint32_t>[num_jobs]);
+
+  for (uint32_t i = 0; i < num_threads; ++i)
+  {
+    _deques.emplace_back(std::make_unique<WorkStealingDeque>(num_jobs));
+  }
+
+  // The caller thread is the worker 0
+  for (uint32_t i = 1; i < num_threads; ++i)
+  {
+    _threads.emplace_back([this, i] { workerLoop(i); });
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor()
+{
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    _terminate = true;
+  }
+  _cv_start.notify_all();
+  for (auto &thread : _threads)
+  {
+    thread.join();
+  }
+}
+
+void WorkStealingExecutor::workerLoop(uint32_t worker_id)
+{
+  uint64_t generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock{_mu};
+      _cv_start.wait(lock, [&] { return _terminate || _generation != generation; });
+      if (_terminate)
+      {
+        return;
+      }
+      generation = _generation;
+    }
+
+    runJobs(worker_id);
+
+    bool all_done = false;
+    {
+      std::unique_lock<std::mutex> lock{_mu};
+      all_done = (--_num_running_workers == 0);
+    }
+    if (all_done)
+    {
+      _cv_done.notify_one();
+    }
+  }
+}
+
+bool WorkStealingExecutor::stealJob(uint32_t worker_id, uint32_t &job_index)
+{
+  const auto num_workers = static_cast<uint32_t>(_deques.size());
+  for (uint32_t i = 1; i < num_workers; ++i)
+  {
+    if (_deques[(worker_id + i) % num_workers]->steal(job_index))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingExecutor::notifyWork()
+{
+  _work_epoch.fetch_add(1);
+  if (_num_parked.load() > 0)
+  {
+    // Taking the lock makes sure that a parking worker is either waiting or sees the new epoch
+    std::lock_guard<std::mutex> lock{_mu_work};
+    _cv_work.notify_all();
+  }
+}
+
+void WorkStealingExecutor::runJobs(uint32_t worker_id)
+{
+  // Number of failed attempts to find a job before an idle worker is parked
+  constexpr uint32_t kMaxSpins = 64;
+
+  auto &deque = *_deques[worker_id];
+  uint32_t job_index;
+  uint32_t num_spins = 0;
+  while (true)
+  {
+    // Read the epoch before looking for a job, so that a job pushed after that is not missed
+    const auto epoch = _work_epoch.load();
+    if (_remaining_jobs.load(std::memory_order_acquire) == 0 ||
+        _aborted.load(std::memory_order_relaxed))
+    {
+      break;
+    }
+
+    if (deque.pop(job_index) || stealJob(worker_id, job_index))
+    {
+      num_spins = 0;
+      runJob(worker_id, job_index);
+    }
+    else if (++num_spins < kMaxSpins)
+    {
+      std::this_thread::yield();
+    }
+    else
+    {
+      // Park until a job becomes ready or the execution ends
+      std::unique_lock<std::mutex> lock{_mu_work};
+      _num_parked.fetch_add(1);
+      _cv_work.wait(lock, [&] { return _work_epoch.load() != epoch; });
+      _num_parked.fetch_sub(1);
+      num_spins = 0;
+    }
+  }
+}
+
+void WorkStealingExecutor::runJob(uint32_t worker_id, uint32_t job_index)
+{
+  const auto &job = _jobs[job_index];
+
+  // Kernels of a backend that is not thread-safe run one at a time
+  std::unique_lock<std::mutex> backend_lock;
+  if (job.backend_mutex != nullptr)
+  {
+    backend_lock = std::unique_lock<std::mutex>{*job.backend_mutex};
+  }
+
+  _subject.notifyJobBegin(this, job.op_seq, job.backend);
+  try
+  {
+    job.fn->run();
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock{_mu_error};
+    if (!_error)
+    {
+      _error = std::current_exception();
+    }
+    _aborted.store(true, std::memory_order_relaxed);
+    notifyWork();
+    return;
+  }
+  _subject.notifyJobEnd(this, job.op_seq, job.backend);
+  if (backend_lock)
+  {
+    backend_lock.unlock();
+  }
+
+  bool pushed = false;
+  for (auto successor : job.successors)
+  {
+    // The last predecessor makes the successor ready
+    if (_dep_counters[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      _deques[worker_id]->push(successor);
+      pushed = true;
+    }
+  }
+  // The last job ends the execution, which wakes up the parked workers as well
+  if (_remaining_jobs.fetch_sub(1, std::memory_order_release) == 1 || pushed)
+  {
+    notifyWork();
+  }
+}
+
+void WorkStealingExecutor::executeImpl()
+{
+  const auto num_jobs = static_cast<uint32_t>(_jobs.size());
+  const auto num_workers = static_cast<uint32_t>(_deques.size());
+
+  // Execution setup. Worker threads are waiting, so the deques can be filled from here
+  uint32_t num_initial_jobs = 0;
+  for (uint32_t i = 0; i < num_jobs; ++i)
+  {
+    _dep_counters[i].store(_initial_input_info[i], std::memory_order_relaxed);
+    if (_initial_input_info[i] == 0)
+    {
+      _deques[num_initial_jobs++ % num_workers]->push(i);
+    }
+  }
+  assert(num_initial_jobs > 0); // Cannot begin if there is no initial jobs
+  _remaining_jobs.store(num_jobs, std::memory_order_relaxed);
+  _aborted.store(false, std::memory_order_relaxed);
+  _error = nullptr;
+
+  _subject.notifyModelBegin(this);
+
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    ++_generation;
+    _num_running_workers = static_cast<uint32_t>(_threads.size());
+  }
+  _cv_start.notify_all();
+
+  runJobs(0);
+
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    _cv_done.wait(lock, [this] { return _num_running_workers == 0; });
+  }
+
+  if (_error)
+  {
+    // Drop the jobs left by the aborted execution
+    uint32_t job_index;
+    for (auto &deque : _deques)
+    {
+      while (deque->pop(job_index))
+        ;
+    }
+    std::rethrow_exception(_error);
+  }
+
+  _subject.notifyModelEnd(this);
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_WORK_STEALING_EXECUTOR_H__
+#define __ONERT_EXEC_WORK_STEALING_EXECUTOR_H__
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "exec/DataflowExecutor.h"
+#include "WorkStealingDeque.h"
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to execute Graph in parallel with work-stealing worker threads
+ *
+ *        Each worker has its own deque of ready jobs. A worker pushes the jobs that become ready
+ *        by its own job, and steals from the other workers when its deque is empty. Dependencies
+ *        are tracked with atomic counters, so no lock is taken while jobs are running.
+ *        The caller thread works as the first worker and worker threads are kept alive between
+ *        executions.
+ * @note  Jobs may run on any worker regardless of their backend. Kernels of a backend that does
+ *        not support concurrent execution are serialized with a lock of the backend
+ */
+class WorkStealingExecutor : public DataflowExecutor
+{
+public:
+  /**
+   * @brief Constructs a WorkStealingExecutor object
+   *
+   * @param lowered_graph LoweredGraph object
+   * @param tensor_builders Tensor builders that are currently used
+   * @param code_map OpSequence and its code map
+   * @param num_threads Number of workers including the caller thread. 0 means the number of cores
+   */
+  WorkStealingExecutor(std::unique_ptr<ir::LoweredGraph> lowered_graph,
+                       const backend::TensorBuilderSet &tensor_builders,
+                       compiler::CodeMap &&code_map, uint32_t num_threads);
+  ~WorkStealingExecutor() override;
+
+  void executeImpl() override;
+
+private:
+  void workerLoop(uint32_t worker_id);
+  void runJobs(uint32_t worker_id);
+  bool stealJob(uint32_t worker_id, uint32_t &job_index);
+  void runJob(uint32_t worker_id, uint32_t job_index);
+  void notifyWork();
+
+private:
+  struct JobInfo
+  {
+    IFunction *fn;
+    const ir::OpSequence *op_seq;
+    const backend::Backend *backend;
+    std::mutex *backend_mutex; // nullptr if kernels of the backend can run concurrently
+    std::vector<uint32_t> successors;
+  };
+
+  std::vector<JobInfo> _jobs;
+  std::unordered_map<const backend::Backend *, std::unique_ptr<std::mutex>> _backend_mutexes;
+  std::unique_ptr<std::atomic<uint32_t>[]> _dep_counters;
+  std::vector<std::unique_ptr<WorkStealingDeque>> _deques;
+  std::atomic<uint32_t> _remaining_jobs{0};
+  std::atomic<bool> _aborted{false};
+  std::exception_ptr _error;
+  std::mutex _mu_error;
+
+  // Idle workers control. The epoch is increased whenever jobs are pushed or the execution ends
+  std::atomic<uint64_t> _work_epoch{0};
+  std::atomic<uint32_t> _num_parked{0};
+  std::mutex _mu_work;
+  std::condition_variable _cv_work;
+
+  // Worker threads control
+  std::vector<std::thread> _threads;
+  std::mutex _mu;
+  std::condition_variable _cv_start;
+  std::condition_variable _cv_done;
+  uint64_t _generation{0};
+  uint32_t _num_running_workers{0};
+  bool _terminate{false};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_WORK_STEALING_EXECUTOR_H__
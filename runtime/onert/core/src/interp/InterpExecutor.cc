@@ -27,6 +27,19 @@ namespace onert
 namespace interp
 {
 
+bool InterpExecutor::isSupported(ir::OpCode opcode)
+{
+  switch (opcode)
+  {
+#define INTERP_OP(InternalName) case ir::OpCode::InternalName:
+#include "InterpOps.lst"
+#undef INTERP_OP
+      return true;
+    default:
+      return false;
+  }
+}
+
 void InterpExecutor::execute(const exec::IODescription &desc)
 {
   /************************************************************************
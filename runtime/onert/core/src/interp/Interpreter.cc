@@ -17,6 +17,7 @@
 #include "Interpreter.h"
 
 #include <stack>
+#include <stdexcept>
 #include <unordered_set>
 
 #include "Registration.h"
@@ -52,11 +53,16 @@ public:
                          << " operation (id: " << idx.value() << ")" << std::endl;
 
     const auto nodeOpCode = node.opcode();
-    if (_kernels[nodeOpCode]->prepare != nullptr)
+    auto kernel = _kernels.find(nodeOpCode);
+    if (kernel == _kernels.end() || kernel->second == nullptr)
     {
-      _kernels[nodeOpCode]->prepare(_env, node);
+      throw std::runtime_error{"Interpreter: NYI for operation " + nodeName};
     }
-    _kernels[nodeOpCode]->invoke(_env, node);
+    if (kernel->second->prepare != nullptr)
+    {
+      kernel->second->prepare(_env, node);
+    }
+    kernel->second->invoke(_env, node);
   }
 
 private:
@@ -23,10 +23,12 @@
 #include "pass/ConstantLoweringPass.h"
 #include "pass/PermutationOperationPass.h"
 #include "pass/PermutationInsertionPass.h"
+#include "pass/SeparableConv2DFusionPass.h"
 #include "ir/GraphIterator.h"
 #include "verifier/Verifier.h"
 #include "backend/Backend.h"
 #include "backend/IConfig.h"
+#include "compiler/BackendManager.h"
 #include "compiler/BackendResolver.h"
 #include "compiler/ManualScheduler.h"
 #include "compiler/HEScheduler.h"
@@ -37,14 +39,15 @@ namespace onert
 namespace ir
 {
 
-LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &options)
+LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &options,
+                           const compiler::CompiledArtifact::Schedule *schedule)
     : _graph{graph}
 {
   // Build backend contexts
+  // NOTE Backends are loaded by Compiler beforehand, as subgraphs may be lowered concurrently
   auto &backend_manager = compiler::BackendManager::get();
   for (auto backend_str : options.backend_list)
   {
-    backend_manager.loadBackend(backend_str);
     auto backend = backend_manager.get(backend_str);
 
     // TODO As the default value of backend list contains "cpu", "acl_cl" and "acl_neon", and some
@@ -64,7 +67,11 @@ LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &
 
   // TODO Move "schedule" phase out of here
   // Schedule
-  if (options.he_scheduler)
+  if (schedule != nullptr && applySchedule(*schedule))
+  {
+    VERBOSE(LoweredGraph) << "Use backend assignment of the compiled artifact" << std::endl;
+  }
+  else if (options.he_scheduler)
   {
     auto scheduler = compiler::HEScheduler(_backend_contexts, options);
     _backend_resolver = scheduler.schedule(_graph);
@@ -76,6 +83,19 @@ LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &
     _backend_resolver = scheduler.schedule(_graph);
   }
 
+  // Keep the assignment to save before passes below change operations
+  _backend_resolver->iterate([&](const OperationIndex &index, const backend::Backend &backend) {
+    _schedule.backends[index] = backend.config()->id();
+    _schedule.opcodes[index] = _graph.operations().at(index).opcode();
+  });
+  _schedule.indexed_ranks = _indexed_ranks;
+
+  // Fuse operations on the same backend before making op sequences
+  {
+    pass::SeparableConv2DFusionPass sc_pass(_graph, *_backend_resolver);
+    sc_pass.run();
+  }
+
   {
     // operand::LowerInfo holder
     OperandIndexMap<std::unique_ptr<operand::LowerInfo>> operands_lower_info;
@@ -136,6 +156,48 @@ LoweredGraph::LoweredGraph(const Graph &graph, const compiler::CompilerOptions &
   }
 }
 
+bool LoweredGraph::applySchedule(const compiler::CompiledArtifact::Schedule &schedule)
+{
+  auto backend_resolver = std::make_unique<compiler::BackendResolver>();
+  bool applicable = true;
+  size_t num_operations = 0;
+  _graph.operations().iterate([&](const OperationIndex &index, const Operation &operation) {
+    ++num_operations;
+    if (!applicable)
+      return;
+
+    // The operation must be of the same kind as the one the schedule was made for
+    auto it = schedule.backends.find(index);
+    auto opcode_it = schedule.opcodes.find(index);
+    if (it == schedule.backends.end() || opcode_it == schedule.opcodes.end() ||
+        opcode_it->second != operation.opcode())
+    {
+      applicable = false;
+      return;
+    }
+
+    // The backend may be unavailable on this platform
+    const auto backend = compiler::BackendManager::get().get(it->second);
+    if (backend == nullptr || _backend_contexts.find(backend) == _backend_contexts.end())
+    {
+      applicable = false;
+      return;
+    }
+    backend_resolver->setBackend(index, backend);
+  });
+
+  if (!applicable || num_operations != schedule.backends.size())
+  {
+    VERBOSE(LoweredGraph) << "Backend assignment of the compiled artifact does not fit"
+                          << std::endl;
+    return false;
+  }
+
+  _backend_resolver = std::move(backend_resolver);
+  _indexed_ranks = schedule.indexed_ranks;
+  return true;
+}
+
 const operation::LowerInfo *LoweredGraph::getLowerInfo(const OpSequenceIndex &op_seq_index) const
 {
   auto itr = _lower_info_map.op_seq.find(op_seq_index);
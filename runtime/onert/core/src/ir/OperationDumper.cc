@@ -587,6 +587,22 @@ void OperationDumper::visit(const Select &node)
   VERBOSE(LIR) << "  - Output : Output(" << node.getOutputs().at(0) << ")" << std::endl;
 }
 
+void OperationDumper::visit(const SeparableConv2D &node)
+{
+  std::string padding_type =
+      node.param().padding.type == PaddingType::EXPLICIT ? "Explicit" : "Implicit";
+  VERBOSE(LIR) << "* SeparableConv2D(" << padding_type << ")" << std::endl;
+  VERBOSE(LIR) << "  - Inputs : IFM(" << node.getInputs().at(SeparableConv2D::Input::INPUT)
+               << ") Depthwise Kernel("
+               << node.getInputs().at(SeparableConv2D::Input::DEPTHWISE_KERNEL)
+               << ") Depthwise Bias(" << node.getInputs().at(SeparableConv2D::Input::DEPTHWISE_BIAS)
+               << ") Pointwise Kernel("
+               << node.getInputs().at(SeparableConv2D::Input::POINTWISE_KERNEL)
+               << ") Pointwise Bias(" << node.getInputs().at(SeparableConv2D::Input::POINTWISE_BIAS)
+               << ")" << std::endl;
+  VERBOSE(LIR) << "  - Output : OFM(" << node.getOutputs().at(0) << ")" << std::endl;
+}
+
 void OperationDumper::visit(const ir::operation::Shape &node)
 {
   VERBOSE(LIR) << "* Shape" << std::endl;
@@ -90,6 +90,7 @@ public:
   void visit(const operation::Round &) override;
   void visit(const operation::RSQRT &) override;
   void visit(const operation::Select &node) override;
+  void visit(const operation::SeparableConv2D &node) override;
   void visit(const operation::Shape &node) override;
   void visit(const operation::Sin &node) override;
   void visit(const operation::Softmax &node) override;
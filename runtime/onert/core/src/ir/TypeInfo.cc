@@ -38,6 +38,12 @@ bool operator==(const TypeInfo &lhs, const TypeInfo &rhs)
     return false;
   }
 
+  if (lhs.scales() != rhs.scales() || lhs.offsets() != rhs.offsets() ||
+      lhs.quantized_dimension() != rhs.quantized_dimension())
+  {
+    return false;
+  }
+
   return true;
 }
 
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SeparableConv2DFusionPass.h"
+
+#include "backend/Backend.h"
+#include "backend/IConfig.h"
+#include "ir/Graph.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/SeparableConv2D.h"
+#include "util/logging.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace ir
+{
+namespace pass
+{
+
+namespace
+{
+
+bool isFloatConstant(const Operand &operand)
+{
+  return operand.isConstant() && operand.typeInfo().type() == DataType::FLOAT32;
+}
+
+bool isStaticFloatFeature(const Operand &operand)
+{
+  return !operand.info().isDynamic() && operand.typeInfo().type() == DataType::FLOAT32 &&
+         operand.shape().rank() == 4;
+}
+
+} // namespace
+
+void SeparableConv2DFusionPass::run()
+{
+  std::vector<std::pair<OperationIndex, OperationIndex>> candidates;
+  _graph.operations().iterate([&](const OperationIndex &index, const Operation &node) {
+    if (node.opcode() != OpCode::DepthwiseConv2D)
+      return;
+
+    const auto pw_index = findPointwise(index);
+    if (pw_index.valid())
+      candidates.emplace_back(index, pw_index);
+  });
+
+  for (const auto &candidate : candidates)
+  {
+    fuse(candidate.first, candidate.second);
+  }
+}
+
+OperationIndex SeparableConv2DFusionPass::findPointwise(const OperationIndex &dw_index) const
+{
+  const auto &dw = _graph.operations().at(dw_index);
+  if (_backend_resolver.getBackend(dw_index)->config()->id() != "cpu")
+    return OperationIndex{};
+
+  using operation::DepthwiseConv2D;
+  const auto &ifm = _graph.operands().at(dw.getInputs().at(DepthwiseConv2D::Input::INPUT));
+  const auto &dw_ker = _graph.operands().at(dw.getInputs().at(DepthwiseConv2D::Input::KERNEL));
+  const auto &dw_bias = _graph.operands().at(dw.getInputs().at(DepthwiseConv2D::Input::BIAS));
+  const auto dw_ofm_index = dw.getOutputs().at(0);
+  const auto &dw_ofm = _graph.operands().at(dw_ofm_index);
+  if (!isStaticFloatFeature(ifm) || !isStaticFloatFeature(dw_ofm) || !isFloatConstant(dw_ker) ||
+      !isFloatConstant(dw_bias))
+    return OperationIndex{};
+
+  // The depthwise result is not kept anywhere after fusion
+  if (dw_ofm.getUses().size() != 1 || _graph.getOutputs().contains(dw_ofm_index))
+    return OperationIndex{};
+
+  const auto pw_index = *dw_ofm.getUses().begin();
+  const auto &pw_node = _graph.operations().at(pw_index);
+  if (pw_node.opcode() != OpCode::Conv2D ||
+      _backend_resolver.getBackend(pw_index)->config()->id() != "cpu")
+    return OperationIndex{};
+
+  using operation::Conv2D;
+  const auto &pw = static_cast<const Conv2D &>(pw_node);
+  if (pw.getInputs().at(Conv2D::Input::INPUT) != dw_ofm_index)
+    return OperationIndex{};
+
+  const auto &pw_ker = _graph.operands().at(pw.getInputs().at(Conv2D::Input::KERNEL));
+  const auto &pw_bias = _graph.operands().at(pw.getInputs().at(Conv2D::Input::BIAS));
+  const auto &ofm = _graph.operands().at(pw.getOutputs().at(0));
+  if (!isStaticFloatFeature(ofm) || !isFloatConstant(pw_ker) || !isFloatConstant(pw_bias))
+    return OperationIndex{};
+
+  // Only 1x1 kernel with unit stride and no padding, whose output has the same height and width
+  const auto &pw_param = pw.param();
+  const auto &pw_ker_shape = pw_ker.shape();
+  if (pw_ker_shape.rank() != 4 || pw_ker_shape.dim(1) != 1 || pw_ker_shape.dim(2) != 1)
+    return OperationIndex{};
+  if (pw_param.stride.vertical != 1 || pw_param.stride.horizontal != 1)
+    return OperationIndex{};
+  if (pw_param.padding.type == PaddingType::EXPLICIT)
+  {
+    const auto &pad = pw_param.padding.param;
+    if (pad.left != 0 || pad.right != 0 || pad.top != 0 || pad.bottom != 0)
+      return OperationIndex{};
+  }
+
+  return pw_index;
+}
+
+void SeparableConv2DFusionPass::fuse(const OperationIndex &dw_index,
+                                     const OperationIndex &pw_index)
+{
+  using operation::Conv2D;
+  using operation::DepthwiseConv2D;
+  using operation::SeparableConv2D;
+
+  const auto &dw = static_cast<const DepthwiseConv2D &>(_graph.operations().at(dw_index));
+  const auto &pw = static_cast<const Conv2D &>(_graph.operations().at(pw_index));
+
+  const auto dw_ofm_index = dw.getOutputs().at(0);
+  const auto ofm_index = pw.getOutputs().at(0);
+  const OperandIndexSequence inputs{dw.getInputs().at(DepthwiseConv2D::Input::INPUT),
+                                    dw.getInputs().at(DepthwiseConv2D::Input::KERNEL),
+                                    dw.getInputs().at(DepthwiseConv2D::Input::BIAS),
+                                    pw.getInputs().at(Conv2D::Input::KERNEL),
+                                    pw.getInputs().at(Conv2D::Input::BIAS)};
+  const OperandIndexSequence outputs{ofm_index};
+
+  SeparableConv2D::Param param;
+  param.stride = dw.param().stride;
+  param.padding = dw.param().padding;
+  param.multiplier = dw.param().multiplier;
+  param.depthwise_activation = dw.param().activation;
+  param.activation = pw.param().activation;
+
+  const auto backend = _backend_resolver.getBackend(pw_index);
+  const auto fused_index =
+      _graph.operations().push(std::make_unique<SeparableConv2D>(inputs, outputs, param));
+  _backend_resolver.setBackend(fused_index, backend);
+
+  VERBOSE(SeparableConv2DFusionPass) << "Fuse DepthwiseConv2D(#" << dw_index.value()
+                                     << ") and Conv2D(#" << pw_index.value()
+                                     << ") into SeparableConv2D(#" << fused_index.value() << ")"
+                                     << std::endl;
+
+  // Update use-def of operands
+  for (const auto &input : dw.getInputs() | Remove::DUPLICATED)
+  {
+    _graph.operands().at(input).removeUse(dw_index);
+  }
+  for (const auto &input : pw.getInputs() | Remove::DUPLICATED)
+  {
+    _graph.operands().at(input).removeUse(pw_index);
+  }
+  for (const auto &input : inputs | Remove::DUPLICATED)
+  {
+    _graph.operands().at(input).insertUse(fused_index);
+  }
+  auto &ofm = _graph.operands().at(ofm_index);
+  ofm.removeDef(pw_index);
+  ofm.insertDef(fused_index);
+
+  _graph.operations().remove(dw_index);
+  _graph.operations().remove(pw_index);
+  _graph.removeOperand(dw_ofm_index);
+  _backend_resolver.removeBackend(dw_index);
+  _backend_resolver.removeBackend(pw_index);
+}
+
+} // namespace pass
+} // namespace ir
+} // namespace onert
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_GRAPH_PASS_SEPARABLE_CONV2D_FUSION_PASS_H__
+#define __ONERT_GRAPH_PASS_SEPARABLE_CONV2D_FUSION_PASS_H__
+
+#include "Pass.h"
+#include "compiler/BackendResolver.h"
+#include "ir/Index.h"
+
+namespace onert
+{
+namespace ir
+{
+namespace pass
+{
+
+/**
+ * @brief Fuse DepthwiseConv2D and the following 1x1 Conv2D into SeparableConv2D
+ *
+ * Only the pairs assigned to cpu backend are fused, since it is the only backend that implements
+ * SeparableConv2D. This must run after scheduling and before making op sequences.
+ */
+class SeparableConv2DFusionPass : public Pass
+{
+public:
+  SeparableConv2DFusionPass(Graph &graph, compiler::BackendResolver &backend_resolver)
+      : Pass{graph}, _backend_resolver{backend_resolver}
+  {
+    // DO NOTHING
+  }
+
+public:
+  std::string id() final { return "SeparableConv2DFusionPass"; }
+  void run() final;
+
+private:
+  /**
+   * @brief Find the pointwise Conv2D that can be fused with the given DepthwiseConv2D
+   * @return The index of the Conv2D, or an undefined index if there is none
+   */
+  OperationIndex findPointwise(const OperationIndex &dw_index) const;
+  void fuse(const OperationIndex &dw_index, const OperationIndex &pw_index);
+
+private:
+  compiler::BackendResolver &_backend_resolver;
+};
+
+} // namespace pass
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_GRAPH_PASS_SEPARABLE_CONV2D_FUSION_PASS_H__
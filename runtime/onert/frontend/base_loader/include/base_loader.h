@@ -24,8 +24,12 @@
 
 #include <map>
 #include <memory>
-#include <fstream>
 #include <limits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace onert
 {
@@ -55,7 +59,10 @@ public:
    *
    * @param graph reference on subgraphs
    */
-  explicit BaseLoader(std::unique_ptr<ir::Subgraphs> &subgs) : _subgraphs(subgs), _model{nullptr} {}
+  explicit BaseLoader(std::unique_ptr<ir::Subgraphs> &subgs)
+      : _base{nullptr}, _size{0}, _subgraphs(subgs), _model{nullptr}
+  {
+  }
 
   /**
    * @brief Load a model from file
@@ -156,8 +163,12 @@ protected:
   void loadRange(const Operator *op, ir::Graph &subg);
 
 protected:
-  // Buffer for loading (if needed)
-  std::vector<char> _buffer;
+  // Model file mapped with mmap, which constant operands refer to
+  std::shared_ptr<const uint8_t> _mapping;
+  // Base address of the mapping
+  const uint8_t *_base;
+  // Size of the model file
+  size_t _size;
   // Reference on loadable subgraphs
   std::unique_ptr<ir::Subgraphs> &_subgraphs;
   const Model *_model;
@@ -170,9 +181,8 @@ protected:
 template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::loadFromFile(const char *file_path)
 {
-  std::ifstream stream(file_path, std::fstream::in | std::fstream::binary);
-
-  if (!stream)
+  int fd = open(file_path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
   {
     std::string msg = "Failed to open file `";
     msg += file_path;
@@ -180,18 +190,29 @@ void BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::loadFromFile(const ch
     throw std::runtime_error{msg};
   }
 
-  stream.seekg(0, stream.end);
-  auto size = stream.tellg();
-  stream.seekg(0, stream.beg);
-
-  _buffer.resize(size);
-  stream.read(_buffer.data(), size);
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0)
+  {
+    close(fd);
+    throw std::runtime_error{"fstat failed"};
+  }
+  _size = file_stat.st_size;
 
-  stream.close();
+  // Map the whole file instead of reading it. The mapping outlives the file descriptor.
+  void *base = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED)
+  {
+    throw std::runtime_error{"mmap failed"};
+  }
+  const size_t size = _size;
+  _mapping = std::shared_ptr<const uint8_t>(
+      static_cast<const uint8_t *>(base),
+      [size](const uint8_t *ptr) { munmap(const_cast<uint8_t *>(ptr), size); });
+  _base = _mapping.get();
 
   // Prepare verifier
-  _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_buffer.data()),
-                                         _buffer.size());
+  _verifier = std::make_unique<Verifier>(_base, _size);
 
   loadModel();
 }
@@ -232,6 +253,8 @@ BaseLoader<LoaderDomain, SpecificLoader>::BaseLoader::tensorTypeToDataType(const
       return ir::DataType::BOOL8;
     case TensorType::TensorType_UINT8:
       return ir::DataType::QUANT_UINT8_ASYMM;
+    case TensorType::TensorType_INT8:
+      return ir::DataType::QUANT_INT8_ASYMM;
     default:
       throw std::runtime_error(
           std::string("Unsupported tensor type: ").append(EnumNameTensorType(type)));
@@ -275,36 +298,50 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   ir::DataType data_type = tensorTypeToDataType(tensor->type());
   // Quantization
   auto q_params = tensor->quantization();
-  float scale = 0.0;
-  long zero_point = 0;
+  std::vector<float> scales;
+  std::vector<int32_t> zero_points;
+  int32_t quantized_dimension = 0;
   if (q_params != nullptr)
   {
     if (q_params->scale())
     {
-      if (q_params->scale()->size() != 1)
-      {
-        throw std::runtime_error("Only 1 scale for a tensor is supported.");
-      }
-      scale = q_params->scale()->Get(0);
+      for (const auto scale : *q_params->scale())
+        scales.emplace_back(scale);
     }
 
     if (q_params->zero_point())
     {
-      if (q_params->zero_point()->size() != 1)
+      for (const auto zero_point : *q_params->zero_point())
       {
-        throw std::runtime_error("Only 1 zero_point value for a tensor is supported.");
+        // zero_point is long while TypeInfo.zero_point is defined as int32_t.
+        assert(zero_point >= std::numeric_limits<int32_t>::min());
+        assert(zero_point <= std::numeric_limits<int32_t>::max());
+        zero_points.emplace_back(zero_point);
       }
-      zero_point = q_params->zero_point()->Get(0);
-      // zero_point is long while TypeInfo.zero_point is defined as int32_t.
-      assert(zero_point >= std::numeric_limits<int32_t>::min());
-      assert(zero_point <= std::numeric_limits<int32_t>::max());
+    }
+
+    if (scales.size() > 1 || zero_points.size() > 1)
+    {
+      // Per-channel quantization : zero_points may be omitted or given per channel
+      if (zero_points.empty())
+        zero_points.resize(scales.size(), 0);
+      if (zero_points.size() != scales.size())
+        throw std::runtime_error("The number of scales and zero_points does not match.");
+      quantized_dimension = q_params->quantized_dimension();
+      if (quantized_dimension < 0 || quantized_dimension >= shape.rank() ||
+          shape.dim(quantized_dimension) != static_cast<int32_t>(scales.size()))
+        throw std::runtime_error("Invalid quantized_dimension for per-channel quantization.");
     }
     auto details = q_params->details_as_CustomQuantization();
     if (details != nullptr)
       throw std::runtime_error("Custom Quantization is not supported");
   }
   // Create TypeInfo
-  ir::TypeInfo type_info(data_type, scale, zero_point);
+  const bool per_channel = scales.size() > 1;
+  ir::TypeInfo type_info =
+      per_channel ? ir::TypeInfo(data_type, scales, zero_points, quantized_dimension)
+                  : ir::TypeInfo(data_type, scales.empty() ? 0.0f : scales[0],
+                                 zero_points.empty() ? 0 : zero_points[0]);
   // Create operand
   const auto operand_index = subg.addOperand(shape, type_info);
 
@@ -312,8 +349,19 @@ ir::OperandIndex BaseLoader<LoaderDomain, SpecificLoader>::loadOperand(const Ten
   const auto *data = _model->buffers()->Get(tensor->buffer())->data();
   if (data != nullptr)
   {
-    auto ptr = std::make_unique<ir::CachedData>(data->data(), data->size());
-    subg.setOperandValue(operand_index, std::move(ptr));
+    // Refer to the mapped file instead of copying the data, unless it is not aligned to the
+    // element size as kernels read elements of constants directly
+    const size_t data_offset = data->data() - _base;
+    if (data_offset % ir::sizeOfDataType(data_type) == 0)
+    {
+      subg.setOperandValue(operand_index,
+                           std::make_unique<ir::MMapedData>(_mapping, data_offset, data->size()));
+    }
+    else
+    {
+      subg.setOperandValue(operand_index,
+                           std::make_unique<ir::CachedData>(data->data(), data->size()));
+    }
   }
 
   // Name unused
@@ -564,7 +612,8 @@ void BaseLoader<LoaderDomain, SpecificLoader>::loadFC(const Operator *op, ir::Gr
   const auto &input_operand = subg.operands().at(inputs.at(ir::operation::FullyConnected::INPUT));
   auto &weights_operand = subg.operands().at(inputs.at(ir::operation::FullyConnected::WEIGHT));
   if (input_operand.typeInfo().type() == ir::DataType::FLOAT32 &&
-      weights_operand.typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM)
+      (weights_operand.typeInfo().type() == ir::DataType::QUANT_UINT8_ASYMM ||
+       weights_operand.typeInfo().type() == ir::DataType::QUANT_INT8_ASYMM))
   {
     weights_operand.type(ir::DataType::QUANT_INT8_SYMM);
   }
@@ -1809,7 +1858,7 @@ template <typename LoaderDomain, typename SpecificLoader>
 void BaseLoader<LoaderDomain, SpecificLoader>::loadModel()
 {
   LoaderDomain::VerifyModelBuffer(*_verifier.get());
-  _model = LoaderDomain::GetModel(_buffer.data());
+  _model = LoaderDomain::GetModel(_base);
   // Version unused
   // const auto version = _model->version();
   // Description unused
@@ -63,7 +63,9 @@ int ANeuralNetworksExecution_create(ANeuralNetworksCompilation *compilation,
 //    Optional but not omitted input on execution: cannot handle
 //    Normal input on execution: cannot handle
 //  Fully specified shape on model build
-//    Optional input on execution: cannot handle
+//    Optional and omitted input on execution: skip input setting if all operations using it can
+//                                             omit it (e.g. input gate of CIFG LSTM)
+//    Omitted input which is not optional: cannot handle
 //    Normal input: handle normally
 int ANeuralNetworksExecution_setInput(ANeuralNetworksExecution *execution, int32_t index,
                                       const ANeuralNetworksOperandType *type, const void *buffer,
@@ -93,10 +95,11 @@ int ANeuralNetworksExecution_setInput(ANeuralNetworksExecution *execution, int32
   }
 
   // Omitted optional input
-  // LSTM operation's some inputs can be optional input
+  // LSTM operation's some inputs can be optional input, and CIFG LSTM may declare its input gate
+  // operands with fully-specified shape although they are omitted
   if ((buffer == nullptr) && (length == 0))
   {
-    if (execution->haveUnspecifiedDims(operand_index))
+    if (execution->haveUnspecifiedDims(operand_index) || execution->isOptionalInput(operand_index))
     {
       return ANEURALNETWORKS_NO_ERROR;
     }
@@ -17,6 +17,9 @@
 #include "ANeuralNetworksExecution.h"
 #include "NNAPIConvert.h"
 #include "util/logging.h"
+#include "ir/operation/LSTM.h"
+
+#include <algorithm>
 
 const onert::ir::OperandIndex ANeuralNetworksExecution::getInputOperandIndex(int32_t index) noexcept
 {
@@ -105,6 +108,55 @@ bool ANeuralNetworksExecution::haveUnspecifiedDims(const onert::ir::OperandIndex
   return onert::ir::haveUnspecifiedDims(operand_shape);
 }
 
+bool ANeuralNetworksExecution::isOptionalInput(const onert::ir::OperandIndex index) noexcept
+{
+  using onert::ir::operation::LSTM;
+  // Inputs of LSTM for CIFG, peephole and projection, which are omitted when not used
+  static const LSTM::Input lstm_optional_inputs[] = {
+      LSTM::INPUT_TO_INPUT_WEIGHTS, LSTM::RECURRENT_TO_INPUT_WEIGHTS,
+      LSTM::CELL_TO_INPUT_WEIGHTS,  LSTM::CELL_TO_FORGET_WEIGHTS,
+      LSTM::CELL_TO_OUTPUT_WEIGHTS, LSTM::INPUT_GATE_BIAS,
+      LSTM::PROJECTION_WEIGHTS,     LSTM::PROJECTION_BIAS};
+
+  try
+  {
+    const auto &graph = _execution->primary_subgraph();
+    const auto &uses = graph.operands().at(index).getUses();
+    if (uses.size() == 0)
+    {
+      return false;
+    }
+
+    for (const auto &use : uses)
+    {
+      const auto &operation = graph.operations().at(use);
+      if (operation.opcode() != onert::ir::OpCode::LSTM)
+      {
+        return false;
+      }
+
+      const auto &inputs = operation.getInputs();
+      for (uint32_t n = 0; n < inputs.size(); ++n)
+      {
+        if (inputs.at(n) == index &&
+            std::find(std::begin(lstm_optional_inputs), std::end(lstm_optional_inputs),
+                      static_cast<LSTM::Input>(n)) == std::end(lstm_optional_inputs))
+        {
+          return false;
+        }
+      }
+    }
+  }
+  catch (const std::exception &e)
+  {
+    VERBOSE(EXCEPTION) << e.what() << std::endl;
+
+    return false;
+  }
+
+  return true;
+}
+
 size_t ANeuralNetworksExecution::getOperandSize(const onert::ir::OperandIndex index) noexcept
 {
   try
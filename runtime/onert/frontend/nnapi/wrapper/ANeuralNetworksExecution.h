@@ -47,6 +47,12 @@ public:
   bool compareShape(const ANeuralNetworksOperandType *type,
                     const onert::ir::OperandIndex index) noexcept;
   bool haveUnspecifiedDims(const onert::ir::OperandIndex index) noexcept;
+  /**
+   * @brief       Check if an operand is used only as optional inputs of operations
+   * @param[in]   index Operand index
+   * @return      @c true if every operation using the operand can omit it, otherwise @c false
+   */
+  bool isOptionalInput(const onert::ir::OperandIndex index) noexcept;
   size_t getOperandSize(const onert::ir::OperandIndex index) noexcept;
   const std::shared_ptr<onert::exec::Execution> instance(void) noexcept;
 
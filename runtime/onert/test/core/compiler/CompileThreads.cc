@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/Compiler.h"
+#include "exec/Execution.h"
+#include "exec/ExecutionObservers.h"
+#include "exec/ExecutorBase.h"
+#include "ir/Graph.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/Comparison.h"
+#include "ir/operation/Mul.h"
+#include "ir/operation/While.h"
+
+#include <chrono>
+#include <mutex>
+
+namespace
+{
+
+using namespace onert::ir;
+
+const SubgraphIndex kMainIndex{0};
+const SubgraphIndex kCondIndex{1};
+const SubgraphIndex kBodyIndex{2};
+
+const Shape kShape{2, 2};
+const TypeInfo kFloat{DataType::FLOAT32};
+
+// Records the operations and the backend of each operation sequence run by an executor
+class TraceObserver : public onert::exec::IExecutionObserver
+{
+public:
+  TraceObserver(const SubgraphIndex &index, std::vector<std::string> &trace, std::mutex &mutex)
+      : _index{index}, _trace(trace), _mutex(mutex)
+  {
+  }
+
+  void handleBegin(onert::exec::IExecutor *, const OpSequence *op_seq,
+                   const onert::backend::Backend *backend) override
+  {
+    std::string record = std::to_string(_index.value()) + ":";
+    for (const auto &index : op_seq->operations())
+      record += std::to_string(index.value()) + ",";
+    record += backend->config()->id();
+
+    std::lock_guard<std::mutex> lock{_mutex};
+    _trace.push_back(record);
+  }
+  void handleEnd(onert::exec::IExecutor *, const OpSequence *,
+                 const onert::backend::Backend *) override
+  {
+  }
+
+private:
+  SubgraphIndex _index;
+  std::vector<std::string> &_trace;
+  std::mutex &_mutex;
+};
+
+OperandIndex addConstant(Graph &graph, const float (&data)[4])
+{
+  auto index = graph.addOperand(kShape, kFloat);
+  graph.operands().at(index).data(
+      std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(data), sizeof(data)));
+  return index;
+}
+
+// Model: while ((acc + x)[0] < 100) acc = (acc + x) * 2 + 1
+// model input: x, acc
+// model output: x, acc
+std::shared_ptr<Subgraphs> makeSubgraphs()
+{
+  static float limit_data[4] = {100, 100, 100, 100};
+  static float two_data[4] = {2, 2, 2, 2};
+  static float one_data[4] = {1, 1, 1, 1};
+
+  operation::Add::Param add_param;
+  add_param.activation = Activation::NONE;
+  operation::Mul::Param mul_param;
+  mul_param.activation = Activation::NONE;
+
+  auto main = std::make_shared<Graph>();
+  {
+    OperandIndexSequence inputs{main->addOperand(kShape, kFloat), main->addOperand(kShape, kFloat)};
+    OperandIndexSequence outputs{main->addOperand(kShape, kFloat),
+                                 main->addOperand(kShape, kFloat)};
+    operation::While::Param param;
+    param.cond_subg_index = kCondIndex;
+    param.body_subg_index = kBodyIndex;
+    main->addOperation(std::make_unique<operation::While>(inputs, outputs, param));
+    for (const auto &ind : inputs)
+      main->addInput(ind);
+    for (const auto &ind : outputs)
+      main->addOutput(ind);
+    main->finishBuilding();
+  }
+
+  auto cond = std::make_shared<Graph>();
+  {
+    auto x = cond->addOperand(kShape, kFloat);
+    auto acc = cond->addOperand(kShape, kFloat);
+    auto sum = cond->addOperand(kShape, kFloat);
+    auto limit = addConstant(*cond, limit_data);
+    auto result = cond->addOperand(kShape, TypeInfo{DataType::BOOL8});
+    cond->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{acc, x},
+                                                        OperandIndexSequence{sum}, add_param));
+    operation::Comparison::Param less_param;
+    less_param.comparison_type = operation::Comparison::ComparisonType::Less;
+    cond->addOperation(std::make_unique<operation::Comparison>(
+        OperandIndexSequence{sum, limit}, OperandIndexSequence{result}, less_param));
+    cond->addInput(x);
+    cond->addInput(acc);
+    cond->addOutput(result);
+    cond->finishBuilding();
+  }
+
+  auto body = std::make_shared<Graph>();
+  {
+    auto x = body->addOperand(kShape, kFloat);
+    auto acc = body->addOperand(kShape, kFloat);
+    auto sum = body->addOperand(kShape, kFloat);
+    auto twice = body->addOperand(kShape, kFloat);
+    auto acc_out = body->addOperand(kShape, kFloat);
+    auto two = addConstant(*body, two_data);
+    auto one = addConstant(*body, one_data);
+    body->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{acc, x},
+                                                        OperandIndexSequence{sum}, add_param));
+    body->addOperation(std::make_unique<operation::Mul>(OperandIndexSequence{sum, two},
+                                                        OperandIndexSequence{twice}, mul_param));
+    body->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{twice, one},
+                                                        OperandIndexSequence{acc_out}, add_param));
+    body->addInput(x);
+    body->addInput(acc);
+    body->addOutput(x);
+    body->addOutput(acc_out);
+    body->finishBuilding();
+  }
+
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(kMainIndex, main);
+  subgs->push(kCondIndex, cond);
+  subgs->push(kBodyIndex, body);
+  return subgs;
+}
+
+struct Result
+{
+  std::vector<std::string> trace;
+  float acc[4];
+  int64_t compile_us;
+};
+
+Result compileAndRun(int compile_threads)
+{
+  Result result;
+  std::mutex trace_mutex;
+
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  {
+    onert::compiler::Compiler compiler{makeSubgraphs()};
+    compiler.options().compile_threads = compile_threads;
+    const auto begin = std::chrono::steady_clock::now();
+    compiler.compile();
+    const auto end = std::chrono::steady_clock::now();
+    result.compile_us = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+    compiler.release(executors);
+  }
+
+  EXPECT_EQ(executors->size(), 3u);
+  for (auto &pair : *executors)
+  {
+    auto executor = dynamic_cast<onert::exec::ExecutorBase *>(pair.second.get());
+    if (executor)
+      executor->addObserver(std::make_unique<TraceObserver>(pair.first, result.trace, trace_mutex));
+  }
+
+  const float x[4] = {1, 2, 3, 4};
+  const float acc[4] = {0, 0, 0, 0};
+  float x_buffer[4] = {};
+  onert::exec::Execution execution{executors};
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(x), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(acc), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(x_buffer), 16);
+  execution.setOutput(IOIndex{1}, reinterpret_cast<void *>(result.acc), 16);
+  execution.execute();
+  return result;
+}
+
+} // namespace
+
+// Subgraphs compiled concurrently give the same executors as subgraphs compiled one by one
+TEST(Compiler, compileThreads)
+{
+  const auto serial = compileAndRun(1);
+  const auto concurrent = compileAndRun(4);
+
+  EXPECT_FALSE(serial.trace.empty());
+  EXPECT_EQ(concurrent.trace, serial.trace);
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(concurrent.acc[i], serial.acc[i]);
+  }
+  // acc of the first element: 0 -> 3 -> 9 -> 21 -> 45 -> 93 -> 189
+  EXPECT_EQ(serial.acc[0], 189);
+
+  ::testing::Test::RecordProperty("compile_us_1_thread", std::to_string(serial.compile_us));
+  ::testing::Test::RecordProperty("compile_us_4_threads", std::to_string(concurrent.compile_us));
+}
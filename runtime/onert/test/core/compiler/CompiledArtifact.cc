@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <compiler/CompiledArtifact.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <unistd.h>
+
+using onert::compiler::CompiledArtifact;
+using onert::ir::OperationIndex;
+using onert::ir::SubgraphIndex;
+
+namespace
+{
+
+std::string tempPath()
+{
+  return ::testing::TempDir() + "onert_compiled_artifact_test.bin";
+}
+
+} // namespace
+
+TEST(CompiledArtifact, save_load)
+{
+  const auto path = tempPath();
+
+  CompiledArtifact::Schedule schedule;
+  schedule.backends[OperationIndex{0}] = "cpu";
+  schedule.backends[OperationIndex{1}] = "acl_cl";
+  schedule.opcodes[OperationIndex{0}] = onert::ir::OpCode::Conv2D;
+  schedule.opcodes[OperationIndex{1}] = onert::ir::OpCode::Add;
+  schedule.indexed_ranks = std::make_shared<onert::ir::OperationIndexMap<int64_t>>();
+  (*schedule.indexed_ranks)[OperationIndex{0}] = 10;
+  (*schedule.indexed_ranks)[OperationIndex{1}] = 5;
+
+  CompiledArtifact saved{1234};
+  saved.schedule(SubgraphIndex{0}, schedule);
+  saved.schedule(SubgraphIndex{1}, CompiledArtifact::Schedule{});
+  saved.save(path);
+
+  CompiledArtifact loaded{1234};
+  ASSERT_TRUE(loaded.load(path));
+
+  const auto loaded_schedule = loaded.schedule(SubgraphIndex{0});
+  ASSERT_NE(loaded_schedule, nullptr);
+  ASSERT_EQ(loaded_schedule->backends, schedule.backends);
+  ASSERT_EQ(loaded_schedule->opcodes, schedule.opcodes);
+  ASSERT_NE(loaded_schedule->indexed_ranks, nullptr);
+  ASSERT_EQ(*loaded_schedule->indexed_ranks, *schedule.indexed_ranks);
+
+  const auto empty_schedule = loaded.schedule(SubgraphIndex{1});
+  ASSERT_NE(empty_schedule, nullptr);
+  ASSERT_TRUE(empty_schedule->backends.empty());
+  ASSERT_EQ(empty_schedule->indexed_ranks, nullptr);
+  ASSERT_EQ(loaded.schedule(SubgraphIndex{2}), nullptr);
+
+  std::remove(path.c_str());
+}
+
+TEST(CompiledArtifact, key)
+{
+  onert::compiler::CompilerOptions options;
+  options.backend_list = {"cpu"};
+  options.executor = "Linear";
+  options.he_scheduler = false;
+
+  const auto key = CompiledArtifact::makeKey(1, options);
+  ASSERT_EQ(key, CompiledArtifact::makeKey(1, options));
+  ASSERT_NE(key, CompiledArtifact::makeKey(2, options));
+
+  options.manual_scheduler_options.opcode_to_backend[onert::ir::OpCode::Conv2D] = "acl_cl";
+  ASSERT_NE(key, CompiledArtifact::makeKey(1, options));
+}
+
+TEST(CompiledArtifact, neg_load_different_key)
+{
+  const auto path = tempPath();
+
+  CompiledArtifact saved{1234};
+  saved.save(path);
+
+  CompiledArtifact loaded{4321};
+  ASSERT_FALSE(loaded.load(path));
+
+  std::remove(path.c_str());
+}
+
+TEST(CompiledArtifact, neg_load_broken)
+{
+  const auto path = tempPath();
+
+  CompiledArtifact loaded{1234};
+  ASSERT_FALSE(loaded.load(path));
+
+  {
+    std::ofstream ofs{path, std::ios::binary};
+    ofs << "ONERTART";
+  }
+  ASSERT_FALSE(loaded.load(path));
+
+  std::remove(path.c_str());
+}
+
+TEST(CompiledArtifact, save_replace)
+{
+  const auto path = tempPath();
+  {
+    std::ofstream ofs{path, std::ios::binary};
+    ofs << "ONERTART";
+  }
+
+  CompiledArtifact::Schedule schedule;
+  schedule.backends[OperationIndex{0}] = "cpu";
+  schedule.opcodes[OperationIndex{0}] = onert::ir::OpCode::Add;
+  CompiledArtifact saved{1234};
+  saved.schedule(SubgraphIndex{0}, schedule);
+  saved.save(path);
+
+  // The temporary file is renamed to the path
+  ASSERT_FALSE(std::ifstream{path + ".tmp" + std::to_string(getpid())});
+
+  CompiledArtifact loaded{1234};
+  ASSERT_TRUE(loaded.load(path));
+  ASSERT_NE(loaded.schedule(SubgraphIndex{0}), nullptr);
+  ASSERT_EQ(loaded.schedule(SubgraphIndex{0})->opcodes, schedule.opcodes);
+
+  std::remove(path.c_str());
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/Compiler.h"
+#include "ir/Graph.h"
+
+#include <cstdlib>
+
+namespace
+{
+
+using namespace onert;
+
+class CompilerOptionsTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    const auto original = std::getenv("PARALLEL_THREADS");
+    _has_original = original != nullptr;
+    if (_has_original)
+      _original = original;
+  }
+
+  void TearDown() override
+  {
+    if (_has_original)
+      setenv("PARALLEL_THREADS", _original.c_str(), true);
+    else
+      unsetenv("PARALLEL_THREADS");
+  }
+
+  compiler::CompilerOptions fetch(const std::string &parallel_threads)
+  {
+    setenv("PARALLEL_THREADS", parallel_threads.c_str(), true);
+    ir::Subgraphs subgs;
+    return compiler::fetchCompilerOptionsFromGlobalConfig(subgs);
+  }
+
+private:
+  bool _has_original;
+  std::string _original;
+};
+
+} // namespace
+
+TEST_F(CompilerOptionsTest, parallelThreads)
+{
+  const auto options = fetch("cpu=2;acl_cl=1;");
+  EXPECT_EQ(options.parallel_threads.size(), 2u);
+  EXPECT_EQ(options.parallel_threads.at("cpu"), 2);
+  EXPECT_EQ(options.parallel_threads.at("acl_cl"), 1);
+}
+
+TEST_F(CompilerOptionsTest, neg_parallelThreads)
+{
+  for (const auto &value : {"cpu", "cpu=", "=2", "cpu=two", "cpu=2x", "cpu= 2", "cpu=0", "cpu=-1",
+                            "cpu=99999999999", "cpu=1=2", "cpu=2;acl_cl"})
+  {
+    EXPECT_THROW(fetch(value), std::runtime_error) << value;
+  }
+}
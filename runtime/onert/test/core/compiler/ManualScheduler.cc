@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/ManualScheduler.h"
+#include "compiler/Compiler.h"
+#include "ir/Graph.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/Reshape.h"
+#include "ir/operation/SpaceToBatchND.h"
+
+namespace
+{
+
+using namespace onert;
+using namespace ir;
+
+//
+// Mock backends classes
+//
+
+struct MockConfig : public backend::IConfig
+{
+  MockConfig(const std::string &id, bool dynamic) : _id{id}, _dynamic{dynamic} {}
+  std::string id() override { return _id; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  Layout supportLayout(const Operation &, Layout) override { return Layout::UNKNOWN; }
+  bool supportDynamicTensor() override { return _dynamic; }
+  bool supportFP16() override { return false; }
+
+private:
+  std::string _id;
+  bool _dynamic;
+};
+
+struct MockBackend : public backend::Backend
+{
+  MockBackend(const std::string &id, bool dynamic)
+      : _config{std::make_shared<MockConfig>(id, dynamic)}
+  {
+  }
+  std::shared_ptr<backend::IConfig> config() const override { return _config; }
+  std::unique_ptr<backend::BackendContext>
+  newContext(const Graph &graph, const std::shared_ptr<backend::custom::IKernelBuilder> &,
+             bool) const override
+  {
+    return std::make_unique<backend::BackendContext>(this, &graph);
+  }
+
+private:
+  std::shared_ptr<backend::IConfig> _config;
+};
+
+// Model: Add(Add(Reshape(input, shape))) and an independent Add
+// model input: input, shape, x
+// model output: output, y
+std::shared_ptr<Graph> makeGraph()
+{
+  auto graph = std::make_shared<Graph>();
+  TypeInfo float_type{DataType::FLOAT32};
+  auto input = graph->addOperand(Shape{4}, float_type);
+  auto shape = graph->addOperand(Shape{2}, TypeInfo{DataType::INT32});
+  auto reshaped = graph->addOperand(Shape{2, 2}, float_type);
+  auto sum = graph->addOperand(Shape{2, 2}, float_type);
+  auto output = graph->addOperand(Shape{2, 2}, float_type);
+  auto x = graph->addOperand(Shape{2, 2}, float_type);
+  auto y = graph->addOperand(Shape{2, 2}, float_type);
+
+  operation::Add::Param add_param;
+  add_param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::Reshape>(OperandIndexSequence{input, shape},
+                                                           OperandIndexSequence{reshaped}));
+  graph->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{reshaped, reshaped},
+                                                       OperandIndexSequence{sum}, add_param));
+  graph->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{sum, sum},
+                                                       OperandIndexSequence{output}, add_param));
+  graph->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{x, x},
+                                                       OperandIndexSequence{y}, add_param));
+  graph->addInput(input);
+  graph->addInput(shape);
+  graph->addInput(x);
+  graph->addOutput(output);
+  graph->addOutput(y);
+  graph->finishBuilding();
+  return graph;
+}
+
+void schedule(bool npu_dynamic, std::string (&expected)[4])
+{
+  auto graph = makeGraph();
+  MockBackend cpu{"cpu", true};
+  MockBackend npu{"npu", npu_dynamic};
+  backend::BackendContexts contexts;
+  contexts.emplace(&cpu, cpu.newContext(*graph, nullptr, false));
+  contexts.emplace(&npu, npu.newContext(*graph, nullptr, false));
+
+  compiler::CompilerOptions options;
+  options.backend_list = {"npu", "cpu"};
+  options.manual_scheduler_options.backend_for_all = "npu";
+  auto resolver = compiler::ManualScheduler{contexts, options}.schedule(*graph);
+
+  for (uint32_t i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(resolver->getBackend(OperationIndex{i})->config()->id(), expected[i]);
+  }
+}
+
+} // namespace
+
+TEST(ManualScheduler, dynamicConsumersMoveToCpu)
+{
+  // The outputs of Reshape are dynamic, and npu cannot run the operations using them
+  std::string expected[4] = {"cpu", "cpu", "cpu", "npu"};
+  schedule(false, expected);
+}
+
+TEST(ManualScheduler, dynamicConsumersStay)
+{
+  std::string expected[4] = {"cpu", "npu", "npu", "npu"};
+  schedule(true, expected);
+}
+
+TEST(Compiler, neg_nonConstSpaceToBatchND)
+{
+  // The interpreter cannot run SpaceToBatchND, so the compiler rejects the model
+  auto graph = std::make_shared<Graph>();
+  auto input = graph->addOperand(Shape{1, 4, 4, 1}, TypeInfo{DataType::FLOAT32});
+  auto block_size = graph->addOperand(Shape{2}, TypeInfo{DataType::INT32});
+  auto paddings = graph->addOperand(Shape{2, 2}, TypeInfo{DataType::INT32});
+  auto output = graph->addOperand(Shape{4, 2, 2, 1}, TypeInfo{DataType::FLOAT32});
+  static int32_t paddings_data[4] = {0, 0, 0, 0};
+  graph->operands().at(paddings).data(
+      std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(paddings_data), 16));
+  graph->addOperation(std::make_unique<operation::SpaceToBatchND>(
+      OperandIndexSequence{input, block_size, paddings}, OperandIndexSequence{output}));
+  graph->addInput(input);
+  graph->addInput(block_size);
+  graph->addOutput(output);
+  graph->finishBuilding();
+
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, graph);
+  compiler::Compiler compiler{subgs};
+  EXPECT_THROW(compiler.compile(), std::runtime_error);
+}
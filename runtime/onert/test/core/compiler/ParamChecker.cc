@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/ParamChecker.h"
+#include "ir/Graph.h"
+#include "ir/operation/Pad.h"
+#include "ir/operation/Reshape.h"
+
+namespace
+{
+
+using namespace onert::ir;
+
+// Model: Reshape whose shape is model input
+// model input: input, shape
+// model output: output
+std::shared_ptr<Graph> makeReshapeGraph(bool const_shape)
+{
+  auto graph = std::make_shared<Graph>();
+  static int32_t shape_data[2] = {2, 2};
+  auto input = graph->addOperand(Shape{4}, TypeInfo{DataType::FLOAT32});
+  auto shape = graph->addOperand(Shape{2}, TypeInfo{DataType::INT32});
+  auto output = graph->addOperand(Shape{2, 2}, TypeInfo{DataType::FLOAT32});
+  if (const_shape)
+  {
+    graph->operands().at(shape).data(
+        std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&shape_data), 8));
+  }
+  graph->addOperation(std::make_unique<operation::Reshape>(OperandIndexSequence{input, shape},
+                                                           OperandIndexSequence{output}));
+  graph->addInput(input);
+  if (!const_shape)
+    graph->addInput(shape);
+  graph->addOutput(output);
+  graph->finishBuilding();
+  return graph;
+}
+
+} // namespace
+
+TEST(ParamChecker, constParam)
+{
+  auto graph = makeReshapeGraph(true);
+  onert::compiler::ParamChecker checker{*graph};
+  checker();
+
+  ASSERT_FALSE(checker.haveNoneConstParam());
+  ASSERT_TRUE(checker.cpuOnlyOperations().empty());
+}
+
+TEST(ParamChecker, cpuOnlyParam)
+{
+  auto graph = makeReshapeGraph(false);
+  onert::compiler::ParamChecker checker{*graph};
+  checker();
+
+  ASSERT_FALSE(checker.haveNoneConstParam());
+  ASSERT_EQ(checker.cpuOnlyOperations().size(), 1);
+  ASSERT_EQ(checker.cpuOnlyOperations().at(0), OperationIndex{0});
+}
+
+TEST(ParamChecker, neg_nonConstPad)
+{
+  auto graph = std::make_shared<Graph>();
+  auto input = graph->addOperand(Shape{1, 2}, TypeInfo{DataType::FLOAT32});
+  auto pad = graph->addOperand(Shape{2, 2}, TypeInfo{DataType::INT32});
+  auto output = graph->addOperand(Shape{3, 4}, TypeInfo{DataType::FLOAT32});
+  operation::Pad::Param param;
+  param.rank = 2;
+  graph->addOperation(std::make_unique<operation::Pad>(OperandIndexSequence{input, pad},
+                                                       OperandIndexSequence{output}, param));
+  graph->addInput(input);
+  graph->addInput(pad);
+  graph->addOutput(output);
+  graph->finishBuilding();
+
+  onert::compiler::ParamChecker checker{*graph};
+  checker();
+
+  ASSERT_TRUE(checker.haveNoneConstParam());
+  ASSERT_TRUE(checker.cpuOnlyOperations().empty());
+}
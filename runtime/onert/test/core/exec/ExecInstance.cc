@@ -15,12 +15,17 @@
  */
 
 #include <gtest/gtest.h>
+#include <cstring>
 #include <thread>
 
 #include "ir/Graph.h"
 #include "compiler/Compiler.h"
 #include "exec/Execution.h"
+#include "exec/ExecutionObservers.h"
+#include "exec/ExecutorBase.h"
 #include "ir/operation/Add.h"
+#include "ir/operation/Pack.h"
+#include "ir/operation/Reshape.h"
 
 namespace
 {
@@ -84,6 +89,37 @@ public:
   std::shared_ptr<onert::exec::ExecutorMap> executors;
 };
 
+// Records the memory of the first input and output tensors while operations run
+class BufferObserver : public onert::exec::IExecutionObserver
+{
+public:
+  void handleBegin(onert::exec::IExecutor *executor, const OpSequence *,
+                   const onert::backend::Backend *) override
+  {
+    auto executor_base = dynamic_cast<onert::exec::ExecutorBase *>(executor);
+    input_buffer = executor_base->getInputTensors().at(0)->buffer();
+    output_buffer = executor_base->getOutputTensors().at(0)->buffer();
+  }
+  void handleEnd(onert::exec::IExecutor *, const OpSequence *,
+                 const onert::backend::Backend *) override
+  {
+  }
+
+public:
+  const void *input_buffer = nullptr;
+  const void *output_buffer = nullptr;
+};
+
+// Add BufferObserver to the primary executor
+BufferObserver *observeBuffers(onert::exec::ExecutorMap &executors)
+{
+  auto observer = std::make_unique<BufferObserver>();
+  auto observer_raw = observer.get();
+  auto executor = dynamic_cast<onert::exec::ExecutorBase *>(executors.at(SubgraphIndex{0}).get());
+  executor->addObserver(std::move(observer));
+  return observer_raw;
+}
+
 TEST(ExecInstance, simple)
 {
   auto mockup = CompiledMockUpModel();
@@ -307,4 +343,300 @@ TEST(ExecInstance, async)
   delete execution;
 }
 
+// User buffers are bound to I/O tensors when possible, otherwise they are copied
+TEST(ExecInstance, userBuffers)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  // Misaligned buffers cannot be bound
+  alignas(float) uint8_t misaligned_input1[17];
+  alignas(float) uint8_t misaligned_output[17] = {};
+  std::memcpy(misaligned_input1 + 1, input1_buffer, 16);
+
+  auto observer = observeBuffers(*executors);
+  auto execution = new onert::exec::Execution(executors);
+
+  for (auto misaligned : {false, true, false})
+  {
+    float output_buffer[4] = {};
+    const void *input1_ptr = misaligned ? misaligned_input1 + 1
+                                        : reinterpret_cast<const void *>(input1_buffer);
+    void *output_ptr = misaligned ? misaligned_output + 1 : reinterpret_cast<void *>(output_buffer);
+
+    execution->setInput(input1, input1_ptr, 16);
+    execution->setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+    execution->setOutput(output, output_ptr, 16);
+    execution->execute();
+
+    // Kernels use aligned user buffers directly, and misaligned ones are copied
+    EXPECT_EQ(observer->input_buffer == input1_ptr, !misaligned);
+    EXPECT_EQ(observer->output_buffer == output_ptr, !misaligned);
+
+    float result[4];
+    std::memcpy(result, output_ptr, 16);
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(result[i], output_expected[i]);
+    }
+  }
+
+  delete execution;
+}
+
+// An output buffer which is also an input buffer is not bound, so the input is read as given
+TEST(ExecInstance, sharedUserBuffers)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.executors;
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  auto observer = observeBuffers(*executors);
+  auto execution = new onert::exec::Execution(executors);
+
+  float inout_buffer[4] = {1, 0, -1, -2};
+  execution->setInput(input1, reinterpret_cast<const void *>(inout_buffer), 16);
+  execution->setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution->setOutput(output, reinterpret_cast<void *>(inout_buffer), 16);
+  execution->execute();
+
+  // The input uses the buffer directly, and the output is copied to it after the run
+  EXPECT_EQ(observer->input_buffer, inout_buffer);
+  EXPECT_NE(observer->output_buffer, inout_buffer);
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(inout_buffer[i], output_expected[i]);
+  }
+
+  // An output buffer overlapping only a part of an input buffer is not bound either
+  float overlap_buffer[6] = {1, 0, -1, -2, 0, 0};
+  execution->setInput(input1, reinterpret_cast<const void *>(overlap_buffer), 16);
+  execution->setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution->setOutput(output, reinterpret_cast<void *>(overlap_buffer + 2), 16);
+  execution->execute();
+
+  EXPECT_EQ(observer->input_buffer, overlap_buffer);
+  EXPECT_NE(observer->output_buffer, overlap_buffer + 2);
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(overlap_buffer[i + 2], output_expected[i]);
+  }
+
+  delete execution;
+}
+
+TEST(ExecInstance, workStealing)
+{
+  // Model: two branches of add operations joined by another add operation
+  // model input: lhs, rhs
+  // model output: result
+  // constant: bias
+  // sum <= (lhs + rhs)
+  // left <= (sum + bias), right <= (sum + sum)
+  // result <= (left + right)
+  auto graph = std::make_shared<Graph>();
+  Shape shape{1, 2, 2, 1};
+  TypeInfo type{DataType::FLOAT32};
+  static float bias_data[4] = {3, 1, -1, 5};
+  auto operand_lhs = graph->addOperand(shape, type);
+  auto operand_rhs = graph->addOperand(shape, type);
+  auto operand_bias = graph->addOperand(shape, type);
+  auto operand_sum = graph->addOperand(shape, type);
+  auto operand_left = graph->addOperand(shape, type);
+  auto operand_right = graph->addOperand(shape, type);
+  auto operand_result = graph->addOperand(shape, type);
+  graph->operands()
+      .at(operand_bias)
+      .data(std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(&bias_data), 16));
+  operation::Add::Param param;
+  param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{operand_lhs, operand_rhs}, OperandIndexSequence{operand_sum}, param));
+  graph->addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{operand_sum, operand_bias}, OperandIndexSequence{operand_left}, param));
+  graph->addOperation(std::make_unique<operation::Add>(
+      OperandIndexSequence{operand_sum, operand_sum}, OperandIndexSequence{operand_right}, param));
+  graph->addOperation(
+      std::make_unique<operation::Add>(OperandIndexSequence{operand_left, operand_right},
+                                       OperandIndexSequence{operand_result}, param));
+  graph->addInput(operand_lhs);
+  graph->addInput(operand_rhs);
+  graph->addOutput(operand_result);
+  graph->finishBuilding();
+
+  auto subgs = std::make_shared<onert::ir::Subgraphs>();
+  subgs->push(onert::ir::SubgraphIndex{0}, graph);
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  auto compiler = new onert::compiler::Compiler{subgs};
+  compiler->options().executor = "WorkStealing";
+  compiler->options().work_stealing_threads = 4;
+  compiler->compile();
+  compiler->release(executors);
+  delete compiler;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {9, -8, 2, -13};
+
+  auto execution = new onert::exec::Execution(executors);
+
+  // Worker threads are kept alive between executions
+  for (auto n = 0; n < 10; n++)
+  {
+    float output_buffer[4] = {};
+    execution->setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+    execution->setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+    execution->setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+    execution->execute();
+
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[i]);
+    }
+  }
+
+  delete execution;
+}
+
+// Shapes following a Reshape depend on the value of its shape input, so they are inferred again
+// whenever the value changes although the input shapes are the same
+TEST(ExecInstance, dynamicShapeFromValues)
+{
+  // Model: result <= reshape(input, shape) + reshape(input, shape)
+  // model input: input {2, 3}, shape {2}
+  // model output: result
+  auto graph = std::make_shared<Graph>();
+  auto operand_input = graph->addOperand(Shape{2, 3}, TypeInfo{DataType::FLOAT32});
+  auto operand_shape = graph->addOperand(Shape{2}, TypeInfo{DataType::INT32});
+  auto operand_reshaped = graph->addOperand(Shape{2, 3}, TypeInfo{DataType::FLOAT32});
+  auto operand_result = graph->addOperand(Shape{2, 3}, TypeInfo{DataType::FLOAT32});
+  graph->addOperation(std::make_unique<operation::Reshape>(
+      OperandIndexSequence{operand_input, operand_shape}, OperandIndexSequence{operand_reshaped}));
+  operation::Add::Param param;
+  param.activation = Activation::NONE;
+  graph->addOperation(
+      std::make_unique<operation::Add>(OperandIndexSequence{operand_reshaped, operand_reshaped},
+                                       OperandIndexSequence{operand_result}, param));
+  graph->addInput(operand_input);
+  graph->addInput(operand_shape);
+  graph->addOutput(operand_result);
+  graph->finishBuilding();
+
+  auto subgs = std::make_shared<onert::ir::Subgraphs>();
+  subgs->push(onert::ir::SubgraphIndex{0}, graph);
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  auto compiler = new onert::compiler::Compiler{subgs};
+  compiler->compile();
+  compiler->release(executors);
+  delete compiler;
+
+  const float input_buffer[6] = {1, 2, 3, 4, 5, 6};
+  const float output_expected[6] = {2, 4, 6, 8, 10, 12};
+
+  auto execution = new onert::exec::Execution(executors);
+
+  for (const auto &new_shape : std::vector<std::vector<int32_t>>{{3, 2}, {1, 6}, {1, 6}, {3, 2}})
+  {
+    float output_buffer[6] = {};
+    execution->setInput(IOIndex{0}, reinterpret_cast<const void *>(input_buffer), 24);
+    execution->setInput(IOIndex{1}, reinterpret_cast<const void *>(new_shape.data()), 8);
+    execution->setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 24);
+    execution->execute();
+
+    const auto output_shape = execution->getOutputShape(IOIndex{0});
+    ASSERT_EQ(output_shape.rank(), 2);
+    EXPECT_EQ(output_shape.dim(0), new_shape[0]);
+    EXPECT_EQ(output_shape.dim(1), new_shape[1]);
+    for (auto i = 0; i < 6; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[i]);
+    }
+  }
+
+  delete execution;
+}
+
+// Outputs which are allocated by shape inference must be allocated again when the shapes
+// recorded for the same input shapes are replayed, as they are deallocated after their last use
+TEST(ExecInstance, dynamicPackSameShapes)
+{
+  // Model: result <= pack(reshape(input, shape), reshape(input, shape)) * 2 by add
+  // model input: input {2, 3}, shape {2}
+  // model output: result
+  auto graph = std::make_shared<Graph>();
+  auto operand_input = graph->addOperand(Shape{2, 3}, TypeInfo{DataType::FLOAT32});
+  auto operand_shape = graph->addOperand(Shape{2}, TypeInfo{DataType::INT32});
+  auto operand_reshaped = graph->addOperand(Shape{2, 3}, TypeInfo{DataType::FLOAT32});
+  auto operand_packed = graph->addOperand(Shape{2, 2, 3}, TypeInfo{DataType::FLOAT32});
+  auto operand_result = graph->addOperand(Shape{2, 2, 3}, TypeInfo{DataType::FLOAT32});
+  graph->addOperation(std::make_unique<operation::Reshape>(
+      OperandIndexSequence{operand_input, operand_shape}, OperandIndexSequence{operand_reshaped}));
+  operation::Pack::Param pack_param;
+  pack_param.num = 2;
+  pack_param.axis = 0;
+  pack_param.rank = 3;
+  graph->addOperation(
+      std::make_unique<operation::Pack>(OperandIndexSequence{operand_reshaped, operand_reshaped},
+                                        OperandIndexSequence{operand_packed}, pack_param));
+  operation::Add::Param add_param;
+  add_param.activation = Activation::NONE;
+  graph->addOperation(
+      std::make_unique<operation::Add>(OperandIndexSequence{operand_packed, operand_packed},
+                                       OperandIndexSequence{operand_result}, add_param));
+  graph->addInput(operand_input);
+  graph->addInput(operand_shape);
+  graph->addOutput(operand_result);
+  graph->finishBuilding();
+
+  auto subgs = std::make_shared<onert::ir::Subgraphs>();
+  subgs->push(onert::ir::SubgraphIndex{0}, graph);
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  auto compiler = new onert::compiler::Compiler{subgs};
+  compiler->compile();
+  compiler->release(executors);
+  delete compiler;
+
+  const float input_buffer[6] = {1, 2, 3, 4, 5, 6};
+  const float output_expected[12] = {2, 4, 6, 8, 10, 12, 2, 4, 6, 8, 10, 12};
+  const int32_t new_shape[2] = {3, 2};
+
+  auto execution = new onert::exec::Execution(executors);
+
+  for (auto n = 0; n < 3; n++)
+  {
+    float output_buffer[12] = {};
+    execution->setInput(IOIndex{0}, reinterpret_cast<const void *>(input_buffer), 24);
+    execution->setInput(IOIndex{1}, reinterpret_cast<const void *>(new_shape), 8);
+    execution->setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 48);
+    execution->execute();
+
+    const auto output_shape = execution->getOutputShape(IOIndex{0});
+    ASSERT_EQ(output_shape.rank(), 3);
+    EXPECT_EQ(output_shape.dim(0), 2);
+    EXPECT_EQ(output_shape.dim(1), 3);
+    EXPECT_EQ(output_shape.dim(2), 2);
+    for (auto i = 0; i < 12; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[i]);
+    }
+  }
+
+  delete execution;
+}
+
 } // namespace
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "compiler/Compiler.h"
+#include "exec/Execution.h"
+#include "ir/operation/Add.h"
+#include "ir/operation/Cast.h"
+#include "ir/operation/Comparison.h"
+#include "ir/operation/Sub.h"
+#include "ir/operation/While.h"
+
+namespace
+{
+
+using namespace onert::ir;
+
+const SubgraphIndex kMainIndex{0};
+const SubgraphIndex kCondIndex{1};
+const SubgraphIndex kBodyIndex{2};
+
+// Graph of a single While operation whose loop variables are inputs and outputs of the graph
+std::shared_ptr<Graph> makeWhileGraph(const std::vector<Shape> &shapes)
+{
+  auto graph = std::make_shared<Graph>();
+  OperandIndexSequence inputs;
+  OperandIndexSequence outputs;
+  for (const auto &shape : shapes)
+  {
+    inputs.append(graph->addOperand(shape, TypeInfo{DataType::FLOAT32}));
+    outputs.append(graph->addOperand(shape, TypeInfo{DataType::FLOAT32}));
+  }
+  operation::While::Param param;
+  param.cond_subg_index = kCondIndex;
+  param.body_subg_index = kBodyIndex;
+  graph->addOperation(std::make_unique<operation::While>(inputs, outputs, param));
+  for (const auto &ind : inputs)
+    graph->addInput(ind);
+  for (const auto &ind : outputs)
+    graph->addOutput(ind);
+  graph->finishBuilding();
+  return graph;
+}
+
+std::shared_ptr<onert::exec::ExecutorMap> compile(const std::shared_ptr<Graph> &main,
+                                                  const std::shared_ptr<Graph> &cond,
+                                                  const std::shared_ptr<Graph> &body)
+{
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(kMainIndex, main);
+  subgs->push(kCondIndex, cond);
+  subgs->push(kBodyIndex, body);
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  auto compiler = new onert::compiler::Compiler{subgs};
+  compiler->compile();
+  compiler->release(executors);
+  delete compiler;
+  return executors;
+}
+
+} // namespace
+
+// Loop-carried variables of static shapes use the loop buffers of While instead of copies
+TEST(ExecWhile, staticLoopBuffers)
+{
+  // Model: while ((acc + x)[0] < 10) acc = acc + x
+  // model input: x {2, 2}, acc {2, 2}
+  // model output: x, which passes through the body, and acc, which does not
+  Shape shape{2, 2};
+  TypeInfo float_type{DataType::FLOAT32};
+  auto main = makeWhileGraph({shape, shape});
+
+  // cond: (acc + x) < limit
+  auto cond = std::make_shared<Graph>();
+  {
+    static float limit_data[4] = {10, 10, 10, 10};
+    auto x = cond->addOperand(shape, float_type);
+    auto acc = cond->addOperand(shape, float_type);
+    auto sum = cond->addOperand(shape, float_type);
+    auto limit = cond->addOperand(shape, float_type);
+    auto result = cond->addOperand(shape, TypeInfo{DataType::BOOL8});
+    cond->operands().at(limit).data(
+        std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(limit_data), 16));
+    operation::Add::Param add_param;
+    add_param.activation = Activation::NONE;
+    cond->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{acc, x},
+                                                        OperandIndexSequence{sum}, add_param));
+    operation::Comparison::Param less_param;
+    less_param.comparison_type = operation::Comparison::ComparisonType::Less;
+    cond->addOperation(std::make_unique<operation::Comparison>(
+        OperandIndexSequence{sum, limit}, OperandIndexSequence{result}, less_param));
+    cond->addInput(x);
+    cond->addInput(acc);
+    cond->addOutput(result);
+    cond->finishBuilding();
+  }
+
+  // body: (x, acc) <= (x, acc + x)
+  auto body = std::make_shared<Graph>();
+  {
+    auto x = body->addOperand(shape, float_type);
+    auto acc = body->addOperand(shape, float_type);
+    auto acc_out = body->addOperand(shape, float_type);
+    operation::Add::Param add_param;
+    add_param.activation = Activation::NONE;
+    body->addOperation(std::make_unique<operation::Add>(OperandIndexSequence{acc, x},
+                                                        OperandIndexSequence{acc_out}, add_param));
+    body->addInput(x);
+    body->addInput(acc);
+    body->addOutput(x);
+    body->addOutput(acc_out);
+    body->finishBuilding();
+  }
+
+  auto executors = compile(main, cond, body);
+  auto execution = new onert::exec::Execution(executors);
+
+  // The second run reuses the loop buffers bound by the first one
+  struct Case
+  {
+    float x[4];
+    float acc[4];
+    float acc_expected[4];
+  };
+  const Case cases[] = {{{1, 2, 3, 4}, {0, 0, 0, 0}, {9, 18, 27, 36}},
+                        {{2, 1, 1, 1}, {1, 0, 0, 0}, {9, 4, 4, 4}}};
+  for (const auto &c : cases)
+  {
+    float x_buffer[4] = {};
+    float acc_buffer[4] = {};
+    execution->setInput(IOIndex{0}, reinterpret_cast<const void *>(c.x), 16);
+    execution->setInput(IOIndex{1}, reinterpret_cast<const void *>(c.acc), 16);
+    execution->setOutput(IOIndex{0}, reinterpret_cast<void *>(x_buffer), 16);
+    execution->setOutput(IOIndex{1}, reinterpret_cast<void *>(acc_buffer), 16);
+    execution->execute();
+
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(x_buffer[i], c.x[i]);
+      EXPECT_EQ(acc_buffer[i], c.acc_expected[i]);
+    }
+  }
+
+  delete execution;
+}
+
+// Loop-carried variables get dynamic shapes in the subgraphs when their shapes differ from the
+// declared ones, and they keep the same shapes across iterations
+TEST(ExecWhile, dynamicSameShape)
+{
+  // Model: while (x[0] != 0) x = x - 1
+  // model input: x {2, 3}
+  // model output: x
+  // Subgraphs declare x as {1, 3}
+  TypeInfo float_type{DataType::FLOAT32};
+  auto main = makeWhileGraph({Shape{2, 3}});
+
+  // cond: cast(x) to bool
+  auto cond = std::make_shared<Graph>();
+  {
+    auto x = cond->addOperand(Shape{1, 3}, float_type);
+    auto result = cond->addOperand(Shape{1, 3}, TypeInfo{DataType::BOOL8});
+    cond->addOperation(
+        std::make_unique<operation::Cast>(OperandIndexSequence{x}, OperandIndexSequence{result}));
+    cond->addInput(x);
+    cond->addOutput(result);
+    cond->finishBuilding();
+  }
+
+  // body: x <= x - 1
+  auto body = std::make_shared<Graph>();
+  {
+    static float one_data[3] = {1, 1, 1};
+    auto x = body->addOperand(Shape{1, 3}, float_type);
+    auto one = body->addOperand(Shape{1, 3}, float_type);
+    auto x_out = body->addOperand(Shape{1, 3}, float_type);
+    body->operands().at(one).data(
+        std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(one_data), 12));
+    operation::Sub::Param sub_param;
+    sub_param.activation = Activation::NONE;
+    body->addOperation(std::make_unique<operation::Sub>(OperandIndexSequence{x, one},
+                                                        OperandIndexSequence{x_out}, sub_param));
+    body->addInput(x);
+    body->addOutput(x_out);
+    body->finishBuilding();
+  }
+
+  auto executors = compile(main, cond, body);
+  auto execution = new onert::exec::Execution(executors);
+
+  const float x[6] = {3, 5, 7, 9, 11, 13};
+  const float x_expected[6] = {0, 2, 4, 6, 8, 10};
+  for (auto n = 0; n < 2; n++)
+  {
+    float x_buffer[6] = {};
+    execution->setInput(IOIndex{0}, reinterpret_cast<const void *>(x), 24);
+    execution->setOutput(IOIndex{0}, reinterpret_cast<void *>(x_buffer), 24);
+    execution->execute();
+
+    for (auto i = 0; i < 6; i++)
+    {
+      EXPECT_EQ(x_buffer[i], x_expected[i]);
+    }
+  }
+
+  delete execution;
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/WorkStealingDeque.h"
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace onert::exec;
+
+TEST(WorkStealingDeque, pop_lifo_steal_fifo)
+{
+  WorkStealingDeque deque{4};
+  uint32_t job;
+
+  ASSERT_FALSE(deque.pop(job));
+  ASSERT_FALSE(deque.steal(job));
+
+  deque.push(1);
+  deque.push(2);
+  deque.push(3);
+
+  ASSERT_TRUE(deque.pop(job));
+  ASSERT_EQ(job, 3);
+  ASSERT_TRUE(deque.steal(job));
+  ASSERT_EQ(job, 1);
+  ASSERT_TRUE(deque.pop(job));
+  ASSERT_EQ(job, 2);
+  ASSERT_FALSE(deque.pop(job));
+  ASSERT_FALSE(deque.steal(job));
+}
+
+TEST(WorkStealingDeque, concurrent_steal)
+{
+  const uint32_t num_jobs = 10000;
+  WorkStealingDeque deque{num_jobs};
+  std::vector<std::atomic<uint32_t>> taken(num_jobs);
+  std::atomic<uint32_t> num_taken{0};
+
+  auto thief = [&] {
+    uint32_t job;
+    while (num_taken.load() < num_jobs)
+    {
+      if (deque.steal(job))
+      {
+        ++taken[job];
+        ++num_taken;
+      }
+    }
+  };
+  std::thread thief1{thief};
+  std::thread thief2{thief};
+
+  uint32_t job;
+  for (uint32_t i = 0; i < num_jobs; ++i)
+  {
+    deque.push(i);
+    if (i % 3 == 0 && deque.pop(job))
+    {
+      ++taken[job];
+      ++num_taken;
+    }
+  }
+  while (deque.pop(job))
+  {
+    ++taken[job];
+    ++num_taken;
+  }
+
+  thief1.join();
+  thief2.join();
+
+  for (uint32_t i = 0; i < num_jobs; ++i)
+  {
+    ASSERT_EQ(taken[i].load(), 1);
+  }
+}
+
+} // namespace
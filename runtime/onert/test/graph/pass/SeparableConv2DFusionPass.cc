@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ir/Graph.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/SeparableConv2D.h"
+#include "ir/pass/SeparableConv2DFusionPass.h"
+
+namespace
+{
+
+using namespace onert::ir;
+
+struct MockConfig : public onert::backend::IConfig
+{
+  MockConfig(const std::string &id) : _id{id} {}
+  std::string id() override { return _id; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  Layout supportLayout(const Operation &, Layout) override { return Layout::UNKNOWN; }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+
+  std::string _id;
+};
+
+struct MockBackend : public onert::backend::Backend
+{
+  MockBackend(const std::string &id) : _id{id} {}
+  std::shared_ptr<onert::backend::IConfig> config() const override
+  {
+    return std::make_shared<MockConfig>(_id);
+  }
+  std::unique_ptr<onert::backend::BackendContext>
+  newContext(const Graph &, const std::shared_ptr<onert::backend::custom::IKernelBuilder> &,
+             bool) const override
+  {
+    return nullptr;
+  }
+
+  std::string _id;
+};
+
+// Model: 3x3 DepthwiseConv2D followed by 1x1 Conv2D
+// model input: ifm {1, 4, 4, 2}
+// model output: ofm {1, 4, 4, 3}, and dw_ofm if dw_ofm_is_output
+// constant: dw_ker, dw_bias, pw_ker, pw_bias
+class SeparableConvModel
+{
+public:
+  SeparableConvModel(uint32_t pw_ker_size = 1, bool dw_ofm_is_output = false)
+  {
+    static float dw_ker_data[18] = {};
+    static float dw_bias_data[2] = {};
+    static float pw_ker_data[54] = {};
+    static float pw_bias_data[3] = {};
+
+    graph = std::make_shared<Graph>();
+    TypeInfo float_type{DataType::FLOAT32};
+    ifm = graph->addOperand(Shape{1, 4, 4, 2}, float_type);
+    dw_ker = graph->addOperand(Shape{1, 3, 3, 2}, float_type);
+    dw_bias = graph->addOperand(Shape{2}, float_type);
+    dw_ofm = graph->addOperand(Shape{1, 4, 4, 2}, float_type);
+    pw_ker = graph->addOperand(Shape{3, static_cast<int32_t>(pw_ker_size),
+                                     static_cast<int32_t>(pw_ker_size), 2},
+                               float_type);
+    pw_bias = graph->addOperand(Shape{3}, float_type);
+    ofm = graph->addOperand(Shape{1, 4, 4, 3}, float_type);
+    setData(dw_ker, dw_ker_data, sizeof(dw_ker_data));
+    setData(dw_bias, dw_bias_data, sizeof(dw_bias_data));
+    setData(pw_ker, pw_ker_data, 3 * pw_ker_size * pw_ker_size * 2 * sizeof(float));
+    setData(pw_bias, pw_bias_data, sizeof(pw_bias_data));
+
+    operation::DepthwiseConv2D::Param dw_param;
+    dw_param.stride.vertical = 1;
+    dw_param.stride.horizontal = 1;
+    dw_param.padding = Padding{PaddingType::SAME};
+    dw_param.multiplier = 1;
+    dw_param.activation = Activation::RELU6;
+    dw_index = graph->addOperation(std::make_unique<operation::DepthwiseConv2D>(
+        OperandIndexSequence{ifm, dw_ker, dw_bias}, OperandIndexSequence{dw_ofm}, dw_param));
+
+    operation::Conv2D::Param pw_param;
+    pw_param.stride.vertical = 1;
+    pw_param.stride.horizontal = 1;
+    pw_param.padding = Padding{PaddingType::SAME};
+    pw_param.activation = Activation::RELU;
+    pw_index = graph->addOperation(std::make_unique<operation::Conv2D>(
+        OperandIndexSequence{dw_ofm, pw_ker, pw_bias}, OperandIndexSequence{ofm}, pw_param));
+
+    graph->addInput(ifm);
+    graph->addOutput(ofm);
+    if (dw_ofm_is_output)
+      graph->addOutput(dw_ofm);
+    graph->finishBuilding();
+  }
+
+  uint32_t numOperations() const
+  {
+    uint32_t count = 0;
+    graph->operations().iterate([&](const OperationIndex &, const Operation &) { count++; });
+    return count;
+  }
+
+private:
+  void setData(const OperandIndex &index, const float *data, size_t size)
+  {
+    graph->operands().at(index).data(
+        std::make_unique<CachedData>(reinterpret_cast<const uint8_t *>(data), size));
+  }
+
+public:
+  std::shared_ptr<Graph> graph;
+  OperandIndex ifm, dw_ker, dw_bias, dw_ofm, pw_ker, pw_bias, ofm;
+  OperationIndex dw_index, pw_index;
+};
+
+} // namespace
+
+TEST(SeparableConv2DFusionPass, fuse)
+{
+  SeparableConvModel model;
+  MockBackend cpu{"cpu"};
+  onert::compiler::BackendResolver resolver;
+  resolver.setBackend(model.dw_index, &cpu);
+  resolver.setBackend(model.pw_index, &cpu);
+
+  pass::SeparableConv2DFusionPass{*model.graph, resolver}.run();
+
+  ASSERT_EQ(model.numOperations(), 1u);
+  ASSERT_FALSE(model.graph->operations().exist(model.dw_index));
+  ASSERT_FALSE(model.graph->operations().exist(model.pw_index));
+  ASSERT_FALSE(model.graph->operands().exist(model.dw_ofm));
+
+  const auto &ofm = model.graph->operands().at(model.ofm);
+  ASSERT_EQ(ofm.getDef().size(), 1u);
+  const auto fused_index = *ofm.getDef().begin();
+  const auto &fused = model.graph->operations().at(fused_index);
+  ASSERT_EQ(fused.opcode(), OpCode::SeparableConv2D);
+  ASSERT_EQ(resolver.getBackend(fused_index), &cpu);
+
+  using operation::SeparableConv2D;
+  const auto &inputs = fused.getInputs();
+  ASSERT_EQ(inputs.at(SeparableConv2D::Input::INPUT), model.ifm);
+  ASSERT_EQ(inputs.at(SeparableConv2D::Input::DEPTHWISE_KERNEL), model.dw_ker);
+  ASSERT_EQ(inputs.at(SeparableConv2D::Input::DEPTHWISE_BIAS), model.dw_bias);
+  ASSERT_EQ(inputs.at(SeparableConv2D::Input::POINTWISE_KERNEL), model.pw_ker);
+  ASSERT_EQ(inputs.at(SeparableConv2D::Input::POINTWISE_BIAS), model.pw_bias);
+  ASSERT_TRUE(model.graph->operands().at(model.ifm).getUses().contains(fused_index));
+
+  const auto &param = static_cast<const SeparableConv2D &>(fused).param();
+  ASSERT_EQ(param.padding.type, PaddingType::SAME);
+  ASSERT_EQ(param.multiplier, 1u);
+  ASSERT_EQ(param.depthwise_activation, Activation::RELU6);
+  ASSERT_EQ(param.activation, Activation::RELU);
+}
+
+TEST(SeparableConv2DFusionPass, neg_notCpu)
+{
+  SeparableConvModel model;
+  MockBackend cpu{"cpu"};
+  MockBackend npu{"npu"};
+  onert::compiler::BackendResolver resolver;
+  resolver.setBackend(model.dw_index, &cpu);
+  resolver.setBackend(model.pw_index, &npu);
+
+  pass::SeparableConv2DFusionPass{*model.graph, resolver}.run();
+
+  ASSERT_EQ(model.numOperations(), 2u);
+  ASSERT_TRUE(model.graph->operands().exist(model.dw_ofm));
+}
+
+TEST(SeparableConv2DFusionPass, neg_notPointwise)
+{
+  SeparableConvModel model{3};
+  MockBackend cpu{"cpu"};
+  onert::compiler::BackendResolver resolver;
+  resolver.setBackend(model.dw_index, &cpu);
+  resolver.setBackend(model.pw_index, &cpu);
+
+  pass::SeparableConv2DFusionPass{*model.graph, resolver}.run();
+
+  ASSERT_EQ(model.numOperations(), 2u);
+}
+
+TEST(SeparableConv2DFusionPass, neg_depthwiseOutputUsed)
+{
+  SeparableConvModel model{1, true};
+  MockBackend cpu{"cpu"};
+  onert::compiler::BackendResolver resolver;
+  resolver.setBackend(model.dw_index, &cpu);
+  resolver.setBackend(model.pw_index, &cpu);
+
+  pass::SeparableConv2DFusionPass{*model.graph, resolver}.run();
+
+  ASSERT_EQ(model.numOperations(), 2u);
+  ASSERT_TRUE(model.graph->operands().exist(model.dw_ofm));
+}
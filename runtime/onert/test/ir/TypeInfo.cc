@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ir/TypeInfo.h>
+
+#include <gtest/gtest.h>
+
+TEST(TypeInfoTest, per_tensor)
+{
+  onert::ir::TypeInfo info(onert::ir::DataType::QUANT_UINT8_ASYMM, 0.5f, 128);
+
+  ASSERT_FALSE(info.isPerChannel());
+  ASSERT_EQ(info.scale(), 0.5f);
+  ASSERT_EQ(info.offset(), 128);
+  ASSERT_TRUE(info.scales().empty());
+}
+
+TEST(TypeInfoTest, per_channel)
+{
+  onert::ir::TypeInfo info(onert::ir::DataType::QUANT_INT8_ASYMM, {0.5f, 0.25f, 0.125f}, {0, 0, 0},
+                           3);
+
+  ASSERT_TRUE(info.isPerChannel());
+  ASSERT_EQ(info.scales().size(), 3);
+  ASSERT_EQ(info.scales().at(1), 0.25f);
+  ASSERT_EQ(info.offsets().size(), 3);
+  ASSERT_EQ(info.quantized_dimension(), 3);
+  // Per-tensor accessors give the first channel
+  ASSERT_EQ(info.scale(), 0.5f);
+  ASSERT_EQ(info.offset(), 0);
+
+  onert::ir::TypeInfo per_tensor(onert::ir::DataType::QUANT_INT8_ASYMM, 0.5f, 0);
+  ASSERT_FALSE(info == per_tensor);
+  onert::ir::TypeInfo same(onert::ir::DataType::QUANT_INT8_ASYMM, {0.5f, 0.25f, 0.125f},
+                           {0, 0, 0}, 3);
+  ASSERT_TRUE(info == same);
+}
@@ -147,6 +147,23 @@ TEST_F(TestDynamicTensorReshapeModelLoaded, reshape_multiple_executions)
   set_input_output_and_run(new_shape, expected);
 }
 
+TEST_F(TestDynamicTensorReshapeModelLoaded, reshape_repeated_executions)
+{
+  ASSERT_EQ(nnfw_set_available_backends(_session, "cpu"), NNFW_STATUS_NO_ERROR);
+
+  NNFW_STATUS res = nnfw_prepare(_session);
+  ASSERT_EQ(res, NNFW_STATUS_NO_ERROR);
+
+  std::vector<float> expected = {-1.5, -1.0, -0.5, 0.5, 1.0, 1.5};
+
+  // Shapes recorded for the same input shape are reused only while the new shape is the same
+  for (const auto &new_shape :
+       std::vector<std::vector<int>>{{3, 2}, {3, 2}, {1, 6}, {3, 2}, {1, 6}, {1, 6}})
+  {
+    set_input_output_and_run(new_shape, expected);
+  }
+}
+
 TEST_F(TestDynamicTensorReshapeModelLoaded, neg_reshape_multiple_executions)
 {
   ASSERT_EQ(nnfw_set_available_backends(_session, "cpu"), NNFW_STATUS_NO_ERROR);
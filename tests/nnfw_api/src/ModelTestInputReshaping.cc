@@ -84,3 +84,63 @@ TEST_F(TestInputReshapingAddModelLoaded, reshaping_2x2_to_4x2)
   for (int i = 0; i < expected.size(); ++i)
     ASSERT_EQ(expected[i], actual_output[i]);
 }
+
+/**
+ * @brief Testing the model above with two execution contexts and an input shape for each request
+ *
+ * @note Run this test with "cpu" backend
+ */
+TEST_F(TestInputReshapingAddModelLoaded, reshaping_run_async_pipelined)
+{
+  ASSERT_EQ(nnfw_set_available_backends(_session, "cpu"), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_set_config(_session, "EXECUTION_CONTEXTS", "2"), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_prepare(_session), NNFW_STATUS_NO_ERROR);
+
+  const std::vector<float> input2 = {-10, -10};
+  const std::vector<std::vector<float>> input1s = {{0, 1}, {0, 1, 2, 3, 4, 5}, {0, 1, 2, 3}};
+  const std::vector<std::vector<float>> expecteds = {
+      {-10, -9}, {-10, -9, -8, -7, -6, -5}, {-10, -9, -8, -7}};
+  std::vector<std::vector<float>> outputs;
+  for (const auto &expected : expecteds)
+    outputs.emplace_back(expected.size());
+
+  auto start = [&](size_t n) {
+    nnfw_tensorinfo ti;
+    ti.dtype = NNFW_TYPE_TENSOR_FLOAT32;
+    ti.rank = 2;
+    ti.dims[0] = input1s[n].size() / 2;
+    ti.dims[1] = 2;
+    ASSERT_EQ(nnfw_apply_tensorinfo(_session, 0, ti), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_set_input(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, input1s[n].data(),
+                             sizeof(float) * input1s[n].size()),
+              NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_set_input(_session, 1, NNFW_TYPE_TENSOR_FLOAT32, input2.data(),
+                             sizeof(float) * input2.size()),
+              NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_set_output(_session, 0, NNFW_TYPE_TENSOR_FLOAT32, outputs[n].data(),
+                              sizeof(float) * outputs[n].size()),
+              NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_run_async(_session), NNFW_STATUS_NO_ERROR);
+  };
+
+  // Output info comes from the request awaited last, not from the context set up next
+  auto finish = [&](size_t n) {
+    ASSERT_EQ(nnfw_await(_session), NNFW_STATUS_NO_ERROR);
+    nnfw_tensorinfo ti;
+    ASSERT_EQ(nnfw_output_tensorinfo(_session, 0, &ti), NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(ti.rank, 2);
+    ASSERT_EQ(ti.dims[0], static_cast<int32_t>(input1s[n].size() / 2));
+    ASSERT_EQ(ti.dims[1], 2);
+    ASSERT_EQ(outputs[n], expecteds[n]);
+  };
+
+  start(0);
+  start(1);
+  // The first request has not been awaited yet
+  nnfw_tensorinfo ti;
+  ASSERT_EQ(nnfw_output_tensorinfo(_session, 0, &ti), NNFW_STATUS_ERROR);
+  finish(0);
+  start(2);
+  finish(1);
+  finish(2);
+}
@@ -17,6 +17,8 @@
 #include "fixtures.h"
 #include "NNPackages.h"
 
+#include <nnfw_debug.h>
+
 using ValidationTestAddModelLoaded = ValidationTestModelLoaded<NNPackages::ADD>;
 
 TEST_F(ValidationTestAddModelLoaded, prepare_001)
@@ -77,3 +79,76 @@ TEST_F(ValidationTestAddModelLoaded, neg_load_model)
                 _session, NNPackages::get().getModelAbsolutePath(NNPackages::ADD).c_str()),
             NNFW_STATUS_ERROR);
 }
+
+TEST_F(ValidationTestAddModelLoaded, load_model_from_session)
+{
+  nnfw_session *shared = nullptr;
+  ASSERT_EQ(nnfw_create_session(&shared), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_load_model_from_session(shared, _session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_prepare(shared), NNFW_STATUS_NO_ERROR);
+  // The source session is not affected by the shared one
+  ASSERT_EQ(nnfw_prepare(_session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_close_session(shared), NNFW_STATUS_NO_ERROR);
+}
+
+TEST_F(ValidationTestAddModelLoaded, neg_load_model_from_session)
+{
+  nnfw_session *empty = nullptr;
+  ASSERT_EQ(nnfw_create_session(&empty), NNFW_STATUS_NO_ERROR);
+  // source has no model
+  ASSERT_EQ(nnfw_load_model_from_session(_session, empty), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_load_model_from_session(empty, nullptr), NNFW_STATUS_ERROR);
+  // model is loaded already
+  ASSERT_EQ(nnfw_load_model_from_session(_session, _session), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_close_session(empty), NNFW_STATUS_NO_ERROR);
+}
+
+TEST_F(ValidationTestAddModelLoaded, run_async_pipelined)
+{
+  const uint32_t num_requests = 4;
+  ASSERT_EQ(nnfw_set_config(_session, "EXECUTION_CONTEXTS", "2"), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_prepare(_session), NNFW_STATUS_NO_ERROR);
+
+  nnfw_tensorinfo ti_input;
+  nnfw_tensorinfo ti_output;
+  ASSERT_EQ(nnfw_input_tensorinfo(_session, 0, &ti_input), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_output_tensorinfo(_session, 0, &ti_output), NNFW_STATUS_NO_ERROR);
+
+  std::vector<std::vector<float>> inputs;
+  std::vector<std::vector<float>> outputs;
+  std::vector<std::vector<float>> expected;
+  for (uint32_t i = 0; i < num_requests; ++i)
+  {
+    inputs.emplace_back(num_elems(&ti_input), static_cast<float>(i));
+    outputs.emplace_back(num_elems(&ti_output));
+    expected.emplace_back(num_elems(&ti_output));
+  }
+
+  auto set_io = [&](std::vector<float> &input, std::vector<float> &output) {
+    ASSERT_EQ(nnfw_set_input(_session, 0, ti_input.dtype, input.data(),
+                             sizeof(float) * input.size()),
+              NNFW_STATUS_NO_ERROR);
+    ASSERT_EQ(nnfw_set_output(_session, 0, ti_output.dtype, output.data(),
+                              sizeof(float) * output.size()),
+              NNFW_STATUS_NO_ERROR);
+  };
+
+  for (uint32_t i = 0; i < num_requests; ++i)
+  {
+    set_io(inputs[i], expected[i]);
+    ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_NO_ERROR);
+  }
+
+  // Set up each request while the previous one runs on the other context
+  for (uint32_t i = 0; i < num_requests; ++i)
+  {
+    if (i >= 2)
+      ASSERT_EQ(nnfw_await(_session), NNFW_STATUS_NO_ERROR);
+    set_io(inputs[i], outputs[i]);
+    ASSERT_EQ(nnfw_run_async(_session), NNFW_STATUS_NO_ERROR);
+  }
+  ASSERT_EQ(nnfw_await(_session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_await(_session), NNFW_STATUS_NO_ERROR);
+
+  ASSERT_EQ(outputs, expected);
+}
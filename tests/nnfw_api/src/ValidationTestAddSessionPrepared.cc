@@ -118,4 +118,101 @@ TEST_F(ValidationTestAddSessionPrepared, neg_prepare)
   ASSERT_EQ(nnfw_prepare(_session), NNFW_STATUS_ERROR);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, run_shared_model)
+{
+  // The model can be shared even after the source session is prepared
+  nnfw_session *shared = nullptr;
+  ASSERT_EQ(nnfw_create_session(&shared), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_load_model_from_session(shared, _session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_prepare(shared), NNFW_STATUS_NO_ERROR);
+
+  nnfw_tensorinfo ti_input;
+  ASSERT_EQ(nnfw_input_tensorinfo(shared, 0, &ti_input), NNFW_STATUS_NO_ERROR);
+  std::vector<float> input_buffer(num_elems(&ti_input), 1.f);
+  ASSERT_EQ(nnfw_set_input(shared, 0, ti_input.dtype, input_buffer.data(),
+                           sizeof(float) * input_buffer.size()),
+            NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_set_input(_session, 0, ti_input.dtype, input_buffer.data(),
+                           sizeof(float) * input_buffer.size()),
+            NNFW_STATUS_NO_ERROR);
+
+  nnfw_tensorinfo ti_output;
+  ASSERT_EQ(nnfw_output_tensorinfo(shared, 0, &ti_output), NNFW_STATUS_NO_ERROR);
+  std::vector<float> shared_output(num_elems(&ti_output));
+  std::vector<float> output(num_elems(&ti_output));
+  ASSERT_EQ(nnfw_set_output(shared, 0, ti_output.dtype, shared_output.data(),
+                            sizeof(float) * shared_output.size()),
+            NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_set_output(_session, 0, ti_output.dtype, output.data(),
+                            sizeof(float) * output.size()),
+            NNFW_STATUS_NO_ERROR);
+
+  // Close the source first, the shared session keeps the model alive
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_close_session(_session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_create_session(&_session), NNFW_STATUS_NO_ERROR);
+
+  ASSERT_EQ(nnfw_run(shared), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(shared_output, output);
+  ASSERT_EQ(nnfw_close_session(shared), NNFW_STATUS_NO_ERROR);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, run_async)
+{
+  nnfw_tensorinfo ti_input;
+  ASSERT_EQ(nnfw_input_tensorinfo(_session, 0, &ti_input), NNFW_STATUS_NO_ERROR);
+  std::vector<float> input_buffer(num_elems(&ti_input), 1.f);
+  ASSERT_EQ(nnfw_set_input(_session, 0, ti_input.dtype, input_buffer.data(),
+                           sizeof(float) * input_buffer.size()),
+            NNFW_STATUS_NO_ERROR);
+
+  nnfw_tensorinfo ti_output;
+  ASSERT_EQ(nnfw_output_tensorinfo(_session, 0, &ti_output), NNFW_STATUS_NO_ERROR);
+  std::vector<float> expected(num_elems(&ti_output));
+  std::vector<float> output(num_elems(&ti_output));
+  ASSERT_EQ(nnfw_set_output(_session, 0, ti_output.dtype, expected.data(),
+                            sizeof(float) * expected.size()),
+            NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_NO_ERROR);
+
+  ASSERT_EQ(nnfw_set_output(_session, 0, ti_output.dtype, output.data(),
+                            sizeof(float) * output.size()),
+            NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_run_async(_session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(nnfw_await(_session), NNFW_STATUS_NO_ERROR);
+  ASSERT_EQ(output, expected);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_run_async)
+{
+  nnfw_tensorinfo ti_input;
+  ASSERT_EQ(nnfw_input_tensorinfo(_session, 0, &ti_input), NNFW_STATUS_NO_ERROR);
+  std::vector<float> input_buffer(num_elems(&ti_input));
+  ASSERT_EQ(nnfw_set_input(_session, 0, ti_input.dtype, input_buffer.data(),
+                           sizeof(float) * input_buffer.size()),
+            NNFW_STATUS_NO_ERROR);
+
+  nnfw_tensorinfo ti_output;
+  ASSERT_EQ(nnfw_output_tensorinfo(_session, 0, &ti_output), NNFW_STATUS_NO_ERROR);
+  std::vector<float> output(num_elems(&ti_output));
+  ASSERT_EQ(nnfw_set_output(_session, 0, ti_output.dtype, output.data(),
+                            sizeof(float) * output.size()),
+            NNFW_STATUS_NO_ERROR);
+
+  ASSERT_EQ(nnfw_run_async(_session), NNFW_STATUS_NO_ERROR);
+  // The only execution context is running
+  ASSERT_EQ(nnfw_set_input(_session, 0, ti_input.dtype, input_buffer.data(),
+                           sizeof(float) * input_buffer.size()),
+            NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_run_async(_session), NNFW_STATUS_ERROR);
+  ASSERT_EQ(nnfw_await(_session), NNFW_STATUS_NO_ERROR);
+}
+
+TEST_F(ValidationTestAddSessionPrepared, neg_await)
+{
+  // Nothing is running
+  ASSERT_EQ(nnfw_await(_session), NNFW_STATUS_ERROR);
+}
+
 // TODO Validation check when "nnfw_run" is called without input & output tensor setting
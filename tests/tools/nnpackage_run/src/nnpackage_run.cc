@@ -129,7 +129,7 @@ int main(const int argc, char **argv)
     {
       nnfw_tensorinfo ti;
       NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
-      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_UINT8)
+      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED)
       {
         std::cerr << "E: not supported input type" << std::endl;
         exit(-1);
@@ -145,7 +145,7 @@ int main(const int argc, char **argv)
     {
       nnfw_tensorinfo ti;
       NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
-      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_UINT8)
+      if (ti.dtype < NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype > NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED)
       {
         std::cerr << "E: not supported output type" << std::endl;
         exit(-1);
@@ -194,6 +194,9 @@ int main(const int argc, char **argv)
         case NNFW_TYPE_TENSOR_UINT8:
           randomData<uint8_t>(randgen, inputs[i].data(), num_elems(&ti));
           break;
+        case NNFW_TYPE_TENSOR_QUANT8_ASYMM_SIGNED:
+          randomData<int8_t>(randgen, inputs[i].data(), num_elems(&ti));
+          break;
         case NNFW_TYPE_TENSOR_INT32:
           randomData<int32_t>(randgen, inputs[i].data(), num_elems(&ti));
           break;